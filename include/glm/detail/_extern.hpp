@@ -0,0 +1,79 @@
+/// @ref core
+/// @file glm/detail/_extern.hpp
+///
+/// Extern declarations of the highp float, double and int instantiations compiled in glm.cpp, the glm_static library.
+/// With GLM_FORCE_EXTERN_TEMPLATES, translation units link these instantiations instead of instantiating and compiling them again.
+
+#pragma once
+
+#include "setup.hpp"
+
+#if GLM_EXTERN_TEMPLATES
+
+#define GLM_EXTERN_TEMPLATE_VEC(T, vecType) \
+	extern template struct vecType<T, highp>; \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator-(vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator+(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator-(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator*(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator/(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator*(T, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator+(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator-(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator*(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator/(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE bool operator==(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE bool operator!=(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> abs(vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> min(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> max(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> clamp(vecType<T, highp> const &, vecType<T, highp> const &, vecType<T, highp> const &);
+
+#define GLM_EXTERN_TEMPLATE_VEC_FLOAT(T, vecType) \
+	GLM_EXTERN_TEMPLATE_VEC(T, vecType) \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> floor(vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> min(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> max(vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> clamp(vecType<T, highp> const &, T, T); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> mix(vecType<T, highp> const &, vecType<T, highp> const &, T); \
+	GLM_EXTERN_TEMPLATE T length(vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE T distance(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE T dot(vecType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> normalize(vecType<T, highp> const &);
+
+#define GLM_EXTERN_TEMPLATE_MAT(T, matType, vecType) \
+	extern template struct matType<T, highp>; \
+	GLM_EXTERN_TEMPLATE matType<T, highp> operator+(matType<T, highp> const &, matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE matType<T, highp> operator-(matType<T, highp> const &, matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE matType<T, highp> operator*(matType<T, highp> const &, matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator*(matType<T, highp> const &, vecType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE vecType<T, highp> operator*(vecType<T, highp> const &, matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE matType<T, highp> transpose(matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE T determinant(matType<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE matType<T, highp> inverse(matType<T, highp> const &);
+
+#define GLM_EXTERN_TEMPLATE_FLOAT(T) \
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(T, tvec2) \
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(T, tvec3) \
+	GLM_EXTERN_TEMPLATE_VEC_FLOAT(T, tvec4) \
+	GLM_EXTERN_TEMPLATE tvec3<T, highp> cross(tvec3<T, highp> const &, tvec3<T, highp> const &); \
+	GLM_EXTERN_TEMPLATE_MAT(T, tmat2x2, tvec2) \
+	GLM_EXTERN_TEMPLATE_MAT(T, tmat3x3, tvec3) \
+	GLM_EXTERN_TEMPLATE_MAT(T, tmat4x4, tvec4)
+
+namespace glm
+{
+	GLM_EXTERN_TEMPLATE_FLOAT(float)
+	GLM_EXTERN_TEMPLATE_FLOAT(double)
+
+	GLM_EXTERN_TEMPLATE_VEC(int, tvec2)
+	GLM_EXTERN_TEMPLATE_VEC(int, tvec3)
+	GLM_EXTERN_TEMPLATE_VEC(int, tvec4)
+}//namespace glm
+
+#undef GLM_EXTERN_TEMPLATE_FLOAT
+#undef GLM_EXTERN_TEMPLATE_MAT
+#undef GLM_EXTERN_TEMPLATE_VEC_FLOAT
+#undef GLM_EXTERN_TEMPLATE_VEC
+
+#endif//GLM_EXTERN_TEMPLATES
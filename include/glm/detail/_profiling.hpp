@@ -0,0 +1,128 @@
+/// @ref core
+/// @file glm/detail/_profiling.hpp
+///
+/// Call counters of the generic and SIMD compute_* implementations, enabled by GLM_ENABLE_PROFILING.
+/// Each instrumented implementation owns a counter per template instantiation, registered on its first call.
+/// GLM_GTX_profiling reads, dumps and resets them.
+
+#pragma once
+
+#include "type_int.hpp"
+
+#if GLM_PROFILING
+
+#if GLM_HAS_CXX11_STL
+#	include <atomic>
+#endif
+
+#if GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM | GLM_COMPILER_INTEL)
+#	define GLM_PROFILE_SIGNATURE __PRETTY_FUNCTION__
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	define GLM_PROFILE_SIGNATURE __FUNCSIG__
+#else
+#	define GLM_PROFILE_SIGNATURE __FUNCTION__
+#endif
+
+#define GLM_PROFILE_CALL(Function, Simd) \
+	static ::glm::detail::profile_counter ProfileCounter(Function, GLM_PROFILE_SIGNATURE, Simd); \
+	ProfileCounter.record()
+
+#define GLM_PROFILE_GENERIC(Function) GLM_PROFILE_CALL(Function, false)
+#define GLM_PROFILE_SIMD(Function) GLM_PROFILE_CALL(Function, true)
+
+namespace glm{
+namespace detail
+{
+	typedef void (*profile_callback)(char const * Function, char const * Signature, bool Simd);
+
+	struct profile_counter
+	{
+		GLM_FUNC_DECL profile_counter(char const * FunctionName, char const * FunctionSignature, bool SimdPath);
+
+		GLM_FUNC_DECL void record();
+
+		/// Name of the compute structure
+		char const * Function;
+		/// Signature of the instantiation, including the template arguments when the compiler provides them
+		char const * Signature;
+		bool Simd;
+#		if GLM_HAS_CXX11_STL
+			std::atomic<uint64> Calls;
+#		else
+			uint64 Calls;
+#		endif
+		profile_counter * Next;
+	};
+
+#	if GLM_HAS_CXX11_STL
+		GLM_FUNC_QUALIFIER std::atomic<profile_counter*> & profile_counters()
+		{
+			static std::atomic<profile_counter*> Head(0);
+			return Head;
+		}
+
+		GLM_FUNC_QUALIFIER std::atomic<profile_callback> & profile_callback_storage()
+		{
+			static std::atomic<profile_callback> Callback(0);
+			return Callback;
+		}
+
+		GLM_FUNC_QUALIFIER profile_counter::profile_counter(char const * FunctionName, char const * FunctionSignature, bool SimdPath)
+			: Function(FunctionName)
+			, Signature(FunctionSignature)
+			, Simd(SimdPath)
+			, Calls(0)
+			, Next(profile_counters().load(std::memory_order_relaxed))
+		{
+			// Counters of different functions may be registered concurrently
+			while(!profile_counters().compare_exchange_weak(this->Next, this, std::memory_order_release, std::memory_order_relaxed)){}
+		}
+
+		GLM_FUNC_QUALIFIER void profile_counter::record()
+		{
+			this->Calls.fetch_add(1, std::memory_order_relaxed);
+
+			profile_callback const Callback = profile_callback_storage().load(std::memory_order_relaxed);
+			if(Callback)
+				Callback(this->Function, this->Signature, this->Simd);
+		}
+#	else
+		GLM_FUNC_QUALIFIER profile_counter * & profile_counters()
+		{
+			static profile_counter * Head(0);
+			return Head;
+		}
+
+		GLM_FUNC_QUALIFIER profile_callback & profile_callback_storage()
+		{
+			static profile_callback Callback(0);
+			return Callback;
+		}
+
+		GLM_FUNC_QUALIFIER profile_counter::profile_counter(char const * FunctionName, char const * FunctionSignature, bool SimdPath)
+			: Function(FunctionName)
+			, Signature(FunctionSignature)
+			, Simd(SimdPath)
+			, Calls(0)
+			, Next(profile_counters())
+		{
+			profile_counters() = this;
+		}
+
+		GLM_FUNC_QUALIFIER void profile_counter::record()
+		{
+			++this->Calls;
+
+			if(profile_callback_storage())
+				profile_callback_storage()(this->Function, this->Signature, this->Simd);
+		}
+#	endif
+}//namespace detail
+}//namespace glm
+
+#else//GLM_PROFILING
+
+#define GLM_PROFILE_GENERIC(Function)
+#define GLM_PROFILE_SIMD(Function)
+
+#endif//GLM_PROFILING
@@ -43,6 +43,25 @@ namespace detail
 		GLM_FUNC_QUALIFIER vecType<T, P> operator ()()  const { return vecType<T, P>(this->elem(E0), this->elem(E1), this->elem(E2), this->elem(E3)); }
 	};
 
+	// Assign the components of that to the components E0, E1, E2 and E3 of the swizzled vector starting at Dst
+	template <int N, typename T, precision P, template <typename, precision> class vecType, int E0, int E1, int E2, int E3, bool Aligned>
+	struct compute_swizzle_assign
+	{
+		GLM_FUNC_QUALIFIER static void call(T * Dst, vecType<T, P> const & that)
+		{
+			// Make a copy of the data in case Dst and that overlap.
+			// The copier should optimize out the copy in cases where the function is
+			// properly inlined and the copy is not necessary.
+			T t[N];
+			for (int i = 0; i < N; ++i)
+				t[i] = that[i];
+
+			const int offset_dst[4] = { E0, E1, E2, E3 };
+			for (int i = 0; i < N; ++i)
+				Dst[offset_dst[i]] = t[i];
+		}
+	};
+
 	// Internal class for implementing swizzle operators
 	/*
 		Template parameters:
@@ -67,43 +86,28 @@ namespace detail
 
 		GLM_FUNC_QUALIFIER _swizzle_base2& operator= (vecType<T, P> const& that)
 		{
-			struct op { 
-				GLM_FUNC_QUALIFIER void operator() (T& e, T& t) { e = t; } 
-			};
-			_apply_op(that, op());
+			compute_swizzle_assign<N, T, P, vecType, E0, E1, E2, E3, detail::is_aligned<P>::value>::call(&this->elem(0), that);
 			return *this;
 		}
 
 		GLM_FUNC_QUALIFIER void operator -= (vecType<T, P> const& that)
 		{
-			struct op { 
-				GLM_FUNC_QUALIFIER void operator() (T& e, T& t) { e -= t; } 
-			};
-			_apply_op(that, op());
+			*this = (*this)() - that;
 		}
 
 		GLM_FUNC_QUALIFIER void operator += (vecType<T, P> const& that)
 		{
-			struct op { 
-				GLM_FUNC_QUALIFIER void operator() (T& e, T& t) { e += t; } 
-			};
-			_apply_op(that, op());
+			*this = (*this)() + that;
 		}
 
 		GLM_FUNC_QUALIFIER void operator *= (vecType<T, P> const& that)
 		{
-			struct op { 
-				GLM_FUNC_QUALIFIER void operator() (T& e, T& t) { e *= t; } 
-			};
-			_apply_op(that, op());
+			*this = (*this)() * that;
 		}
 
 		GLM_FUNC_QUALIFIER void operator /= (vecType<T, P> const& that)
 		{
-			struct op { 
-				GLM_FUNC_QUALIFIER void operator() (T& e, T& t) { e /= t; } 
-			};
-			_apply_op(that, op());
+			*this = (*this)() / that;
 		}
 
 		GLM_FUNC_QUALIFIER T& operator[](size_t i)
@@ -116,20 +120,6 @@ namespace detail
 			const int offset_dst[4] = { E0, E1, E2, E3 };
 			return this->elem(offset_dst[i]);
 		}
-
-	protected:
-		template <typename U>
-		GLM_FUNC_QUALIFIER void _apply_op(vecType<T, P> const& that, U op)
-		{
-			// Make a copy of the data in this == &that.
-			// The copier should optimize out the copy in cases where the function is
-			// properly inlined and the copy is not necessary.
-			T t[N];
-			for (int i = 0; i < N; ++i)
-				t[i] = that[i];
-			for (int i = 0; i < N; ++i)
-				op( (*this)[i], t[i] );
-		}
 	};
 
 	// Specialization for swizzles containing duplicate elements.  These cannot be modified.
@@ -17,7 +17,7 @@ namespace detail
 	template <typename R, typename T, precision P>
 	struct functor1<R, T, P, tvec1>
 	{
-		GLM_FUNC_QUALIFIER static tvec1<R, P> call(R (*Func) (T x), tvec1<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec1<R, P> call(R (*Func) (T x), tvec1<T, P> const & v)
 		{
 			return tvec1<R, P>(Func(v.x));
 		}
@@ -26,7 +26,7 @@ namespace detail
 	template <typename R, typename T, precision P>
 	struct functor1<R, T, P, tvec2>
 	{
-		GLM_FUNC_QUALIFIER static tvec2<R, P> call(R (*Func) (T x), tvec2<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec2<R, P> call(R (*Func) (T x), tvec2<T, P> const & v)
 		{
 			return tvec2<R, P>(Func(v.x), Func(v.y));
 		}
@@ -35,7 +35,7 @@ namespace detail
 	template <typename R, typename T, precision P>
 	struct functor1<R, T, P, tvec3>
 	{
-		GLM_FUNC_QUALIFIER static tvec3<R, P> call(R (*Func) (T x), tvec3<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec3<R, P> call(R (*Func) (T x), tvec3<T, P> const & v)
 		{
 			return tvec3<R, P>(Func(v.x), Func(v.y), Func(v.z));
 		}
@@ -44,7 +44,7 @@ namespace detail
 	template <typename R, typename T, precision P>
 	struct functor1<R, T, P, tvec4>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<R, P> call(R (*Func) (T x), tvec4<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec4<R, P> call(R (*Func) (T x), tvec4<T, P> const & v)
 		{
 			return tvec4<R, P>(Func(v.x), Func(v.y), Func(v.z), Func(v.w));
 		}
@@ -56,7 +56,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2<T, P, tvec1>
 	{
-		GLM_FUNC_QUALIFIER static tvec1<T, P> call(T (*Func) (T x, T y), tvec1<T, P> const & a, tvec1<T, P> const & b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec1<T, P> call(T (*Func) (T x, T y), tvec1<T, P> const & a, tvec1<T, P> const & b)
 		{
 			return tvec1<T, P>(Func(a.x, b.x));
 		}
@@ -65,7 +65,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2<T, P, tvec2>
 	{
-		GLM_FUNC_QUALIFIER static tvec2<T, P> call(T (*Func) (T x, T y), tvec2<T, P> const & a, tvec2<T, P> const & b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec2<T, P> call(T (*Func) (T x, T y), tvec2<T, P> const & a, tvec2<T, P> const & b)
 		{
 			return tvec2<T, P>(Func(a.x, b.x), Func(a.y, b.y));
 		}
@@ -74,7 +74,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2<T, P, tvec3>
 	{
-		GLM_FUNC_QUALIFIER static tvec3<T, P> call(T (*Func) (T x, T y), tvec3<T, P> const & a, tvec3<T, P> const & b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec3<T, P> call(T (*Func) (T x, T y), tvec3<T, P> const & a, tvec3<T, P> const & b)
 		{
 			return tvec3<T, P>(Func(a.x, b.x), Func(a.y, b.y), Func(a.z, b.z));
 		}
@@ -83,7 +83,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2<T, P, tvec4>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<T, P> call(T (*Func) (T x, T y), tvec4<T, P> const & a, tvec4<T, P> const & b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec4<T, P> call(T (*Func) (T x, T y), tvec4<T, P> const & a, tvec4<T, P> const & b)
 		{
 			return tvec4<T, P>(Func(a.x, b.x), Func(a.y, b.y), Func(a.z, b.z), Func(a.w, b.w));
 		}
@@ -95,7 +95,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2_vec_sca<T, P, tvec1>
 	{
-		GLM_FUNC_QUALIFIER static tvec1<T, P> call(T (*Func) (T x, T y), tvec1<T, P> const & a, T b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec1<T, P> call(T (*Func) (T x, T y), tvec1<T, P> const & a, T b)
 		{
 			return tvec1<T, P>(Func(a.x, b));
 		}
@@ -104,7 +104,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2_vec_sca<T, P, tvec2>
 	{
-		GLM_FUNC_QUALIFIER static tvec2<T, P> call(T (*Func) (T x, T y), tvec2<T, P> const & a, T b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec2<T, P> call(T (*Func) (T x, T y), tvec2<T, P> const & a, T b)
 		{
 			return tvec2<T, P>(Func(a.x, b), Func(a.y, b));
 		}
@@ -113,7 +113,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2_vec_sca<T, P, tvec3>
 	{
-		GLM_FUNC_QUALIFIER static tvec3<T, P> call(T (*Func) (T x, T y), tvec3<T, P> const & a, T b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec3<T, P> call(T (*Func) (T x, T y), tvec3<T, P> const & a, T b)
 		{
 			return tvec3<T, P>(Func(a.x, b), Func(a.y, b), Func(a.z, b));
 		}
@@ -122,7 +122,7 @@ namespace detail
 	template <typename T, precision P>
 	struct functor2_vec_sca<T, P, tvec4>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<T, P> call(T (*Func) (T x, T y), tvec4<T, P> const & a, T b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec4<T, P> call(T (*Func) (T x, T y), tvec4<T, P> const & a, T b)
 		{
 			return tvec4<T, P>(Func(a.x, b), Func(a.y, b), Func(a.z, b), Func(a.w, b));
 		}
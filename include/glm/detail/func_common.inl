@@ -73,7 +73,7 @@ namespace detail
 	template <typename genFIType>
 	struct compute_abs<genFIType, true>
 	{
-		GLM_FUNC_QUALIFIER static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				std::numeric_limits<genFIType>::is_iec559 || std::numeric_limits<genFIType>::is_signed,
@@ -98,7 +98,7 @@ namespace detail
 	template <typename genFIType>
 	struct compute_abs<genFIType, false>
 	{
-		GLM_FUNC_QUALIFIER static genFIType call(genFIType x)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 genFIType call(genFIType x)
 		{
 			GLM_STATIC_ASSERT(
 				!std::numeric_limits<genFIType>::is_signed && std::numeric_limits<genFIType>::is_integer,
@@ -112,6 +112,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_abs_vector");
 			return detail::functor1<T, T, P, vecType>::call(abs, x);
 		}
 	};
@@ -121,6 +122,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y, vecType<U, P> const & a)
 		{
+			GLM_PROFILE_GENERIC("compute_mix_vector");
 			GLM_STATIC_ASSERT(std::numeric_limits<U>::is_iec559, "'mix' only accept floating-point inputs for the interpolator a");
 
 			return vecType<T, P>(vecType<U, P>(x) + a * vecType<U, P>(y - x));
@@ -132,6 +134,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y, vecType<bool, P> const & a)
 		{
+			GLM_PROFILE_GENERIC("compute_mix_vector");
 			vecType<T, P> Result(uninitialize);
 			for(length_t i = 0; i < x.length(); ++i)
 				Result[i] = a[i] ? y[i] : x[i];
@@ -144,6 +147,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y, U const & a)
 		{
+			GLM_PROFILE_GENERIC("compute_mix_scalar");
 			GLM_STATIC_ASSERT(std::numeric_limits<U>::is_iec559, "'mix' only accept floating-point inputs for the interpolator a");
 
 			return vecType<T, P>(vecType<U, P>(x) + a * vecType<U, P>(y - x));
@@ -155,6 +159,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y, bool const & a)
 		{
+			GLM_PROFILE_GENERIC("compute_mix_scalar");
 			return a ? y : x;
 		}
 	};
@@ -184,6 +189,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_sign");
 			return vecType<T, P>(glm::lessThan(vecType<T, P>(0), x)) - vecType<T, P>(glm::lessThan(x, vecType<T, P>(0)));
 		}
 	};
@@ -194,6 +200,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_sign");
 			T const Shift(static_cast<T>(sizeof(T) * 8 - 1));
 			vecType<T, P> const y(vecType<typename make_unsigned<T>::type, P>(-x) >> typename make_unsigned<T>::type(Shift));
 
@@ -207,6 +214,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_floor");
 			return detail::functor1<T, T, P, vecType>::call(std::floor, x);
 		}
 	};
@@ -216,6 +224,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_ceil");
 			return detail::functor1<T, T, P, vecType>::call(std::ceil, x);
 		}
 	};
@@ -225,6 +234,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_fract");
 			return x - floor(x);
 		}
 	};
@@ -234,6 +244,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_trunc");
 			return detail::functor1<T, T, P, vecType>::call(trunc, x);
 		}
 	};
@@ -243,6 +254,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_round");
 			return detail::functor1<T, T, P, vecType>::call(round, x);
 		}
 	};
@@ -252,6 +264,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & a, vecType<T, P> const & b)
 		{
+			GLM_PROFILE_GENERIC("compute_mod");
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mod' only accept floating-point inputs. Include <glm/gtc/integer.hpp> for integer inputs.");
 			return a - b * floor(a / b);
 		}
@@ -262,6 +275,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_min_vector");
 			return detail::functor2<T, P, vecType>::call(min, x, y);
 		}
 	};
@@ -271,6 +285,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_max_vector");
 			return detail::functor2<T, P, vecType>::call(max, x, y);
 		}
 	};
@@ -280,6 +295,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, vecType<T, P> const & minVal, vecType<T, P> const & maxVal)
 		{
+			GLM_PROFILE_GENERIC("compute_clamp_vector");
 			return min(max(x, minVal), maxVal);
 		}
 	};
@@ -289,6 +305,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & edge, vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_step_vector");
 			return mix(vecType<T, P>(1), vecType<T, P>(0), glm::lessThan(x, edge));
 		}
 	};
@@ -298,6 +315,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & edge0, vecType<T, P> const & edge1, vecType<T, P> const & x)
 		{
+			GLM_PROFILE_GENERIC("compute_smoothstep_vector");
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'step' only accept floating-point inputs");
 			vecType<T, P> const tmp(clamp((x - edge0) / (edge1 - edge0), static_cast<T>(0), static_cast<T>(1)));
 			return tmp * tmp * (static_cast<T>(3) - static_cast<T>(2) * tmp);
@@ -306,7 +324,7 @@ namespace detail
 }//namespace detail
 
 	template <typename genFIType>
-	GLM_FUNC_QUALIFIER genFIType abs(genFIType x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genFIType abs(genFIType x)
 	{
 		return detail::compute_abs<genFIType, std::numeric_limits<genFIType>::is_signed>::call(x);
 	}
@@ -15,6 +15,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_abs_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_abs(v.data);
 			return result;
@@ -26,6 +27,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_abs_vector");
 			tvec4<int, P> result(uninitialize);
 			result.data = glm_ivec4_abs(v.data);
 			return result;
@@ -37,6 +39,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_floor");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_floor(v.data);
 			return result;
@@ -48,6 +51,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_ceil");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_ceil(v.data);
 			return result;
@@ -59,6 +63,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_fract");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_fract(v.data);
 			return result;
@@ -70,6 +75,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_round");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_round(v.data);
 			return result;
@@ -81,6 +87,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x, tvec4<float, P> const & y)
 		{
+			GLM_PROFILE_SIMD("compute_mod");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_mod(x.data, y.data);
 			return result;
@@ -92,6 +99,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_min_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = _mm_min_ps(v1.data, v2.data);
 			return result;
@@ -103,6 +111,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<int32, P> call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_min_vector");
 			tvec4<int32, P> result(uninitialize);
 			result.data = _mm_min_epi32(v1.data, v2.data);
 			return result;
@@ -114,6 +123,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<int32, P> call(tvec4<uint32, P> const & v1, tvec4<uint32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_min_vector");
 			tvec4<uint32, P> result(uninitialize);
 			result.data = _mm_min_epu32(v1.data, v2.data);
 			return result;
@@ -125,6 +135,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_max_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = _mm_max_ps(v1.data, v2.data);
 			return result;
@@ -136,6 +147,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<int32, P> call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_max_vector");
 			tvec4<int32, P> result(uninitialize);
 			result.data = _mm_max_epi32(v1.data, v2.data);
 			return result;
@@ -147,6 +159,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<uint32, P> call(tvec4<uint32, P> const & v1, tvec4<uint32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_max_vector");
 			tvec4<uint32, P> result(uninitialize);
 			result.data = _mm_max_epu32(v1.data, v2.data);
 			return result;
@@ -158,6 +171,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x, tvec4<float, P> const & minVal, tvec4<float, P> const & maxVal)
 		{
+			GLM_PROFILE_SIMD("compute_clamp_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = _mm_min_ps(_mm_max_ps(x.data, minVal.data), maxVal.data);
 			return result;
@@ -169,6 +183,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<int32, P> call(tvec4<int32, P> const & x, tvec4<int32, P> const & minVal, tvec4<int32, P> const & maxVal)
 		{
+			GLM_PROFILE_SIMD("compute_clamp_vector");
 			tvec4<int32, P> result(uninitialize);
 			result.data = _mm_min_epi32(_mm_max_epi32(x.data, minVal.data), maxVal.data);
 			return result;
@@ -180,6 +195,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<uint32, P> call(tvec4<uint32, P> const & x, tvec4<uint32, P> const & minVal, tvec4<uint32, P> const & maxVal)
 		{
+			GLM_PROFILE_SIMD("compute_clamp_vector");
 			tvec4<uint32, P> result(uninitialize);
 			result.data = _mm_min_epu32(_mm_max_epu32(x.data, minVal.data), maxVal.data);
 			return result;
@@ -191,6 +207,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x, tvec4<float, P> const & y, tvec4<bool, P> const & a)
 		{
+			GLM_PROFILE_SIMD("compute_mix_vector");
 			__m128i const Load = _mm_set_epi32(-(int)a.w, -(int)a.z, -(int)a.y, -(int)a.x);
 			__m128 const Mask = _mm_castsi128_ps(Load);
 
@@ -209,6 +226,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& edge, tvec4<float, P> const& x)
 		{
+			GLM_PROFILE_SIMD("compute_step_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_step(edge.data, x.data);
 			return result;
@@ -220,11 +238,72 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& edge0, tvec4<float, P> const& edge1, tvec4<float, P> const& x)
 		{
+			GLM_PROFILE_SIMD("compute_smoothstep_vector");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_smoothstep(edge0.data, edge1.data, x.data);
 			return result;
 		}
 	};
+
+	template <precision P>
+	struct compute_floor<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_floor");
+			tvec2<double, P> result(uninitialize);
+			result.data = glm_dvec2_floor(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_ceil<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_ceil");
+			tvec2<double, P> result(uninitialize);
+			result.data = glm_dvec2_ceil(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_min_vector<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & v1, tvec2<double, P> const & v2)
+		{
+			GLM_PROFILE_SIMD("compute_min_vector");
+			tvec2<double, P> result(uninitialize);
+			result.data = _mm_min_pd(v1.data, v2.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_max_vector<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & v1, tvec2<double, P> const & v2)
+		{
+			GLM_PROFILE_SIMD("compute_max_vector");
+			tvec2<double, P> result(uninitialize);
+			result.data = _mm_max_pd(v1.data, v2.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_clamp_vector<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & x, tvec2<double, P> const & minVal, tvec2<double, P> const & maxVal)
+		{
+			GLM_PROFILE_SIMD("compute_clamp_vector");
+			tvec2<double, P> result(uninitialize);
+			result.data = _mm_min_pd(_mm_max_pd(x.data, minVal.data), maxVal.data);
+			return result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
@@ -7,6 +7,14 @@
 /// @ingroup core
 /// 
 /// These all operate component-wise. The description is per component.
+///
+/// Float vectors with mediump or lowp precision qualifiers evaluate faster approximations:
+/// - exp2, exp: relative error below 5e-6 (mediump) and 2e-3 (lowp) for |x| < 32
+/// - log2, log: absolute error below 3e-6 (mediump) and 1e-3 (lowp)
+/// - pow: exp2(y * log2(x)) with the kernels above for finite x > 0 and finite y != 0, relative error below 3e-6 + 3e-6 * |y| (mediump) and 2e-3 + 1e-3 * |y| (lowp)
+/// - inversesqrt: relative error below 5e-6 (mediump) and 2e-3 (lowp), mediump is as accurate as highp when SSE2 is available
+/// - sqrt: relative error below 2e-3 (lowp), mediump is as accurate as highp
+/// Arguments outside of the range of the approximations fall back to the highp functions, so that special values are preserved.
 
 #pragma once
 
@@ -85,7 +93,7 @@ namespace glm
 	//template <typename genType>
 	//GLM_FUNC_DECL genType sqrt(genType const & x);
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> sqrt(vecType<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> sqrt(vecType<T, P> const & v);
 	
 	/// Returns the reciprocal of the positive square root of v.
 	/// 
@@ -3,6 +3,7 @@
 
 #include "func_vector_relational.hpp"
 #include "_vectorize.hpp"
+#include "../simd/exponential.h"
 #include <limits>
 #include <cmath>
 #include <cassert>
@@ -20,46 +21,370 @@ namespace detail
 		}
 #	endif
 
+	template <typename genType>
+	GLM_FUNC_QUALIFIER genType exp2(genType x)
+	{
+		return std::exp(static_cast<genType>(0.69314718055994530941723212145818) * x);
+	}
+
+	// -- Constant evaluation --
+
+	// Square root by Newton's iterations from above, in extended precision where long double provides it
+	// so that rounding the converged root to double is exact in nearly all cases
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 double sqrt_newton(double x)
+	{
+		if(!(x > 0.0) || x > std::numeric_limits<double>::max())
+			return x == 0.0 || x > 0.0 ? x : std::numeric_limits<double>::quiet_NaN();
+
+		long double const Value = x;
+		long double Root = Value > 1.0L ? Value : 1.0L;
+		for(;;)
+		{
+			long double const Next = 0.5L * (Root + Value / Root);
+			if(Next >= Root)
+				return static_cast<double>(Root);
+			Root = Next;
+		}
+	}
+
+	// sqrt_newton in constant expressions, std::sqrt at runtime
+	template <typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType sqrt_constexpr(genType x)
+	{
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return static_cast<genType>(sqrt_newton(static_cast<double>(x)));
+#		endif
+		return std::sqrt(x);
+	}
+
+	// -- Precision tiers --
+	// Component kernels selected by detail::precision_tier. highp kernels call the standard library,
+	// float mediump and lowp kernels evaluate approximations within the bounds documented in func_exponential.hpp.
+	// Other types use the highp kernels at every tier.
+
+	// x = n + f with n = round(x) and f in [-0.5, 0.5], for x in [-126, 127]. Returns 2^n.
+	GLM_FUNC_QUALIFIER float exp2_reduce(float x, float & f)
+	{
+		int const n = static_cast<int>(x < 0.0f ? x - 0.5f : x + 0.5f);
+		f = x - static_cast<float>(n);
+
+		union {float f; int i;} Pow2;
+		Pow2.i = (n + 127) * (1 << 23);
+		return Pow2.f;
+	}
+
+	// x = 2^e * m with m in [sqrt(0.5), sqrt(2)), for positive normalized x. Returns e and stores m - 1 in t.
+	GLM_FUNC_QUALIFIER float log2_reduce(float x, float & t)
+	{
+		union {float f; int i;} Bits;
+		Bits.f = x;
+		int const e = (Bits.i - 0x3F3504F3) >> 23;
+		Bits.i -= e * (1 << 23);
+		t = Bits.f - 1.0f;
+		return static_cast<float>(e);
+	}
+
+	template <typename T, precision Tier>
+	struct compute_exp2_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return exp2(x);
+		}
+	};
+
+	template <>
+	struct compute_exp2_tier<float, mediump>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			if(!(x >= -126.0f && x <= 127.0f))
+				return exp2(x);
+
+			float f;
+			float const Pow2 = exp2_reduce(x, f);
+			return Pow2 * (0.999999191f + f * (0.693121968f + f * (0.240249811f + f * (0.0559170392f + f * 0.00956051021f))));
+		}
+	};
+
+	template <>
+	struct compute_exp2_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			if(!(x >= -126.0f && x <= 127.0f))
+				return exp2(x);
+
+			float f;
+			float const Pow2 = exp2_reduce(x, f);
+			return Pow2 * (1.00051370f + f * (0.703396523f + f * 0.237830418f));
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_log2_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return log2(x);
+		}
+	};
+
+	template <>
+	struct compute_log2_tier<float, mediump>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			if(!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return log2(x);
+
+			float t;
+			float const e = log2_reduce(x, t);
+			return e + t * (1.44271348f + t * (-0.721131858f + t * (0.479348021f + t * (-0.367489994f + t * (0.322154775f + t * -0.206591638f)))));
+		}
+	};
+
+	template <>
+	struct compute_log2_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			if(!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return log2(x);
+
+			float t;
+			float const e = log2_reduce(x, t);
+			return e + t * (1.44515208f + t * (-0.754081355f + t * 0.445070064f));
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_exp_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::exp(x);
+		}
+	};
+
+	template <precision Tier>
+	struct compute_exp_tier<float, Tier>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return compute_exp2_tier<float, Tier>::call(x * 1.44269504088896340736f);
+		}
+	};
+
+	template <>
+	struct compute_exp_tier<float, highp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return std::exp(x);
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_log_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::log(x);
+		}
+	};
+
+	template <precision Tier>
+	struct compute_log_tier<float, Tier>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return compute_log2_tier<float, Tier>::call(x) * 0.69314718055994530942f;
+		}
+	};
+
+	template <>
+	struct compute_log_tier<float, highp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return std::log(x);
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_pow_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T base, T exponent)
+		{
+			return std::pow(base, exponent);
+		}
+	};
+
+	// Bases which are not positive and finite, exponents which are zero or not finite keep the special cases of std::pow
+	template <precision Tier>
+	struct compute_pow_tier<float, Tier>
+	{
+		GLM_FUNC_QUALIFIER static float call(float base, float exponent)
+		{
+			if(!(base > 0.0f && base <= std::numeric_limits<float>::max()) || !(exponent != 0.0f && std::fabs(exponent) <= std::numeric_limits<float>::max()))
+				return std::pow(base, exponent);
+			return compute_exp2_tier<float, Tier>::call(exponent * compute_log2_tier<float, Tier>::call(base));
+		}
+	};
+
+	template <>
+	struct compute_pow_tier<float, highp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float base, float exponent)
+		{
+			return std::pow(base, exponent);
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_inversesqrt_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return static_cast<T>(1) / std::sqrt(x);
+		}
+	};
+
+	// Estimate of 1 / sqrt(x) from the bits of x, about 4 bits of precision
+	GLM_FUNC_QUALIFIER float inversesqrt_estimate(float x)
+	{
+		union {float f; unsigned int i;} Bits;
+		Bits.f = x;
+		Bits.i = 0x5f375a86u - (Bits.i >> 1);
+		return Bits.f;
+	}
+
+#	if !(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	// With SSE2, sqrtss and divss outpace rsqrtss refined to mediump precision, mediump then keeps the exact result
+	template <>
+	struct compute_inversesqrt_tier<float, mediump>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			// The Newton-Raphson steps turn 0 and infinity into NaN
+			if(!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return 1.0f / std::sqrt(x);
+
+			float const xhalf = x * 0.5f;
+			float const Estimate = inversesqrt_estimate(x);
+			float const Newton = Estimate * (1.5f - xhalf * Estimate * Estimate);
+			return Newton * (1.5f - xhalf * Newton * Newton);
+		}
+	};
+#	endif//!(GLM_ARCH & GLM_ARCH_SSE2_BIT)
+
+	template <>
+	struct compute_inversesqrt_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#			else
+				float const Estimate = inversesqrt_estimate(x);
+				return Estimate * (1.5f - x * 0.5f * Estimate * Estimate);
+#			endif
+		}
+	};
+
+	// Square roots are a single instruction on most hardware, only lowp trades accuracy for speed
+	template <typename T, precision Tier>
+	struct compute_sqrt_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::sqrt(x);
+		}
+	};
+
+	template <>
+	struct compute_sqrt_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			// The estimate of the inverse square root overflows for 0 and denormals, and turns infinity into NaN
+			if(!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return std::sqrt(x);
+			return x * compute_inversesqrt_tier<float, lowp>::call(x);
+		}
+	};
+
+	// -- Vector functions --
+
 	template <typename T, precision P, template <class, precision> class vecType, bool isFloat, bool Aligned>
 	struct compute_log2
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & vec)
 		{
-			return detail::functor1<T, T, P, vecType>::call(log2, vec);
+			GLM_PROFILE_GENERIC("compute_log2");
+			return detail::functor1<T, T, P, vecType>::call(compute_log2_tier<T, precision_tier<P>::value>::call, vec);
 		}
 	};
 
 	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
-	struct compute_sqrt
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & base, vecType<T, P> const & exponent)
+		{
+			GLM_PROFILE_GENERIC("compute_pow");
+			return detail::functor2<T, P, vecType>::call(compute_pow_tier<T, precision_tier<P>::value>::call, base, exponent);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_exp
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
-			return detail::functor1<T, T, P, vecType>::call(std::sqrt, x);
+			GLM_PROFILE_GENERIC("compute_exp");
+			return detail::functor1<T, T, P, vecType>::call(compute_exp_tier<T, precision_tier<P>::value>::call, x);
 		}
 	};
 
 	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
-	struct compute_inversesqrt
+	struct compute_log
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
-			return static_cast<T>(1) / sqrt(x);
+			GLM_PROFILE_GENERIC("compute_log");
+			return detail::functor1<T, T, P, vecType>::call(compute_log_tier<T, precision_tier<P>::value>::call, x);
 		}
 	};
-		
-	template <template <class, precision> class vecType, bool Aligned>
-	struct compute_inversesqrt<vecType, float, lowp, Aligned>
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_exp2");
+			return detail::functor1<T, T, P, vecType>::call(compute_exp2_tier<T, precision_tier<P>::value>::call, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sqrt
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, lowp> call(vecType<float, lowp> const & x)
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_sqrt");
+			return detail::functor1<T, T, P, vecType>::call(compute_sqrt_tier<T, precision_tier<P>::value>::call, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_inversesqrt
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
 		{
-			vecType<float, lowp> tmp(x);
-			vecType<float, lowp> xhalf(tmp * 0.5f);
-			vecType<uint, lowp>* p = reinterpret_cast<vecType<uint, lowp>*>(const_cast<vecType<float, lowp>*>(&x));
-			vecType<uint, lowp> i = vecType<uint, lowp>(0x5f375a86) - (*p >> vecType<uint, lowp>(1));
-			vecType<float, lowp>* ptmp = reinterpret_cast<vecType<float, lowp>*>(&i);
-			tmp = *ptmp;
-			tmp = tmp * (1.5f - xhalf * tmp * tmp);
-			return tmp;
+			GLM_PROFILE_GENERIC("compute_inversesqrt");
+			return detail::functor1<T, T, P, vecType>::call(compute_inversesqrt_tier<T, precision_tier<P>::value>::call, x);
 		}
 	};
 }//namespace detail
@@ -69,7 +394,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> pow(vecType<T, P> const & base, vecType<T, P> const & exponent)
 	{
-		return detail::functor2<T, P, vecType>::call(pow, base, exponent);
+		return detail::compute_pow<vecType, T, P, detail::is_aligned<P>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -77,7 +402,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp, x);
+		return detail::compute_exp<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// log
@@ -85,7 +410,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> log(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(log, x);
+		return detail::compute_log<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	//exp2, ln2 = 0.69314718055994530941723212145818f
@@ -94,13 +419,13 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'exp2' only accept floating-point inputs");
 
-		return std::exp(static_cast<genType>(0.69314718055994530941723212145818) * x);
+		return detail::exp2(x);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp2(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp2, x);
+		return detail::compute_exp2<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
@@ -119,9 +444,13 @@ namespace detail
 	// sqrt
 	using std::sqrt;
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> sqrt(vecType<T, P> const & x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> sqrt(vecType<T, P> const & x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sqrt' only accept floating-point inputs");
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return detail::functor1<T, T, P, vecType>::call(detail::sqrt_constexpr, x);
+#		endif
 		return detail::compute_sqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
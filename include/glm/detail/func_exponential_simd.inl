@@ -8,11 +8,132 @@
 namespace glm{
 namespace detail
 {
+	template <precision P>
+	struct compute_pow<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & base, tvec4<float, P> const & exponent)
+		{
+			GLM_PROFILE_SIMD("compute_pow");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_pow(base.data, exponent.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_pow<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & base, tvec4<float, aligned_lowp> const & exponent)
+		{
+			GLM_PROFILE_SIMD("compute_pow");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_pow_lowp(base.data, exponent.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_exp");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_exp(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_exp");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_exp2_lowp(glm_vec4_mul(v.data, _mm_set1_ps(1.44269504088896341f)));
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_log<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_log");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_log(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_log");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_mul(glm_vec4_log2_lowp(v.data), _mm_set1_ps(0.693147180559945309f));
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp2<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_exp2");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_exp2(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_exp2<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_exp2");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_exp2_lowp(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_log2<float, P, tvec4, true, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_log2");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_log2(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_log2<float, aligned_lowp, tvec4, true, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_log2");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_log2_lowp(v.data);
+			return result;
+		}
+	};
+
 	template <precision P>
 	struct compute_sqrt<tvec4, float, P, true>
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_sqrt");
 			tvec4<float, P> result(uninitialize);
 			result.data = _mm_sqrt_ps(v.data);
 			return result;
@@ -24,11 +145,36 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_sqrt");
 			tvec4<float, aligned_lowp> result(uninitialize);
 			result.data = glm_vec4_sqrt_lowp(v.data);
 			return result;
 		}
 	};
+
+	template <precision P>
+	struct compute_inversesqrt<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_inversesqrt");
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_inversesqrt(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_inversesqrt<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_inversesqrt");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_inversesqrt_lowp(v.data);
+			return result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
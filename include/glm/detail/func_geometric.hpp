@@ -7,6 +7,9 @@
 /// @ingroup core
 /// 
 /// These operate on vectors as vectors, not component-wise.
+///
+/// Float vectors with mediump or lowp precision qualifiers normalize with the inversesqrt approximations of core_func_exponential,
+/// lowp length and distance use its sqrt approximation. Aligned highp normalize is exact.
 
 #pragma once
 
@@ -24,7 +27,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/length.xml">GLSL length man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL T length(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T length(
 		vecType<T, P> const & x);
 
 	/// Returns the distance betwwen p0 and p1, i.e., length(p0 - p1).
@@ -34,7 +37,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/distance.xml">GLSL distance man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL T distance(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T distance(
 		vecType<T, P> const & p0,
 		vecType<T, P> const & p1);
 
@@ -45,7 +48,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/dot.xml">GLSL dot man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL T dot(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T dot(
 		vecType<T, P> const & x,
 		vecType<T, P> const & y);
 
@@ -56,7 +59,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/cross.xml">GLSL cross man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> cross(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> cross(
 		tvec3<T, P> const & x,
 		tvec3<T, P> const & y);
 
@@ -66,7 +69,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/normalize.xml">GLSL normalize man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> normalize(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> normalize(
 		vecType<T, P> const & x);
 
 	/// If dot(Nref, I) < 0.0, return N, otherwise, return -N.
@@ -76,7 +79,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/faceforward.xml">GLSL faceforward man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> faceforward(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> faceforward(
 		vecType<T, P> const & N,
 		vecType<T, P> const & I,
 		vecType<T, P> const & Nref);
@@ -89,7 +92,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/reflect.xml">GLSL reflect man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename genType>
-	GLM_FUNC_DECL genType reflect(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 genType reflect(
 		genType const & I,
 		genType const & N);
 
@@ -102,7 +105,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/refract.xml">GLSL refract man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.5 Geometric Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> refract(
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> refract(
 		vecType<T, P> const & I,
 		vecType<T, P> const & N,
 		T eta);
@@ -13,17 +13,23 @@ namespace detail
 	template <template <typename, precision> class vecType, typename T, precision P, bool Aligned>
 	struct compute_length
 	{
-		GLM_FUNC_QUALIFIER static T call(vecType<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(vecType<T, P> const & v)
 		{
-			return sqrt(dot(v, v));
+			GLM_PROFILE_GENERIC("compute_length");
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return sqrt_constexpr(dot(v, v));
+#			endif
+			return compute_sqrt_tier<T, precision_tier<P>::value>::call(dot(v, v));
 		}
 	};
 
 	template <template <typename, precision> class vecType, typename T, precision P, bool Aligned>
 	struct compute_distance
 	{
-		GLM_FUNC_QUALIFIER static T call(vecType<T, P> const & p0, vecType<T, P> const & p1)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(vecType<T, P> const & p0, vecType<T, P> const & p1)
 		{
+			GLM_PROFILE_GENERIC("compute_distance");
 			return length(p1 - p0);
 		}
 	};
@@ -34,7 +40,7 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec1, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec1<T, P> const & a, tvec1<T, P> const & b)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tvec1<T, P> const & a, tvec1<T, P> const & b)
 		{
 			return a.x * b.x;
 		}
@@ -43,8 +49,9 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec2, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec2<T, P> const & x, tvec2<T, P> const & y)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tvec2<T, P> const & x, tvec2<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_dot");
 			tvec2<T, P> tmp(x * y);
 			return tmp.x + tmp.y;
 		}
@@ -53,8 +60,9 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec3, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tvec3<T, P> const & x, tvec3<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_dot");
 			tvec3<T, P> tmp(x * y);
 			return tmp.x + tmp.y + tmp.z;
 		}
@@ -63,8 +71,9 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_dot<tvec4, T, P, Aligned>
 	{
-		GLM_FUNC_QUALIFIER static T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tvec4<T, P> const & x, tvec4<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_dot");
 			tvec4<T, P> tmp(x * y);
 			return (tmp.x + tmp.y) + (tmp.z + tmp.w);
 		}
@@ -73,8 +82,9 @@ namespace detail
 	template <typename T, precision P, bool Aligned>
 	struct compute_cross
 	{
-		GLM_FUNC_QUALIFIER static tvec3<T, P> call(tvec3<T, P> const & x, tvec3<T, P> const & y)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tvec3<T, P> call(tvec3<T, P> const & x, tvec3<T, P> const & y)
 		{
+			GLM_PROFILE_GENERIC("compute_cross");
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cross' accepts only floating-point inputs");
 
 			return tvec3<T, P>(
@@ -87,19 +97,25 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
 	struct compute_normalize
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & v)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 vecType<T, P> call(vecType<T, P> const & v)
 		{
+			GLM_PROFILE_GENERIC("compute_normalize");
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
-			return v * inversesqrt(dot(v, v));
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return v * (static_cast<T>(1) / sqrt_constexpr(dot(v, v)));
+#			endif
+			return v * compute_inversesqrt_tier<T, precision_tier<P>::value>::call(dot(v, v));
 		}
 	};
 
 	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
 	struct compute_faceforward
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & N, vecType<T, P> const & I, vecType<T, P> const & Nref)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 vecType<T, P> call(vecType<T, P> const & N, vecType<T, P> const & I, vecType<T, P> const & Nref)
 		{
+			GLM_PROFILE_GENERIC("compute_faceforward");
 			GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
 			return dot(Nref, I) < static_cast<T>(0) ? N : -N;
@@ -109,8 +125,9 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
 	struct compute_reflect
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & I, vecType<T, P> const & N)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 vecType<T, P> call(vecType<T, P> const & I, vecType<T, P> const & N)
 		{
+			GLM_PROFILE_GENERIC("compute_reflect");
 			return I - N * dot(N, I) * static_cast<T>(2);
 		}
 	};
@@ -118,18 +135,19 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
 	struct compute_refract
 	{
-		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & I, vecType<T, P> const & N, T eta)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 vecType<T, P> call(vecType<T, P> const & I, vecType<T, P> const & N, T eta)
 		{
+			GLM_PROFILE_GENERIC("compute_refract");
 			T const dotValue(dot(N, I));
 			T const k(static_cast<T>(1) - eta * eta * (static_cast<T>(1) - dotValue * dotValue));
-			return (eta * I - (eta * dotValue + std::sqrt(k)) * N) * static_cast<T>(k >= static_cast<T>(0));
+			return (eta * I - (eta * dotValue + sqrt_constexpr(k)) * N) * static_cast<T>(k >= static_cast<T>(0));
 		}
 	};
 }//namespace detail
 
 	// length
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType length(genType x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType length(genType x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'length' accepts only floating-point inputs");
 
@@ -137,7 +155,7 @@ namespace detail
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER T length(vecType<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T length(vecType<T, P> const & v)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'length' accepts only floating-point inputs");
 
@@ -146,7 +164,7 @@ namespace detail
 
 	// distance
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType distance(genType const & p0, genType const & p1)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType distance(genType const & p0, genType const & p1)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'distance' accepts only floating-point inputs");
 
@@ -154,21 +172,21 @@ namespace detail
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER T distance(vecType<T, P> const & p0, vecType<T, P> const & p1)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T distance(vecType<T, P> const & p0, vecType<T, P> const & p1)
 	{
 		return detail::compute_distance<vecType, T, P, detail::is_aligned<P>::value>::call(p0, p1);
 	}
 
 	// dot
 	template <typename T>
-	GLM_FUNC_QUALIFIER T dot(T x, T y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T dot(T x, T y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' accepts only floating-point inputs");
 		return x * y;
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER T dot(vecType<T, P> const & x, vecType<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T dot(vecType<T, P> const & x, vecType<T, P> const & y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' accepts only floating-point inputs");
 		return detail::compute_dot<vecType, T, P, detail::is_aligned<P>::value>::call(x, y);
@@ -176,14 +194,14 @@ namespace detail
 
 	// cross
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> cross(tvec3<T, P> const & x, tvec3<T, P> const & y)
 	{
 		return detail::compute_cross<T, P, detail::is_aligned<P>::value>::call(x, y);
 	}
 
 	// normalize
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType normalize(genType const & x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType normalize(genType const & x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'normalize' accepts only floating-point inputs");
 
@@ -191,7 +209,7 @@ namespace detail
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> normalize(vecType<T, P> const & x)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> normalize(vecType<T, P> const & x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
@@ -200,42 +218,42 @@ namespace detail
 
 	// faceforward
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType faceforward(genType const & N, genType const & I, genType const & Nref)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType faceforward(genType const & N, genType const & I, genType const & Nref)
 	{
 		return dot(Nref, I) < static_cast<genType>(0) ? N : -N;
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> faceforward(vecType<T, P> const & N, vecType<T, P> const & I, vecType<T, P> const & Nref)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> faceforward(vecType<T, P> const & N, vecType<T, P> const & I, vecType<T, P> const & Nref)
 	{
 		return detail::compute_faceforward<T, P, vecType, detail::is_aligned<P>::value>::call(N, I, Nref);
 	}
 
 	// reflect
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType reflect(genType const & I, genType const & N)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType reflect(genType const & I, genType const & N)
 	{
 		return I - N * dot(N, I) * genType(2);
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> reflect(vecType<T, P> const & I, vecType<T, P> const & N)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> reflect(vecType<T, P> const & I, vecType<T, P> const & N)
 	{
 		return detail::compute_reflect<T, P, vecType, detail::is_aligned<P>::value>::call(I, N);
 	}
 
 	// refract
 	template <typename genType>
-	GLM_FUNC_QUALIFIER genType refract(genType const & I, genType const & N, genType eta)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType refract(genType const & I, genType const & N, genType eta)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'refract' accepts only floating-point inputs");
 		genType const dotValue(dot(N, I));
 		genType const k(static_cast<genType>(1) - eta * eta * (static_cast<genType>(1) - dotValue * dotValue));
-		return (eta * I - (eta * dotValue + sqrt(k)) * N) * static_cast<genType>(k >= static_cast<genType>(0));
+		return (eta * I - (eta * dotValue + detail::sqrt_constexpr(k)) * N) * static_cast<genType>(k >= static_cast<genType>(0));
 	}
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> refract(vecType<T, P> const & I, vecType<T, P> const & N, T eta)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> refract(vecType<T, P> const & I, vecType<T, P> const & N, T eta)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'refract' accepts only floating-point inputs");
 		return detail::compute_refract<T, P, vecType, detail::is_aligned<P>::value>::call(I, N, eta);
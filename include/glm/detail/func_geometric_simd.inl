@@ -13,24 +13,87 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_length");
 			return _mm_cvtss_f32(glm_vec4_length(v.data));
 		}
 	};
 
+	template <>
+	struct compute_length<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_length");
+			return compute_sqrt_tier<float, lowp>::call(_mm_cvtss_f32(glm_vec1_dot(v.data, v.data)));
+		}
+	};
+
 	template <precision P>
 	struct compute_distance<tvec4, float, P, true>
 	{
 		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const & p0, tvec4<float, P> const & p1)
 		{
+			GLM_PROFILE_SIMD("compute_distance");
 			return _mm_cvtss_f32(glm_vec4_distance(p0.data, p1.data));
 		}
 	};
 
+	template <>
+	struct compute_distance<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec4<float, aligned_lowp> const & p0, tvec4<float, aligned_lowp> const & p1)
+		{
+			GLM_PROFILE_SIMD("compute_distance");
+			return compute_length<tvec4, float, aligned_lowp, true>::call(p1 - p0);
+		}
+	};
+
+	template <precision P>
+	struct compute_length<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_length");
+			return _mm_cvtss_f32(_mm_sqrt_ss(glm_vec4_dot3(v.data, v.data)));
+		}
+	};
+
+	template <>
+	struct compute_length<tvec3, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_length");
+			return compute_sqrt_tier<float, lowp>::call(_mm_cvtss_f32(glm_vec4_dot3(v.data, v.data)));
+		}
+	};
+
+	template <precision P>
+	struct compute_distance<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const & p0, tvec3<float, P> const & p1)
+		{
+			GLM_PROFILE_SIMD("compute_distance");
+			return compute_length<tvec3, float, P, true>::call(p1 - p0);
+		}
+	};
+
+	template <precision P>
+	struct compute_dot<tvec3, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec3<float, P> const& x, tvec3<float, P> const& y)
+		{
+			GLM_PROFILE_SIMD("compute_dot");
+			return _mm_cvtss_f32(glm_vec4_dot3(x.data, y.data));
+		}
+	};
+
 	template <precision P>
 	struct compute_dot<tvec4, float, P, true>
 	{
 		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const& x, tvec4<float, P> const& y)
 		{
+			GLM_PROFILE_SIMD("compute_dot");
 			return _mm_cvtss_f32(glm_vec1_dot(x.data, y.data));
 		}
 	};
@@ -40,13 +103,10 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
 		{
-			__m128 const set0 = _mm_set_ps(0.0f, a.z, a.y, a.x);
-			__m128 const set1 = _mm_set_ps(0.0f, b.z, b.y, b.x);
-			__m128 const xpd0 = glm_vec4_cross(set0, set1);
-
-			tvec4<float, P> result(uninitialize);
-			result.data = xpd0;
-			return tvec3<float, P>(result);
+			GLM_PROFILE_SIMD("compute_cross");
+			tvec3<float, P> result(uninitialize);
+			result.data = glm_vec4_cross(a.data, b.data);
+			return result;
 		}
 	};
 
@@ -55,17 +115,55 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_normalize");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_normalize(v.data);
 			return result;
 		}
 	};
 
+	template <>
+	struct compute_normalize<float, aligned_lowp, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_normalize");
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_normalize_lowp(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_normalize<float, P, tvec3, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_normalize");
+			tvec3<float, P> result(uninitialize);
+			result.data = glm_vec4_normalize3(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_normalize<float, aligned_lowp, tvec3, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, aligned_lowp> call(tvec3<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_normalize");
+			tvec3<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_normalize3_lowp(v.data);
+			return result;
+		}
+	};
+
 	template <precision P>
 	struct compute_faceforward<float, P, tvec4, true>
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& N, tvec4<float, P> const& I, tvec4<float, P> const& Nref)
 		{
+			GLM_PROFILE_SIMD("compute_faceforward");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_faceforward(N.data. I.data, Nref.data);
 			return result;
@@ -77,6 +175,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& I, tvec4<float, P> const& N)
 		{
+			GLM_PROFILE_SIMD("compute_reflect");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_reflect(I.data, N.data);
 			return result;
@@ -88,11 +187,54 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& I, tvec4<float, P> const& N, float eta)
 		{
+			GLM_PROFILE_SIMD("compute_refract");
 			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_refract(I.data, N.data, _mm_set1_ps(eta));
 			return result;
 		}
 	};
+
+	template <precision P>
+	struct compute_length<tvec2, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec2<double, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_length");
+			return _mm_cvtsd_f64(glm_dvec2_length(v.data));
+		}
+	};
+
+	template <precision P>
+	struct compute_distance<tvec2, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec2<double, P> const & p0, tvec2<double, P> const & p1)
+		{
+			GLM_PROFILE_SIMD("compute_distance");
+			return _mm_cvtsd_f64(glm_dvec2_length(_mm_sub_pd(p1.data, p0.data)));
+		}
+	};
+
+	template <precision P>
+	struct compute_dot<tvec2, double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(tvec2<double, P> const& x, tvec2<double, P> const& y)
+		{
+			GLM_PROFILE_SIMD("compute_dot");
+			return _mm_cvtsd_f64(glm_dvec2_dot(x.data, y.data));
+		}
+	};
+
+	template <precision P>
+	struct compute_normalize<double, P, tvec2, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tvec2<double, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_normalize");
+			tvec2<double, P> result(uninitialize);
+			result.data = glm_dvec2_normalize(v.data);
+			return result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
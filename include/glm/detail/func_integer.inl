@@ -57,6 +57,58 @@ namespace detail
 		}
 	};
 
+	template <typename genIUType, size_t Bits>
+	struct compute_bitCount;
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_bitCount_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & v)
+		{
+			GLM_PROFILE_GENERIC("compute_bitCount_vec");
+#			if GLM_HAS_POPCNT
+				return detail::functor1<int, T, P, vecType>::call(compute_bitCount<T, sizeof(T) * 8>::call, v);
+#			else
+				vecType<typename make_unsigned<T>::type, P> x(*reinterpret_cast<vecType<typename make_unsigned<T>::type, P> const *>(&v));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>=  2>::call(x, typename make_unsigned<T>::type(0x5555555555555555ull), typename make_unsigned<T>::type( 1));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>=  4>::call(x, typename make_unsigned<T>::type(0x3333333333333333ull), typename make_unsigned<T>::type( 2));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>=  8>::call(x, typename make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename make_unsigned<T>::type( 4));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>= 16>::call(x, typename make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename make_unsigned<T>::type( 8));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>= 32>::call(x, typename make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename make_unsigned<T>::type(16));
+				x = compute_bitfieldBitCountStep<typename make_unsigned<T>::type, P, vecType, Aligned, sizeof(T) * 8>= 64>::call(x, typename make_unsigned<T>::type(0x00000000FFFFFFFFull), typename make_unsigned<T>::type(32));
+				return vecType<int, P>(x);
+#			endif
+		}
+	};
+
+	template <typename genIUType, size_t Bits>
+	struct compute_bitCount
+	{
+		GLM_FUNC_QUALIFIER static int call(genIUType Value)
+		{
+#			if GLM_HAS_POPCNT
+				return _mm_popcnt_u32(static_cast<uint32>(static_cast<typename make_unsigned<genIUType>::type>(Value)));
+#			else
+				return compute_bitCount_vec<genIUType, defaultp, tvec1, false>::call(tvec1<genIUType, defaultp>(Value)).x;
+#			endif
+		}
+	};
+
+#	if GLM_HAS_POPCNT
+		template <typename genIUType>
+		struct compute_bitCount<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+#				if GLM_MODEL == GLM_MODEL_64
+					return static_cast<int>(_mm_popcnt_u64(static_cast<uint64>(Value)));
+#				else
+					return _mm_popcnt_u32(static_cast<uint32>(static_cast<uint64>(Value))) + _mm_popcnt_u32(static_cast<uint32>(static_cast<uint64>(Value) >> 32));
+#				endif
+			}
+		};
+#	endif//GLM_HAS_POPCNT
+
 	template <typename genIUType, size_t Bits>
 	struct compute_findLSB
 	{
@@ -69,7 +121,27 @@ namespace detail
 		}
 	};
 
-#	if GLM_HAS_BITSCAN_WINDOWS
+#	if GLM_HAS_TZCNT
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 32>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : static_cast<int>(_tzcnt_u32(static_cast<uint32>(Value)));
+			}
+		};
+
+#		if GLM_MODEL == GLM_MODEL_64
+		template <typename genIUType>
+		struct compute_findLSB<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : static_cast<int>(_tzcnt_u64(static_cast<uint64>(Value)));
+			}
+		};
+#		endif
+#	elif GLM_HAS_BITSCAN_WINDOWS
 		template <typename genIUType>
 		struct compute_findLSB<genIUType, 32>
 		{
@@ -93,7 +165,17 @@ namespace detail
 			}
 		};
 #		endif
-#	endif//GLM_HAS_BITSCAN_WINDOWS
+#	endif//GLM_HAS_TZCNT
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_findLSB_vec
+	{
+		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_findLSB_vec");
+			return detail::functor1<int, T, P, vecType>::call(findLSB, x);
+		}
+	};
 
 	template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool EXEC = true>
 	struct compute_findMSB_step_vec
@@ -113,11 +195,12 @@ namespace detail
 		}
 	};
 
-	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, int>
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType, int, bool Aligned>
 	struct compute_findMSB_vec
 	{
 		GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & vec)
 		{
+			GLM_PROFILE_GENERIC("compute_findMSB_vec");
 			vecType<T, P> x(vec);
 			x = compute_findMSB_step_vec<T, P, vecType, sizeof(T) * 8 >=  8>::call(x, static_cast<T>( 1));
 			x = compute_findMSB_step_vec<T, P, vecType, sizeof(T) * 8 >=  8>::call(x, static_cast<T>( 2));
@@ -129,7 +212,41 @@ namespace detail
 		}
 	};
 
-#	if GLM_HAS_BITSCAN_WINDOWS
+#	if GLM_HAS_LZCNT
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_32(genIUType Value)
+		{
+			return 31 - static_cast<int>(_lzcnt_u32(static_cast<uint32>(Value)));
+		}
+
+		template <typename T, glm::precision P, template<typename, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 32, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				GLM_PROFILE_GENERIC("compute_findMSB_vec");
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_32, x);
+			}
+		};
+
+#		if GLM_MODEL == GLM_MODEL_64
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_64(genIUType Value)
+		{
+			return 63 - static_cast<int>(_lzcnt_u64(static_cast<uint64>(Value)));
+		}
+
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 64, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
+			{
+				GLM_PROFILE_GENERIC("compute_findMSB_vec");
+				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_64, x);
+			}
+		};
+#		endif
+#	elif GLM_HAS_BITSCAN_WINDOWS
 		template <typename genIUType>
 		GLM_FUNC_QUALIFIER int compute_findMSB_32(genIUType Value)
 		{
@@ -138,11 +255,12 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template <typename T, glm::precision P, template<typename, glm::precision> class vecType>
-		struct compute_findMSB_vec<T, P, vecType, 32>
+		template <typename T, glm::precision P, template<typename, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 32, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
 			{
+				GLM_PROFILE_GENERIC("compute_findMSB_vec");
 				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_32, x);
 			}
 		};
@@ -156,16 +274,64 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template <typename T, glm::precision P, template <class, glm::precision> class vecType>
-		struct compute_findMSB_vec<T, P, vecType, 64>
+		template <typename T, glm::precision P, template <class, glm::precision> class vecType, bool Aligned>
+		struct compute_findMSB_vec<T, P, vecType, 64, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vecType<int, P> call(vecType<T, P> const & x)
 			{
+				GLM_PROFILE_GENERIC("compute_findMSB_vec");
 				return detail::functor1<int, T, P, vecType>::call(compute_findMSB_64, x);
 			}
 		};
 #		endif
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_uaddCarry
+	{
+		GLM_FUNC_QUALIFIER static vecType<uint, P> call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Carry)
+		{
+			GLM_PROFILE_GENERIC("compute_uaddCarry");
+			vecType<uint, P> const Sum(x + y);
+			Carry = mix(vecType<uint, P>(0), vecType<uint, P>(1), lessThan(Sum, x));
+			return Sum;
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_usubBorrow
+	{
+		GLM_FUNC_QUALIFIER static vecType<uint, P> call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Borrow)
+		{
+			GLM_PROFILE_GENERIC("compute_usubBorrow");
+			Borrow = mix(vecType<uint, P>(0), vecType<uint, P>(1), lessThan(x, y));
+			return x - y;
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_umulExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & msb, vecType<uint, P> & lsb)
+		{
+			GLM_PROFILE_GENERIC("compute_umulExtended");
+			vecType<uint64, P> Value64(vecType<uint64, P>(x) * vecType<uint64, P>(y));
+			msb = vecType<uint32, P>(Value64 >> static_cast<uint64>(32));
+			lsb = vecType<uint32, P>(Value64);
+		}
+	};
+
+	template <glm::precision P, template <typename, glm::precision> class vecType, bool Aligned>
+	struct compute_imulExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<int, P> const & x, vecType<int, P> const & y, vecType<int, P> & msb, vecType<int, P> & lsb)
+		{
+			GLM_PROFILE_GENERIC("compute_imulExtended");
+			vecType<int64, P> Value64(vecType<int64, P>(x) * vecType<int64, P>(y));
+			lsb = vecType<int32, P>(Value64 & static_cast<int64>(0xFFFFFFFF));
+			msb = vecType<int32, P>((Value64 >> static_cast<int64>(32)) & static_cast<int64>(0xFFFFFFFF));
+		}
+	};
 }//namespace detail
 
 	// uaddCarry
@@ -180,10 +346,7 @@ namespace detail
 	template <precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<uint, P> uaddCarry(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Carry)
 	{
-		vecType<uint64, P> Value64(vecType<uint64, P>(x) + vecType<uint64, P>(y));
-		vecType<uint64, P> Max32((static_cast<uint64>(1) << static_cast<uint64>(32)) - static_cast<uint64>(1));
-		Carry = mix(vecType<uint32, P>(0), vecType<uint32, P>(1), greaterThan(Value64, Max32));
-		return vecType<uint32,P>(Value64 % (Max32 + static_cast<uint64>(1)));
+		return detail::compute_uaddCarry<P, vecType, detail::is_aligned<P>::value>::call(x, y, Carry);
 	}
 
 	// usubBorrow
@@ -192,19 +355,13 @@ namespace detail
 		GLM_STATIC_ASSERT(sizeof(uint) == sizeof(uint32), "uint and uint32 size mismatch");
 
 		Borrow = x >= y ? static_cast<uint32>(0) : static_cast<uint32>(1);
-		if(y >= x)
-			return y - x;
-		else
-			return static_cast<uint32>((static_cast<int64>(1) << static_cast<int64>(32)) + (static_cast<int64>(y) - static_cast<int64>(x)));
+		return x - y;
 	}
 
 	template <precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<uint, P> usubBorrow(vecType<uint, P> const & x, vecType<uint, P> const & y, vecType<uint, P> & Borrow)
 	{
-		Borrow = mix(vecType<uint, P>(1), vecType<uint, P>(0), greaterThanEqual(x, y));
-		vecType<uint, P> const YgeX(y - x);
-		vecType<uint, P> const XgeY(vecType<uint32, P>((static_cast<int64>(1) << static_cast<int64>(32)) + (vecType<int64, P>(y) - vecType<int64, P>(x))));
-		return mix(XgeY, YgeX, greaterThanEqual(y, x));
+		return detail::compute_usubBorrow<P, vecType, detail::is_aligned<P>::value>::call(x, y, Borrow);
 	}
 
 	// umulExtended
@@ -222,9 +379,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(sizeof(uint) == sizeof(uint32), "uint and uint32 size mismatch");
 
-		vecType<uint64, P> Value64(vecType<uint64, P>(x) * vecType<uint64, P>(y));
-		msb = vecType<uint32, P>(Value64 >> static_cast<uint64>(32));
-		lsb = vecType<uint32, P>(Value64);
+		detail::compute_umulExtended<P, vecType, detail::is_aligned<P>::value>::call(x, y, msb, lsb);
 	}
 
 	// imulExtended
@@ -242,9 +397,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(sizeof(int) == sizeof(int32), "int and int32 size mismatch");
 
-		vecType<int64, P> Value64(vecType<int64, P>(x) * vecType<int64, P>(y));
-		lsb = vecType<int32, P>(Value64 & static_cast<int64>(0xFFFFFFFF));
-		msb = vecType<int32, P>((Value64 >> static_cast<int64>(32)) & static_cast<int64>(0xFFFFFFFF));
+		detail::compute_imulExtended<P, vecType, detail::is_aligned<P>::value>::call(x, y, msb, lsb);
 	}
 
 	// bitfieldExtract
@@ -302,20 +455,13 @@ namespace detail
 	template <typename genType>
 	GLM_FUNC_QUALIFIER int bitCount(genType x)
 	{
-		return bitCount(glm::tvec1<genType, glm::defaultp>(x)).x;
+		return detail::compute_bitCount<genType, sizeof(genType) * 8>::call(x);
 	}
 
 	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<int, P> bitCount(vecType<T, P> const & v)
 	{
-		vecType<typename detail::make_unsigned<T>::type, P> x(*reinterpret_cast<vecType<typename detail::make_unsigned<T>::type, P> const *>(&v));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  2>::call(x, typename detail::make_unsigned<T>::type(0x5555555555555555ull), typename detail::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  4>::call(x, typename detail::make_unsigned<T>::type(0x3333333333333333ull), typename detail::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>=  8>::call(x, typename detail::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename detail::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 16>::call(x, typename detail::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename detail::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 32>::call(x, typename detail::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename detail::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<typename detail::make_unsigned<T>::type, P, vecType, detail::is_aligned<P>::value, sizeof(T) * 8>= 64>::call(x, typename detail::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename detail::make_unsigned<T>::type(32));
-		return vecType<int, P>(x);
+		return detail::compute_bitCount_vec<T, P, vecType, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// findLSB
@@ -332,7 +478,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<int, T, P, vecType>::call(findLSB, x);
+		return detail::compute_findLSB_vec<T, P, vecType, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// findMSB
@@ -349,7 +495,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer, "'findMSB' only accept integer values");
 
-		return detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8>::call(x);
+		return detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8, detail::is_aligned<P>::value>::call(x);
 	}
 }//namespace glm
 
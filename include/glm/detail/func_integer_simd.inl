@@ -14,53 +14,137 @@ namespace detail
 		GLM_FUNC_QUALIFIER static tvec4<uint32, P> call(tvec4<uint32, P> const & v, uint32 Mask, uint32 Shift)
 		{
 			__m128i const set0 = v.data;
+			__m128i const cnt0 = _mm_cvtsi32_si128(static_cast<int>(Shift));
 
-			__m128i const set1 = _mm_set1_epi32(Mask);
+			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
 			__m128i const and1 = _mm_and_si128(set0, set1);
-			__m128i const sft1 = _mm_slli_epi32(and1, Shift);
-
-			__m128i const set2 = _mm_andnot_si128(set0, _mm_set1_epi32(-1));
-			__m128i const and2 = _mm_and_si128(set0, set2);
-			__m128i const sft2 = _mm_srai_epi32(and2, Shift);
-		
-			__m128i const or0 = _mm_or_si128(sft1, sft2);
-		
-			return or0;
+			__m128i const sft1 = _mm_sll_epi32(and1, cnt0);
+
+			__m128i const and2 = _mm_andnot_si128(set1, set0);
+			__m128i const sft2 = _mm_srl_epi32(and2, cnt0);
+
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = _mm_or_si128(sft1, sft2);
+			return Result;
 		}
 	};
 
 	template <glm::precision P>
-	struct compute_bitfieldBitCountStep<uint32, P, tvec4, true, true>
+	struct compute_bitCount_vec<int32, P, tvec4, true>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<uint32, P> call(tvec4<uint32, P> const & v, uint32 Mask, uint32 Shift)
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int32, P> const & v)
 		{
-			__m128i const set0 = v.data;
+			GLM_PROFILE_SIMD("compute_bitCount_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_bit_count(v.data);
+			return Result;
+		}
+	};
 
-			__m128i const set1 = _mm_set1_epi32(Mask);
-			__m128i const and0 = _mm_and_si128(set0, set1);
-			__m128i const sft0 = _mm_slli_epi32(set0, Shift);
-			__m128i const and1 = _mm_and_si128(sft0, set1);
-			__m128i const add0 = _mm_add_epi32(and0, and1);
-		
-			return add0;
+	template <glm::precision P>
+	struct compute_bitCount_vec<uint32, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint32, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_bitCount_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_bit_count(v.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findLSB_vec<int32, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int32, P> const & x)
+		{
+			GLM_PROFILE_SIMD("compute_findLSB_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_find_lsb(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findLSB_vec<uint32, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint32, P> const & x)
+		{
+			GLM_PROFILE_SIMD("compute_findLSB_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_find_lsb(x.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_findMSB_vec<int32, P, tvec4, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<int32, P> const & x)
+		{
+			GLM_PROFILE_SIMD("compute_findMSB_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_find_msb(x.data);
+			return Result;
 		}
 	};
-}//namespace detail
 
-#	if GLM_ARCH & GLM_ARCH_AVX_BIT
-	template <>
-	GLM_FUNC_QUALIFIER int bitCount(uint32 x)
+	template <glm::precision P>
+	struct compute_findMSB_vec<uint32, P, tvec4, 32, true>
 	{
-		return _mm_popcnt_u32(x);
-	}
+		GLM_FUNC_QUALIFIER static tvec4<int, P> call(tvec4<uint32, P> const & x)
+		{
+			GLM_PROFILE_SIMD("compute_findMSB_vec");
+			tvec4<int, P> Result(uninitialize);
+			Result.data = glm_uvec4_find_msb(x.data);
+			return Result;
+		}
+	};
 
-	template <>
-	GLM_FUNC_QUALIFIER int bitCount(uint64 x)
+	template <glm::precision P>
+	struct compute_uaddCarry<P, tvec4, true>
 	{
-		return static_cast<int>(_mm_popcnt_u64(x));
-	}
-#	endif
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & Carry)
+		{
+			GLM_PROFILE_SIMD("compute_uaddCarry");
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = glm_uvec4_add_carry(x.data, y.data, &Carry.data);
+			return Result;
+		}
+	};
 
+	template <glm::precision P>
+	struct compute_usubBorrow<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint, P> call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & Borrow)
+		{
+			GLM_PROFILE_SIMD("compute_usubBorrow");
+			tvec4<uint, P> Result(uninitialize);
+			Result.data = glm_uvec4_sub_borrow(x.data, y.data, &Borrow.data);
+			return Result;
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_umulExtended<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<uint, P> const & x, tvec4<uint, P> const & y, tvec4<uint, P> & msb, tvec4<uint, P> & lsb)
+		{
+			GLM_PROFILE_SIMD("compute_umulExtended");
+			glm_uvec4_mul_extended(x.data, y.data, &msb.data, &lsb.data);
+		}
+	};
+
+	template <glm::precision P>
+	struct compute_imulExtended<P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<int, P> const & x, tvec4<int, P> const & y, tvec4<int, P> & msb, tvec4<int, P> & lsb)
+		{
+			GLM_PROFILE_SIMD("compute_imulExtended");
+			glm_ivec4_mul_extended(x.data, y.data, &msb.data, &lsb.data);
+		}
+	};
+}//namespace detail
 }//namespace glm
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -10,8 +10,9 @@ namespace detail
 	template <template <typename, precision> class matType, typename T, precision P>
 	struct compute_matrixCompMult
 	{
-		GLM_FUNC_QUALIFIER static matType<T, P> call(matType<T, P> const& x, matType<T, P> const& y)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 matType<T, P> call(matType<T, P> const& x, matType<T, P> const& y)
 		{
+			GLM_PROFILE_GENERIC("compute_matrixCompMult");
 			matType<T, P> result(uninitialize);
 			for(length_t i = 0; i < result.length(); ++i)
 				result[i] = x[i] * y[i];
@@ -25,8 +26,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat2x2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat2x2<T, P> call(tmat2x2<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat2x2<T, P> call(tmat2x2<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat2x2<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -39,8 +41,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat2x3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat3x2<T, P> call(tmat2x3<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat3x2<T, P> call(tmat2x3<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat3x2<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -55,8 +58,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat2x4, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat4x2<T, P> call(tmat2x4<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x2<T, P> call(tmat2x4<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat4x2<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -73,8 +77,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat3x2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat2x3<T, P> call(tmat3x2<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat2x3<T, P> call(tmat3x2<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat2x3<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -89,8 +94,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat3x3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tmat3x3<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat3x3<T, P> call(tmat3x3<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat3x3<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -110,8 +116,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat3x4, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat4x3<T, P> call(tmat3x4<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x3<T, P> call(tmat3x4<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat4x3<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -132,8 +139,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat4x2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat2x4<T, P> call(tmat4x2<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat2x4<T, P> call(tmat4x2<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat2x4<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -150,8 +158,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_transpose<tmat4x3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat3x4<T, P> call(tmat4x3<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat3x4<T, P> call(tmat4x3<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat3x4<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -169,11 +178,13 @@ namespace detail
 		}
 	};
 
+	// Generic 4x4 transpose, also evaluated by the SIMD specialization in constant expressions
 	template <typename T, precision P>
-	struct compute_transpose<tmat4x4, T, P>
+	struct compute_transpose4x4
 	{
-		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x4<T, P> call(tmat4x4<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_transpose");
 			tmat4x4<T, P> result(uninitialize);
 			result[0][0] = m[0][0];
 			result[0][1] = m[1][0];
@@ -198,14 +209,19 @@ namespace detail
 		}
 	};
 
+	template <typename T, precision P>
+	struct compute_transpose<tmat4x4, T, P> : public compute_transpose4x4<T, P>
+	{};
+
 	template <template <typename, precision> class matType, typename T, precision P>
 	struct compute_determinant{};
 
 	template <typename T, precision P>
 	struct compute_determinant<tmat2x2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tmat2x2<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tmat2x2<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_determinant");
 			return m[0][0] * m[1][1] - m[1][0] * m[0][1];
 		}
 	};
@@ -213,8 +229,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_determinant<tmat3x3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static T call(tmat3x3<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tmat3x3<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_determinant");
 			return
 				+ m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
 				- m[1][0] * (m[0][1] * m[2][2] - m[2][1] * m[0][2])
@@ -222,11 +239,13 @@ namespace detail
 		}
 	};
 
+	// Generic 4x4 determinant, also evaluated by the SIMD specialization in constant expressions
 	template <typename T, precision P>
-	struct compute_determinant<tmat4x4, T, P>
+	struct compute_determinant4x4
 	{
-		GLM_FUNC_QUALIFIER static T call(tmat4x4<T, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 T call(tmat4x4<T, P> const & m)
 		{
+			GLM_PROFILE_GENERIC("compute_determinant");
 			T SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 			T SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
 			T SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
@@ -246,14 +265,19 @@ namespace detail
 		}
 	};
 
+	template <typename T, precision P>
+	struct compute_determinant<tmat4x4, T, P> : public compute_determinant4x4<T, P>
+	{};
+
 	template <template <typename, precision> class matType, typename T, precision P>
 	struct compute_inverse{};
 
 	template <typename T, precision P>
 	struct compute_inverse<tmat2x2, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat2x2<T, P> call(tmat2x2<T, P> const& m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat2x2<T, P> call(tmat2x2<T, P> const& m)
 		{
+			GLM_PROFILE_GENERIC("compute_inverse");
 			T OneOverDeterminant = static_cast<T>(1) / (
 				+ m[0][0] * m[1][1]
 				- m[1][0] * m[0][1]);
@@ -271,8 +295,9 @@ namespace detail
 	template <typename T, precision P>
 	struct compute_inverse<tmat3x3, T, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat3x3<T, P> call(tmat3x3<T, P> const& m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat3x3<T, P> call(tmat3x3<T, P> const& m)
 		{
+			GLM_PROFILE_GENERIC("compute_inverse");
 			T OneOverDeterminant = static_cast<T>(1) / (
 				+ m[0][0] * (m[1][1] * m[2][2] - m[2][1] * m[1][2])
 				- m[1][0] * (m[0][1] * m[2][2] - m[2][1] * m[0][2])
@@ -293,11 +318,13 @@ namespace detail
 		}
 	};
 
+	// Generic 4x4 inverse, also evaluated by the SIMD specialization in constant expressions
 	template <typename T, precision P>
-	struct compute_inverse<tmat4x4, T, P>
+	struct compute_inverse4x4
 	{
-		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const& m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x4<T, P> call(tmat4x4<T, P> const& m)
 		{
+			GLM_PROFILE_GENERIC("compute_inverse");
 			T Coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 			T Coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
 			T Coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
@@ -353,17 +380,21 @@ namespace detail
 			return Inverse * OneOverDeterminant;
 		}
 	};
+
+	template <typename T, precision P>
+	struct compute_inverse<tmat4x4, T, P> : public compute_inverse4x4<T, P>
+	{};
 }//namespace detail
 
 	template <typename T, precision P, template <typename, precision> class matType>
-	GLM_FUNC_QUALIFIER matType<T, P> matrixCompMult(matType<T, P> const & x, matType<T, P> const & y)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 matType<T, P> matrixCompMult(matType<T, P> const & x, matType<T, P> const & y)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'matrixCompMult' only accept floating-point inputs");
 		return detail::compute_matrixCompMult<matType, T, P>::call(x, y);
 	}
 
 	template<typename T, precision P, template <typename, precision> class vecTypeA, template <typename, precision> class vecTypeB>
-	GLM_FUNC_QUALIFIER typename detail::outerProduct_trait<T, P, vecTypeA, vecTypeB>::type outerProduct(vecTypeA<T, P> const & c, vecTypeB<T, P> const & r)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 typename detail::outerProduct_trait<T, P, vecTypeA, vecTypeB>::type outerProduct(vecTypeA<T, P> const & c, vecTypeB<T, P> const & r)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'outerProduct' only accept floating-point inputs");
 
@@ -374,21 +405,21 @@ namespace detail
 	}
 
 	template <typename T, precision P, template <typename, precision> class matType>
-	GLM_FUNC_QUALIFIER typename matType<T, P>::transpose_type transpose(matType<T, P> const & m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 typename matType<T, P>::transpose_type transpose(matType<T, P> const & m)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transpose' only accept floating-point inputs");
 		return detail::compute_transpose<matType, T, P>::call(m);
 	}
 
 	template <typename T, precision P, template <typename, precision> class matType>
-	GLM_FUNC_QUALIFIER T determinant(matType<T, P> const & m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 T determinant(matType<T, P> const & m)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'determinant' only accept floating-point inputs");
 		return detail::compute_determinant<matType, T, P>::call(m);
 	}
 
 	template <typename T, precision P, template <typename, precision> class matType>
-	GLM_FUNC_QUALIFIER matType<T, P> inverse(matType<T, P> const & m)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 matType<T, P> inverse(matType<T, P> const & m)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'inverse' only accept floating-point inputs");
 		return detail::compute_inverse<matType, T, P>::call(m);
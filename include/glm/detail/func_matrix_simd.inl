@@ -3,6 +3,7 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#include "type_mat2x2.hpp"
 #include "type_mat4x4.hpp"
 #include "func_geometric.hpp"
 #include "../simd/matrix.h"
@@ -15,6 +16,7 @@ namespace detail
 	{
 		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & x, tmat4x4<float, P> const & y)
 		{
+			GLM_PROFILE_SIMD("compute_matrixCompMult");
 			tmat4x4<float, P> result(uninitialize);
 			glm_mat4_matrixCompMult(
 				*(glm_vec4 const (*)[4])&x[0].data,
@@ -27,8 +29,13 @@ namespace detail
 	template <precision P>
 	struct compute_transpose<tmat4x4, float, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x4<float, P> call(tmat4x4<float, P> const & m)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_transpose4x4<float, P>::call(m);
+#			endif
+			GLM_PROFILE_SIMD("compute_transpose");
 			tmat4x4<float, P> result(uninitialize);
 			glm_mat4_transpose(
 				*(glm_vec4 const (*)[4])&m[0].data,
@@ -40,8 +47,13 @@ namespace detail
 	template <precision P>
 	struct compute_determinant<tmat4x4, float, P>
 	{
-		GLM_FUNC_QUALIFIER static float call(tmat4x4<float, P> const& m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 float call(tmat4x4<float, P> const& m)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_determinant4x4<float, P>::call(m);
+#			endif
+			GLM_PROFILE_SIMD("compute_determinant");
 			return _mm_cvtss_f32(glm_mat4_determinant(*reinterpret_cast<__m128 const(*)[4]>(&m[0].data)));
 		}
 	};
@@ -49,13 +61,54 @@ namespace detail
 	template <precision P>
 	struct compute_inverse<tmat4x4, float, P>
 	{
-		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const& m)
+		GLM_FUNC_QUALIFIER static GLM_CONSTEXPR_CXX14 tmat4x4<float, P> call(tmat4x4<float, P> const& m)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_inverse4x4<float, P>::call(m);
+#			endif
+			GLM_PROFILE_SIMD("compute_inverse");
 			tmat4x4<float, P> Result(uninitialize);
 			glm_mat4_inverse(*reinterpret_cast<__m128 const(*)[4]>(&m[0].data), *reinterpret_cast<__m128(*)[4]>(&Result[0].data));
 			return Result;
 		}
 	};
+
+	template <>
+	struct compute_inverse<tmat2x2, double, aligned_lowp>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<double, aligned_lowp> call(tmat2x2<double, aligned_lowp> const& m)
+		{
+			GLM_PROFILE_SIMD("compute_inverse");
+			tmat2x2<double, aligned_lowp> Result(uninitialize);
+			glm_dmat2_inverse(*reinterpret_cast<glm_dvec2 const(*)[2]>(&m[0].data), *reinterpret_cast<glm_dvec2(*)[2]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_inverse<tmat2x2, double, aligned_mediump>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<double, aligned_mediump> call(tmat2x2<double, aligned_mediump> const& m)
+		{
+			GLM_PROFILE_SIMD("compute_inverse");
+			tmat2x2<double, aligned_mediump> Result(uninitialize);
+			glm_dmat2_inverse(*reinterpret_cast<glm_dvec2 const(*)[2]>(&m[0].data), *reinterpret_cast<glm_dvec2(*)[2]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_inverse<tmat2x2, double, aligned_highp>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<double, aligned_highp> call(tmat2x2<double, aligned_highp> const& m)
+		{
+			GLM_PROFILE_SIMD("compute_inverse");
+			tmat2x2<double, aligned_highp> Result(uninitialize);
+			glm_dmat2_inverse(*reinterpret_cast<glm_dvec2 const(*)[2]>(&m[0].data), *reinterpret_cast<glm_dvec2(*)[2]>(&Result[0].data));
+			return Result;
+		}
+	};
 }//namespace detail
 
 	template<>
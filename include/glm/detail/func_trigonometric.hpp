@@ -11,6 +11,11 @@
 /// the divisor of a ratio is 0, then results will be undefined.
 /// 
 /// These all operate component-wise. The description is per component.
+///
+/// Float vectors with mediump or lowp precision qualifiers evaluate sin, cos and tan with faster approximations:
+/// - sin, cos: absolute error below 1e-5 (mediump) and 1e-3 (lowp) for |x| < 65536, larger arguments use the highp functions
+/// - sin: odd polynomial with a relative error below 2e-6 (mediump) and 2e-4 (lowp) for |x| <= pi/2, so that sin(x) ~ x near 0
+/// - tan: ratio of the sin and cos approximations
 
 #pragma once
 
@@ -48,7 +53,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/sin.xml">GLSL sin man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.1 Angle and Trigonometry Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> sin(vecType<T, P> const & angle);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> sin(vecType<T, P> const & angle);
 
 	/// The standard trigonometric cosine function. 
 	/// The values returned by this function will range from [-1, 1].
@@ -58,7 +63,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/cos.xml">GLSL cos man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.1 Angle and Trigonometry Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> cos(vecType<T, P> const & angle);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> cos(vecType<T, P> const & angle);
 
 	/// The standard trigonometric tangent function.
 	///
@@ -67,7 +72,7 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/tan.xml">GLSL tan man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.1 Angle and Trigonometry Functions</a>
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_DECL vecType<T, P> tan(vecType<T, P> const & angle); 
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 vecType<T, P> tan(vecType<T, P> const & angle); 
 
 	/// Arc sine. Returns an angle whose sine is x. 
 	/// The range of values returned by this function is [-PI/2, PI/2]. 
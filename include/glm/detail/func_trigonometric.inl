@@ -5,8 +5,269 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// -- Precision tiers --
+	// Component kernels selected by detail::precision_tier. highp kernels call the standard library,
+	// float mediump and lowp kernels evaluate approximations within the bounds documented in func_trigonometric.hpp.
+	// Other types use the highp kernels at every tier.
+
+	// Reduces x - Phase to [0, pi/2] by the periodicity and the symmetries of cos, for |x| < 65536. Returns the sign of cos(x - Phase).
+	// 2 * pi is split in a part exactly multiplied by the number of turns and a correction.
+	GLM_FUNC_QUALIFIER float cos_reduce(float x, float Phase, float & Angle)
+	{
+		float const Turns = static_cast<float>(static_cast<int>(x * 0.159154943091895335769f));
+		float const Wrap = ((x - Turns * 6.28125f) - Turns * 1.93530717958647692e-3f) - Phase;
+		float const Abs = Wrap < 0.0f ? -Wrap : Wrap;
+		float const Turn = Abs > 6.28318530717958647692f ? Abs - 6.28318530717958647692f : Abs;
+		float const Half = Turn > 3.14159265358979323846f ? 6.28318530717958647692f - Turn : Turn;
+		bool const Negate = Half > 1.57079632679489661923f;
+		Angle = Negate ? 3.14159265358979323846f - Half : Half;
+		return Negate ? -1.0f : 1.0f;
+	}
+
+	// cos(x - Phase) from a minimax polynomial on [0, pi/2] with 5.2 correct digits
+	GLM_FUNC_QUALIFIER float cos_mediump(float x, float Phase)
+	{
+		float Angle;
+		float const Sign = cos_reduce(x, Phase, Angle);
+		float const xx = Angle * Angle;
+		return Sign * (0.9999932946f + xx * (-0.4999124376f + xx * (0.0414877472f + xx * -0.0012712095f)));
+	}
+
+	// cos(x - Phase) from a minimax polynomial on [0, pi/2] with 3.2 correct digits
+	GLM_FUNC_QUALIFIER float cos_lowp(float x, float Phase)
+	{
+		float Angle;
+		float const Sign = cos_reduce(x, Phase, Angle);
+		float const xx = Angle * Angle;
+		return Sign * (0.99940307f + xx * (-0.49558072f + xx * 0.03679168f));
+	}
+
+	// Reduces x to [-pi/2, pi/2] by the periodicity and the symmetry of sin, for |x| < 65536. Returns the sign of sin(x).
+	// pi is split in a part exactly multiplied by the number of half turns and a correction.
+	GLM_FUNC_QUALIFIER float sin_reduce(float x, float & Angle)
+	{
+		float const HalfTurns = x * 0.318309886183790671538f;
+		int const n = static_cast<int>(HalfTurns < 0.0f ? HalfTurns - 0.5f : HalfTurns + 0.5f);
+		Angle = (x - static_cast<float>(n) * 3.140625f) - static_cast<float>(n) * 9.67653589793e-4f;
+		return n & 1 ? -1.0f : 1.0f;
+	}
+
+	// sin(x) from an odd minimax polynomial on [-pi/2, pi/2] with a relative error below 2e-6, so that sin(x) ~ x near 0
+	GLM_FUNC_QUALIFIER float sin_mediump(float x)
+	{
+		float Angle;
+		float const Sign = sin_reduce(x, Angle);
+		float const xx = Angle * Angle;
+		return Sign * Angle * (0.9999990609f + xx * (-0.1666555409f + xx * (0.0083118998f + xx * -0.0001848814f)));
+	}
+
+	// sin(x) from an odd minimax polynomial on [-pi/2, pi/2] with a relative error below 2e-4
+	GLM_FUNC_QUALIFIER float sin_lowp(float x)
+	{
+		float Angle;
+		float const Sign = sin_reduce(x, Angle);
+		float const xx = Angle * Angle;
+		return Sign * Angle * (0.9998918213f + xx * (-0.1659601165f + xx * 0.0076029033f));
+	}
+
+	template <typename T, precision Tier>
+	struct compute_cos_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::cos(x);
+		}
+	};
+
+	template <>
+	struct compute_cos_tier<float, mediump>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return x > -65536.0f && x < 65536.0f ? cos_mediump(x, 0.0f) : std::cos(x);
+		}
+	};
+
+	template <>
+	struct compute_cos_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return x > -65536.0f && x < 65536.0f ? cos_lowp(x, 0.0f) : std::cos(x);
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_sin_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::sin(x);
+		}
+	};
+
+	template <>
+	struct compute_sin_tier<float, mediump>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return x > -65536.0f && x < 65536.0f ? sin_mediump(x) : std::sin(x);
+		}
+	};
+
+	template <>
+	struct compute_sin_tier<float, lowp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return x > -65536.0f && x < 65536.0f ? sin_lowp(x) : std::sin(x);
+		}
+	};
+
+	template <typename T, precision Tier>
+	struct compute_tan_tier
+	{
+		GLM_FUNC_QUALIFIER static T call(T x)
+		{
+			return std::tan(x);
+		}
+	};
+
+	template <precision Tier>
+	struct compute_tan_tier<float, Tier>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return compute_sin_tier<float, Tier>::call(x) / compute_cos_tier<float, Tier>::call(x);
+		}
+	};
+
+	template <>
+	struct compute_tan_tier<float, highp>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			return std::tan(x);
+		}
+	};
+
+	// -- Constant evaluation --
+
+	// x = Quadrant * pi / 2 + r with r in [-pi / 4, pi / 4], pi / 2 is split in two doubles. Returns r.
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 double trig_reduce(double x, int & Quadrant)
+	{
+		double const Turns = x * 0.636619772367581343076;
+		int64 const n = static_cast<int64>(Turns < 0.0 ? Turns - 0.5 : Turns + 0.5);
+		Quadrant = static_cast<int>(n & 3);
+		return (x - static_cast<double>(n) * 1.57079632679489655800) - static_cast<double>(n) * 6.12323399573676603587e-17;
+	}
+
+	// Taylor series of sin and cos for |r| <= pi / 4, the last terms are below 1e-22
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 double sin_series(double r)
+	{
+		double Term = r;
+		double Sum = r;
+		for(int i = 2; i < 22; i += 2)
+		{
+			Term *= -(r * r) / static_cast<double>(i * (i + 1));
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 double cos_series(double r)
+	{
+		double Term = 1.0;
+		double Sum = 1.0;
+		for(int i = 1; i < 21; i += 2)
+		{
+			Term *= -(r * r) / static_cast<double>(i * (i + 1));
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	// trig_reduce and the series in constant expressions, the standard library at runtime
+	template <typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType sin_constexpr(genType x)
+	{
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+			{
+				int Quadrant = 0;
+				double const r = trig_reduce(static_cast<double>(x), Quadrant);
+				double const Result = Quadrant & 1 ? cos_series(r) : sin_series(r);
+				return static_cast<genType>(Quadrant & 2 ? -Result : Result);
+			}
+#		endif
+		return std::sin(x);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType cos_constexpr(genType x)
+	{
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+			{
+				int Quadrant = 0;
+				double const r = trig_reduce(static_cast<double>(x), Quadrant);
+				double const Result = Quadrant & 1 ? sin_series(r) : cos_series(r);
+				return static_cast<genType>((Quadrant + 1) & 2 ? -Result : Result);
+			}
+#		endif
+		return std::cos(x);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 genType tan_constexpr(genType x)
+	{
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+			{
+				int Quadrant = 0;
+				double const r = trig_reduce(static_cast<double>(x), Quadrant);
+				return static_cast<genType>(Quadrant & 1 ? -cos_series(r) / sin_series(r) : sin_series(r) / cos_series(r));
+			}
+#		endif
+		return std::tan(x);
+	}
+
+	// -- Vector functions --
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_sin");
+			return detail::functor1<T, T, P, vecType>::call(compute_sin_tier<T, precision_tier<P>::value>::call, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_cos");
+			return detail::functor1<T, T, P, vecType>::call(compute_cos_tier<T, precision_tier<P>::value>::call, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_tan
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			GLM_PROFILE_GENERIC("compute_tan");
+			return detail::functor1<T, T, P, vecType>::call(compute_tan_tier<T, precision_tier<P>::value>::call, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template <typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -41,27 +302,39 @@ namespace glm
 	using ::std::sin;
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> sin(vecType<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> sin(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(sin, v);
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return detail::functor1<T, T, P, vecType>::call(detail::sin_constexpr, v);
+#		endif
+		return detail::compute_sin<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// cos
 	using std::cos;
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> cos(vecType<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> cos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(cos, v);
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return detail::functor1<T, T, P, vecType>::call(detail::cos_constexpr, v);
+#		endif
+		return detail::compute_cos<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// tan
 	using std::tan;
 
 	template <typename T, precision P, template <typename, precision> class vecType>
-	GLM_FUNC_QUALIFIER vecType<T, P> tan(vecType<T, P> const & v)
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 vecType<T, P> tan(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(tan, v);
+#		if GLM_CONSTANT_EVALUATION
+			if(GLM_IS_CONSTANT_EVALUATED())
+				return detail::functor1<T, T, P, vecType>::call(detail::tan_constexpr, v);
+#		endif
+		return detail::compute_tan<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// asin
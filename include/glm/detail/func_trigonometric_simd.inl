@@ -0,0 +1,81 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Components outside of the range of the reduction use the per component kernels
+	GLM_FUNC_QUALIFIER bool cos_reduce_range(glm_vec4 x)
+	{
+		glm_vec4 const abs0 = glm_vec4_abs(x);
+		return _mm_movemask_ps(_mm_cmplt_ps(abs0, _mm_set1_ps(65536.0f))) == 0xF;
+	}
+
+	template <>
+	struct compute_sin<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_sin");
+			if(!cos_reduce_range(v.data))
+				return detail::functor1<float, float, aligned_mediump, tvec4>::call(compute_sin_tier<float, mediump>::call, v);
+
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_sin_mediump(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_cos<tvec4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_mediump> call(tvec4<float, aligned_mediump> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_cos");
+			if(!cos_reduce_range(v.data))
+				return detail::functor1<float, float, aligned_mediump, tvec4>::call(compute_cos_tier<float, mediump>::call, v);
+
+			tvec4<float, aligned_mediump> result(uninitialize);
+			result.data = glm_vec4_cos_mediump(v.data, _mm_setzero_ps());
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_sin<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_sin");
+			if(!cos_reduce_range(v.data))
+				return detail::functor1<float, float, aligned_lowp, tvec4>::call(compute_sin_tier<float, lowp>::call, v);
+
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_sin_lowp(v.data);
+			return result;
+		}
+	};
+
+	template <>
+	struct compute_cos<tvec4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_cos");
+			if(!cos_reduce_range(v.data))
+				return detail::functor1<float, float, aligned_lowp, tvec4>::call(compute_cos_tier<float, lowp>::call, v);
+
+			tvec4<float, aligned_lowp> result(uninitialize);
+			result.data = glm_vec4_cos_lowp(v.data, _mm_setzero_ps());
+			return result;
+		}
+	};
+
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
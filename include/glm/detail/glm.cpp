@@ -1,7 +1,12 @@
 /// @ref core
 /// @file glm/glm.cpp
 
+// Explicit instantiations of the glm_static library, the highp float, double and int ones being declared
+// extern in the translation units defining GLM_FORCE_EXTERN_TEMPLATES
+#define GLM_FORCE_EXTERN_TEMPLATES
+#define GLM_EXTERN_TEMPLATES_INSTANTIATE
 #include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/dual_quaternion.hpp>
 
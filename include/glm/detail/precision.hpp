@@ -7,16 +7,16 @@ namespace glm
 {
 	enum precision
 	{
-		highp,
-		mediump,
-		lowp,
-		packed_highp = highp,
-		packed_mediump = mediump,
-		packed_lowp = lowp,
-		packed = packed_highp,
+		packed_highp,
+		packed_mediump,
+		packed_lowp,
 		aligned_highp,
 		aligned_mediump,
 		aligned_lowp,
+		highp = packed_highp,
+		mediump = packed_mediump,
+		lowp = packed_lowp,
+		packed = packed_highp,
 		aligned = aligned_highp,
 #		ifdef GLM_FORCE_ALIGNED
 			defaultp = aligned_highp
@@ -50,5 +50,37 @@ namespace detail
 	{
 		static const bool value = true;
 	};
+
+	// Accuracy tier of a precision qualifier, regardless of alignment.
+	// highp functions are as accurate as the standard library, mediump and lowp functions may evaluate faster approximations.
+	template <precision P>
+	struct precision_tier
+	{
+		static const precision value = highp;
+	};
+
+	template<>
+	struct precision_tier<mediump>
+	{
+		static const precision value = mediump;
+	};
+
+	template<>
+	struct precision_tier<aligned_mediump>
+	{
+		static const precision value = mediump;
+	};
+
+	template<>
+	struct precision_tier<lowp>
+	{
+		static const precision value = lowp;
+	};
+
+	template<>
+	struct precision_tier<aligned_lowp>
+	{
+		static const precision value = lowp;
+	};
 }//namespace detail
 }//namespace glm
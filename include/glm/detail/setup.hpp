@@ -67,6 +67,8 @@
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
 #		pragma message("GLM: Platform independent code")
+#	elif(GLM_ARCH == GLM_ARCH_AVX512)
+#		pragma message("GLM: AVX-512 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX2)
 #		pragma message("GLM: AVX2 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX)
@@ -319,6 +321,26 @@
 #	define GLM_HAS_CONSTEXPR_PARTIAL (GLM_HAS_CONSTEXPR || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC2015)))
 #endif
 
+// N3652
+#if GLM_COMPILER & GLM_COMPILER_LLVM
+#	define GLM_HAS_RELAXED_CONSTEXPR __has_feature(cxx_relaxed_constexpr)
+#elif GLM_LANG & GLM_LANG_CXX14_FLAG
+#	define GLM_HAS_RELAXED_CONSTEXPR 1
+#else
+#	define GLM_HAS_RELAXED_CONSTEXPR 0
+#endif
+
+// P0595 std::is_constant_evaluated, GCC 9 provides the builtin without __has_builtin
+#if defined(__has_builtin)
+#	define GLM_HAS_CONSTANT_EVALUATED (GLM_HAS_RELAXED_CONSTEXPR && __has_builtin(__builtin_is_constant_evaluated))
+#elif (GLM_COMPILER & GLM_COMPILER_GCC) && defined(__GNUC__) && (__GNUC__ >= 9)
+#	define GLM_HAS_CONSTANT_EVALUATED GLM_HAS_RELAXED_CONSTEXPR
+#elif (GLM_COMPILER & GLM_COMPILER_VC) && (_MSC_VER >= 1925)
+#	define GLM_HAS_CONSTANT_EVALUATED GLM_HAS_RELAXED_CONSTEXPR
+#else
+#	define GLM_HAS_CONSTANT_EVALUATED 0
+#endif
+
 // N2672
 #if GLM_COMPILER & GLM_COMPILER_LLVM
 #	define GLM_HAS_INITIALIZER_LISTS __has_feature(cxx_generalized_initializers)
@@ -407,6 +429,16 @@
 		((GLM_COMPILER & GLM_COMPILER_CUDA) && (GLM_COMPILER >= GLM_COMPILER_CUDA50))))
 #endif
 
+// N1987 http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2006/n1987.htm
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	define GLM_HAS_EXTERN_TEMPLATES 1
+#else
+#	define GLM_HAS_EXTERN_TEMPLATES ((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (\
+		((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC43)) || \
+		((GLM_COMPILER & GLM_COMPILER_INTEL) && (GLM_COMPILER >= GLM_COMPILER_INTEL12)) || \
+		((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC2010))))
+#endif
+
 //
 #if GLM_LANG & GLM_LANG_CXX11_FLAG
 #	define GLM_HAS_ASSIGNABLE 1
@@ -506,10 +538,24 @@
 #	define GLM_VAR_USED
 #endif
 
-#if defined(GLM_FORCE_INLINE)
+// User defines: GLM_FORCE_DEBUG_FAST
+//
+// Speeds up unoptimized builds: implies GLM_FORCE_INLINE, flattens the functions with GCC and Clang and
+// writes the vector arithmetic operators component wise, without the copies and the dispatch to the SIMD implementations.
+
+#ifdef GLM_FORCE_DEBUG_FAST
+#	define GLM_DEBUG_FAST 1
+#else
+#	define GLM_DEBUG_FAST 0
+#endif
+
+#if defined(GLM_FORCE_INLINE) || GLM_DEBUG_FAST
 #	if GLM_COMPILER & GLM_COMPILER_VC
 #		define GLM_INLINE __forceinline
 #		define GLM_NEVER_INLINE __declspec((noinline))
+#	elif (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM)) && GLM_DEBUG_FAST
+#		define GLM_INLINE inline __attribute__((__always_inline__, __flatten__))
+#		define GLM_NEVER_INLINE __attribute__((__noinline__))
 #	elif GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM)
 #		define GLM_INLINE inline __attribute__((__always_inline__))
 #		define GLM_NEVER_INLINE __attribute__((__noinline__))
@@ -523,7 +569,7 @@
 #else
 #	define GLM_INLINE inline
 #	define GLM_NEVER_INLINE
-#endif//defined(GLM_FORCE_INLINE)
+#endif//defined(GLM_FORCE_INLINE) || GLM_DEBUG_FAST
 
 #define GLM_FUNC_DECL GLM_CUDA_FUNC_DECL
 #define GLM_FUNC_QUALIFIER GLM_CUDA_FUNC_DEF GLM_INLINE
@@ -642,7 +688,8 @@
 #	define GLM_RELAXED_CONSTEXPR const
 #endif
 
-#if GLM_ARCH == GLM_ARCH_PURE
+// With relaxed constexpr, only the explicit specializations of the SIMD constructors are not constexpr, unless GLM_CONSTANT_EVALUATION
+#if GLM_ARCH == GLM_ARCH_PURE || GLM_HAS_RELAXED_CONSTEXPR
 #	define GLM_CONSTEXPR_SIMD GLM_CONSTEXPR
 #else
 #	define GLM_CONSTEXPR_SIMD
@@ -654,6 +701,101 @@
 #	define GLM_EXPLICIT
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Extern templates
+
+// User defines: GLM_FORCE_EXTERN_TEMPLATES
+//
+// Declares the common instantiations compiled in the glm_static library as extern templates so that
+// translation units link them instead of instantiating them again. glm_static must be built with the
+// same configuration defines as the translation units using it.
+
+#if defined(GLM_FORCE_EXTERN_TEMPLATES) && GLM_HAS_EXTERN_TEMPLATES
+#	define GLM_EXTERN_TEMPLATES 1
+#else
+#	define GLM_EXTERN_TEMPLATES 0
+#endif
+
+// glm.cpp defines GLM_EXTERN_TEMPLATES_INSTANTIATE to turn the extern declarations into the definitions of glm_static
+#ifdef GLM_EXTERN_TEMPLATES_INSTANTIATE
+#	define GLM_EXTERN_TEMPLATE template
+#else
+#	define GLM_EXTERN_TEMPLATE extern template
+#endif
+
+#if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_EXTERN_TEMPLATES_DISPLAYED)
+#	define GLM_MESSAGE_EXTERN_TEMPLATES_DISPLAYED
+#	if GLM_EXTERN_TEMPLATES
+#		pragma message("GLM: Common instantiations are declared extern, link with glm_static")
+#	elif defined(GLM_FORCE_EXTERN_TEMPLATES)
+#		pragma message("GLM: GLM_FORCE_EXTERN_TEMPLATES ignored, extern templates are not supported by the compiler")
+#	endif
+#endif//GLM_MESSAGES
+
+///////////////////////////////////////////////////////////////////////////////////
+// Profiling
+
+// User defines: GLM_ENABLE_PROFILING
+//
+// Counts the calls of the generic and SIMD implementations of the vector and matrix functions,
+// GLM_GTX_profiling reads and dumps the counters. CUDA device code can't hold the counters.
+
+#if defined(GLM_ENABLE_PROFILING) && !(GLM_COMPILER & GLM_COMPILER_CUDA)
+#	define GLM_PROFILING 1
+#else
+#	define GLM_PROFILING 0
+#endif
+
+#if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_PROFILING_DISPLAYED)
+#	define GLM_MESSAGE_PROFILING_DISPLAYED
+#	if GLM_PROFILING
+#		pragma message("GLM: Profiling counters enabled")
+#	elif defined(GLM_ENABLE_PROFILING)
+#		pragma message("GLM: GLM_ENABLE_PROFILING ignored, profiling is not supported by CUDA")
+#	endif
+#endif//GLM_MESSAGES
+
+///////////////////////////////////////////////////////////////////////////////////
+// Relaxed constexpr
+
+// The operators of the vector and matrix types, the geometric functions, GLM_GTC_matrix_transform and
+// GLM_GTC_quaternion are GLM_CONSTEXPR_CXX14 functions, usable in constant expressions with C++14.
+// Constant evaluation uses the generic code paths, the SIMD code paths are only taken at runtime.
+// sqrt, sin, cos and tan are evaluated in constant expressions when GLM_HAS_CONSTANT_EVALUATED.
+// The counters of GLM_ENABLE_PROFILING are static variables which are not allowed in constexpr functions.
+
+#if GLM_HAS_RELAXED_CONSTEXPR && !GLM_PROFILING
+#	define GLM_CONSTEXPR_CXX14 constexpr
+#else
+#	define GLM_CONSTEXPR_CXX14
+#endif
+
+#if GLM_HAS_CONSTANT_EVALUATED && !GLM_PROFILING
+#	define GLM_CONSTANT_EVALUATION 1
+#	define GLM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#	define GLM_CONSTANT_EVALUATION 0
+#	define GLM_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Explicit specializations are not templates, a constexpr one has to be usable in constant expressions through the generic code path
+#if GLM_CONSTANT_EVALUATION
+#	define GLM_CONSTEXPR_SPECIALIZATION constexpr
+#else
+#	define GLM_CONSTEXPR_SPECIALIZATION
+#endif
+
+#if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_RELAXED_CONSTEXPR_DISPLAYED)
+#	define GLM_MESSAGE_RELAXED_CONSTEXPR_DISPLAYED
+#	if GLM_HAS_RELAXED_CONSTEXPR && GLM_PROFILING
+#		pragma message("GLM: Relaxed constexpr functions disabled by GLM_ENABLE_PROFILING")
+#	elif GLM_CONSTANT_EVALUATION
+#		pragma message("GLM: Relaxed constexpr functions with constant evaluation of sqrt, sin, cos and tan")
+#	elif GLM_HAS_RELAXED_CONSTEXPR
+#		pragma message("GLM: Relaxed constexpr functions")
+#	endif
+#endif//GLM_MESSAGES
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Length type
 
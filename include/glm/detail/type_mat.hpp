@@ -26,7 +26,7 @@ namespace detail
 	template <typename T, precision P> struct tmat4x4;
 
 	template <typename T, precision P, template <typename, precision> class matType>
-	GLM_FUNC_DECL matType<T, P> inverse(matType<T, P> const & m);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 matType<T, P> inverse(matType<T, P> const & m);
 
 	/// @addtogroup core_precision
 	/// @{
@@ -0,0 +1,40 @@
+/// @ref core
+/// @file glm/detail/type_mat2x2_simd.inl
+
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_mat2_mul_vec2<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec2<double, P> call(tmat2x2<double, P> const & m, tvec2<double, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_mat2_mul_vec2");
+			tvec2<double, P> Result(uninitialize);
+			Result.data = glm_dmat2_mul_dvec2(*reinterpret_cast<glm_dvec2 const(*)[2]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat2_mul<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat2x2<double, P> call(tmat2x2<double, P> const & m1, tmat2x2<double, P> const & m2)
+		{
+			GLM_PROFILE_SIMD("compute_mat2_mul");
+			tmat2x2<double, P> Result(uninitialize);
+			glm_dmat2_mul(
+				*reinterpret_cast<glm_dvec2 const(*)[2]>(&m1[0].data),
+				*reinterpret_cast<glm_dvec2 const(*)[2]>(&m2[0].data),
+				*reinterpret_cast<glm_dvec2(*)[2]>(&Result[0].data));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,33 @@
+/// @ref core
+/// @file glm/detail/type_mat3x3_simd.inl
+
+#include "../simd/common.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_mat3_mul_vec3<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tmat3x3<float, P> const & m, tvec3<float, P> const & v)
+		{
+			GLM_PROFILE_SIMD("compute_mat3_mul_vec3");
+			__m128 const swp0 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 const swp1 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 const swp2 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(2, 2, 2, 2));
+
+			__m128 const mul0 = _mm_mul_ps(m[0].data, swp0);
+			__m128 const mad0 = glm_vec4_fma(m[1].data, swp1, mul0);
+			__m128 const mad1 = glm_vec4_fma(m[2].data, swp2, mad0);
+
+			tvec3<float, P> Result(uninitialize);
+			Result.data = mad1;
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
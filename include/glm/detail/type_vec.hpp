@@ -5,15 +5,17 @@
 
 #include "precision.hpp"
 #include "type_int.hpp"
+#include "_profiling.hpp"
 
 namespace glm{
 namespace detail
 {
+	// Components typed rather than bytes, a byte array in the vector unions lets GCC drop stores to components indexed by operator[]
 	template <typename T, std::size_t size, bool aligned>
 	struct storage
 	{
 		typedef struct type {
-			uint8 data[size];
+			T data[size / sizeof(T)];
 		} type;
 	};
 /*
@@ -43,6 +45,19 @@ namespace detail
 		{
 			typedef glm_uvec4 type;
 		};
+
+		template <>
+		struct storage<double, 16, true>
+		{
+			typedef glm_dvec2 type;
+		};
+
+		// Aligned float 3 components vectors are padded to a SIMD register, the fourth lane is ignored
+		template <>
+		struct storage<float, 12, true>
+		{
+			typedef glm_vec4 type;
+		};
 #	endif
 
 #	if (GLM_ARCH & GLM_ARCH_AVX_BIT)
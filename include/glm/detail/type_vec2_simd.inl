@@ -0,0 +1,115 @@
+/// @ref core
+/// @file glm/detail/type_tvec2_simd.inl
+
+// The constructor specializations below instantiate tvec2 and its tvec4 swizzles, after the tvec4 SIMD swizzles are declared
+#include "type_vec4.hpp"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_vec2_add<double, P, true>
+	{
+		static tvec2<double, P> call(tvec2<double, P> const & a, tvec2<double, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec2_add");
+			tvec2<double, P> Result(uninitialize);
+			Result.data = _mm_add_pd(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec2_sub<double, P, true>
+	{
+		static tvec2<double, P> call(tvec2<double, P> const & a, tvec2<double, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec2_sub");
+			tvec2<double, P> Result(uninitialize);
+			Result.data = _mm_sub_pd(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec2_mul<double, P, true>
+	{
+		static tvec2<double, P> call(tvec2<double, P> const & a, tvec2<double, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec2_mul");
+			tvec2<double, P> Result(uninitialize);
+			Result.data = _mm_mul_pd(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec2_div<double, P, true>
+	{
+		static tvec2<double, P> call(tvec2<double, P> const & a, tvec2<double, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec2_div");
+			tvec2<double, P> Result(uninitialize);
+			Result.data = _mm_div_pd(a.data, b.data);
+			return Result;
+		}
+	};
+}//namespace detail
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_lowp>::tvec2()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_pd())
+#		endif
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_mediump>::tvec2()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_pd())
+#		endif
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_highp>::tvec2()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_pd())
+#		endif
+	{}
+#	endif//!GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_lowp>::tvec2(double s) :
+		data(_mm_set1_pd(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_mediump>::tvec2(double s) :
+		data(_mm_set1_pd(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_highp>::tvec2(double s) :
+		data(_mm_set1_pd(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_lowp>::tvec2(double a, double b) :
+		data(_mm_set_pd(b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_mediump>::tvec2(double a, double b) :
+		data(_mm_set_pd(b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec2<double, aligned_highp>::tvec2(double a, double b) :
+		data(_mm_set_pd(b, a))
+	{}
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
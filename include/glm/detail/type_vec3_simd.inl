@@ -0,0 +1,131 @@
+/// @ref core
+/// @file glm/detail/type_tvec3_simd.inl
+
+// The constructor specializations below instantiate tvec3 and its tvec4 swizzles, after the tvec4 SIMD swizzles are declared
+#include "type_vec4.hpp"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The fourth lane of aligned float tvec3 is zero after the SIMD constructors and ignored by the SIMD functions
+	template <precision P>
+	struct compute_vec3_add<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec3_add");
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_add_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_sub<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec3_sub");
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_sub_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_mul<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec3_mul");
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_mul_ps(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec3_div<float, P, true>
+	{
+		static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec3_div");
+			// Divide the fourth lane by one so that it never raises a division by zero
+			__m128 const one0 = _mm_or_ps(_mm_and_ps(b.data, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_div_ps(a.data, one0);
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_vec3_div<float, aligned_lowp, true>
+	{
+		static tvec3<float, aligned_lowp> call(tvec3<float, aligned_lowp> const & a, tvec3<float, aligned_lowp> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec3_div");
+			tvec3<float, aligned_lowp> Result(uninitialize);
+			Result.data = _mm_mul_ps(a.data, _mm_rcp_ps(b.data));
+			return Result;
+		}
+	};
+}//namespace detail
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_lowp>::tvec3()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_ps())
+#		endif
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_mediump>::tvec3()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_ps())
+#		endif
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_highp>::tvec3()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(_mm_setzero_ps())
+#		endif
+	{}
+#	endif//!GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_lowp>::tvec3(float s) :
+		data(_mm_set_ps(0.0f, s, s, s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_mediump>::tvec3(float s) :
+		data(_mm_set_ps(0.0f, s, s, s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_highp>::tvec3(float s) :
+		data(_mm_set_ps(0.0f, s, s, s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_lowp>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(0.0f, c, b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_mediump>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(0.0f, c, b, a))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER tvec3<float, aligned_highp>::tvec3(float a, float b, float c) :
+		data(_mm_set_ps(0.0f, c, b, a))
+	{}
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,23 +3,122 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#include "../simd/integer.h"
+
 namespace glm{
 namespace detail
 {
 #	ifdef GLM_SWIZZLE
+	// Swizzles of vectors of different lengths share the same type, so the SIMD swizzles only load the components up to
+	// the last swizzled one: aligned float three components vectors are padded to a SIMD register but other vectors are not.
+	template <int E0, int E1, int E2, int E3>
+	struct swizzle_last
+	{
+		enum { value = (E0 > E1 ? E0 : E1) > (E2 > E3 ? E2 : E3) ? (E0 > E1 ? E0 : E1) : (E2 > E3 ? E2 : E3) };
+	};
+
+	// Component of the vector assigned to a swizzle that is written to the lane I, or I if the lane is not written
+	template <int I, int E0, int E1, int E2, int E3>
+	struct swizzle_source
+	{
+		enum { value = E0 == I ? 0 : E1 == I ? 1 : E2 == I ? 2 : E3 == I ? 3 : I };
+	};
+
+	// Bit I is set if the lane I is written by the swizzle
+	template <int E0, int E1, int E2, int E3>
+	struct swizzle_mask
+	{
+		enum { value = (E0 >= 0 ? 1 << E0 : 0) | (E1 >= 0 ? 1 << E1 : 0) | (E2 >= 0 ? 1 << E2 : 0) | (E3 >= 0 ? 1 << E3 : 0) };
+	};
+
+	template <typename T, int Last>
+	struct compute_swizzle_load{};
+
+	template <int Last>
+	struct compute_swizzle_load<float, Last>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(float const * p)
+		{
+			if(Last == 0)
+				return _mm_load_ss(p);
+			else if(Last == 1)
+				return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)));
+			else
+				return _mm_load_ps(p);
+		}
+	};
+
+	template <int Last>
+	struct compute_swizzle_load<int32, Last>
+	{
+		GLM_FUNC_QUALIFIER static __m128i call(int32 const * p)
+		{
+			if(Last == 0)
+				return _mm_cvtsi32_si128(p[0]);
+			else if(Last == 1)
+				return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(p));
+			else if(Last == 2)
+				return _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)), _mm_cvtsi32_si128(p[2]));
+			else
+				return _mm_load_si128(reinterpret_cast<__m128i const*>(p));
+		}
+	};
+
+	template <int Last>
+	struct compute_swizzle_load<uint32, Last>
+	{
+		GLM_FUNC_QUALIFIER static __m128i call(uint32 const * p)
+		{
+			return compute_swizzle_load<int32, Last>::call(reinterpret_cast<int32 const*>(p));
+		}
+	};
+
+	template <int E0, int E1, int E2, int E3>
+	GLM_FUNC_QUALIFIER __m128 swizzle_ps(__m128 v)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			return _mm_permute_ps(v, _MM_SHUFFLE(E3, E2, E1, E0));
+#		else
+			return _mm_shuffle_ps(v, v, _MM_SHUFFLE(E3, E2, E1, E0));
+#		endif
+	}
+
 	template <precision P, int E0, int E1, int E2, int E3>
 	struct _swizzle_base1<4, float, P, glm::tvec4, E0,E1,E2,E3, true> : public _swizzle_base0<float, 4>
 	{ 
 		GLM_FUNC_QUALIFIER tvec4<float, P> operator ()()  const
 		{
-			__m128 data = *reinterpret_cast<__m128 const*>(&this->_buffer);
+			__m128 const data = compute_swizzle_load<float, swizzle_last<E0, E1, E2, E3>::value>::call(&this->elem(0));
 
 			tvec4<float, P> Result(uninitialize);
-#			if GLM_ARCH & GLM_ARCH_AVX_BIT
-				Result.data = _mm_permute_ps(data, _MM_SHUFFLE(E3, E2, E1, E0));
-#			else
-				Result.data = _mm_shuffle_ps(data, data, _MM_SHUFFLE(E3, E2, E1, E0));
-#			endif
+			Result.data = swizzle_ps<E0, E1, E2, E3>(data);
+			return Result;
+		}
+	};
+
+	template <precision P, int E0, int E1, int E2>
+	struct _swizzle_base1<3, float, P, glm::tvec3, E0,E1,E2,-1, true> : public _swizzle_base0<float, 3>
+	{ 
+		GLM_FUNC_QUALIFIER tvec3<float, P> operator ()()  const
+		{
+			__m128 const data = compute_swizzle_load<float, swizzle_last<E0, E1, E2, -1>::value>::call(&this->elem(0));
+
+			// Keep the fourth lane of the aligned tvec3 to zero
+			tvec3<float, P> Result(uninitialize);
+			Result.data = _mm_and_ps(swizzle_ps<E0, E1, E2, E2>(data), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+			return Result;
+		}
+	};
+
+	template <precision P, int E0, int E1>
+	struct _swizzle_base1<2, float, P, glm::tvec2, E0,E1,-1,-2, true> : public _swizzle_base0<float, 2>
+	{ 
+		GLM_FUNC_QUALIFIER tvec2<float, P> operator ()()  const
+		{
+			__m128 const data = compute_swizzle_load<float, swizzle_last<E0, E1, -1, -2>::value>::call(&this->elem(0));
+
+			tvec2<float, P> Result(uninitialize);
+			_mm_storel_pi(reinterpret_cast<__m64*>(&Result.x), swizzle_ps<E0, E1, E0, E1>(data));
 			return Result;
 		}
 	};
@@ -29,7 +128,7 @@ namespace detail
 	{ 
 		GLM_FUNC_QUALIFIER tvec4<int32, P> operator ()()  const
 		{
-			__m128i data = *reinterpret_cast<__m128i const*>(&this->_buffer);
+			__m128i const data = compute_swizzle_load<int32, swizzle_last<E0, E1, E2, E3>::value>::call(&this->elem(0));
 
 			tvec4<int32, P> Result(uninitialize);
 			Result.data = _mm_shuffle_epi32(data, _MM_SHUFFLE(E3, E2, E1, E0));
@@ -42,20 +141,134 @@ namespace detail
 	{ 
 		GLM_FUNC_QUALIFIER tvec4<uint32, P> operator ()()  const
 		{
-			__m128i data = *reinterpret_cast<__m128i const*>(&this->_buffer);
+			__m128i const data = compute_swizzle_load<uint32, swizzle_last<E0, E1, E2, E3>::value>::call(&this->elem(0));
 
 			tvec4<uint32, P> Result(uninitialize);
 			Result.data = _mm_shuffle_epi32(data, _MM_SHUFFLE(E3, E2, E1, E0));
 			return Result;
 		}
 	};
-#	endif
+
+	template <precision P, int E0, int E1>
+	struct _swizzle_base1<2, double, P, glm::tvec2, E0,E1,-1,-2, true> : public _swizzle_base0<double, 2>
+	{ 
+		GLM_FUNC_QUALIFIER tvec2<double, P> operator ()()  const
+		{
+			tvec2<double, P> Result(uninitialize);
+			Result.data = _mm_loadh_pd(_mm_load_sd(&this->elem(E0)), &this->elem(E1));
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<4, double, P, glm::tvec4, E0,E1,E2,E3, true> : public _swizzle_base0<double, 4>
+	{ 
+		GLM_FUNC_QUALIFIER tvec4<double, P> operator ()()  const
+		{
+			int const Last = swizzle_last<E0, E1, E2, E3>::value;
+			double const * p = &this->elem(0);
+
+			tvec4<double, P> Result(uninitialize);
+			if(Last == 0)
+				Result.data = _mm256_broadcast_sd(p);
+			else if(Last == 1)
+				Result.data = _mm256_permute4x64_pd(_mm256_castpd128_pd256(_mm_loadu_pd(p)), _MM_SHUFFLE(E3, E2, E1, E0));
+			else if(Last == 2)
+				Result.data = _mm256_permute4x64_pd(_mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(p)), _mm_load_sd(p + 2), 1), _MM_SHUFFLE(E3, E2, E1, E0));
+			else
+				Result.data = _mm256_permute4x64_pd(_mm256_load_pd(p), _MM_SHUFFLE(E3, E2, E1, E0));
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// Write swizzles: the components are only stored up to the last swizzled one, writing to other lanes with a blend
+	template <int N, precision P, template <typename, precision> class vecType, int E0, int E1, int E2, int E3>
+	struct compute_swizzle_assign<N, float, P, vecType, E0,E1,E2,E3, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float * Dst, vecType<float, P> const & that)
+		{
+			int const Last = swizzle_last<E0, E1, E2, E3>::value;
+			__m128 const Value = swizzle_ps<
+				swizzle_source<0, E0, E1, E2, E3>::value,
+				swizzle_source<1, E0, E1, E2, E3>::value,
+				swizzle_source<2, E0, E1, E2, E3>::value,
+				swizzle_source<3, E0, E1, E2, E3>::value>(compute_swizzle_load<float, N - 1>::call(&that.x));
+
+			if(Last <= 1)
+				_mm_storel_pi(reinterpret_cast<__m64*>(Dst), Value);
+			else if(N == 4)
+				_mm_store_ps(Dst, Value);
+			else
+			{
+				int const Written = swizzle_mask<E0, E1, E2, E3>::value;
+#				if GLM_ARCH & GLM_ARCH_SSE41_BIT
+					_mm_store_ps(Dst, _mm_blend_ps(_mm_load_ps(Dst), Value, Written));
+#				else
+					__m128 const Mask = _mm_castsi128_ps(_mm_set_epi32(
+						Written & 8 ? -1 : 0,
+						Written & 4 ? -1 : 0,
+						Written & 2 ? -1 : 0,
+						Written & 1 ? -1 : 0));
+					_mm_store_ps(Dst, _mm_or_ps(_mm_and_ps(Mask, Value), _mm_andnot_ps(Mask, _mm_load_ps(Dst))));
+#				endif
+			}
+		}
+	};
+
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct compute_swizzle_assign<4, int32, P, glm::tvec4, E0,E1,E2,E3, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(int32 * Dst, tvec4<int32, P> const & that)
+		{
+			_mm_store_si128(reinterpret_cast<__m128i*>(Dst), _mm_shuffle_epi32(that.data, _MM_SHUFFLE(
+				(swizzle_source<3, E0, E1, E2, E3>::value),
+				(swizzle_source<2, E0, E1, E2, E3>::value),
+				(swizzle_source<1, E0, E1, E2, E3>::value),
+				(swizzle_source<0, E0, E1, E2, E3>::value))));
+		}
+	};
+
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct compute_swizzle_assign<4, uint32, P, glm::tvec4, E0,E1,E2,E3, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 * Dst, tvec4<uint32, P> const & that)
+		{
+			_mm_store_si128(reinterpret_cast<__m128i*>(Dst), _mm_shuffle_epi32(that.data, _MM_SHUFFLE(
+				(swizzle_source<3, E0, E1, E2, E3>::value),
+				(swizzle_source<2, E0, E1, E2, E3>::value),
+				(swizzle_source<1, E0, E1, E2, E3>::value),
+				(swizzle_source<0, E0, E1, E2, E3>::value))));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct compute_swizzle_assign<4, double, P, glm::tvec4, E0,E1,E2,E3, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(double * Dst, tvec4<double, P> const & that)
+		{
+			_mm256_store_pd(Dst, _mm256_permute4x64_pd(that.data, _MM_SHUFFLE(
+				(swizzle_source<3, E0, E1, E2, E3>::value),
+				(swizzle_source<2, E0, E1, E2, E3>::value),
+				(swizzle_source<1, E0, E1, E2, E3>::value),
+				(swizzle_source<0, E0, E1, E2, E3>::value))));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	endif//GLM_SWIZZLE
 
 	template <precision P>
 	struct compute_vec4_add<float, P, true>
 	{
-		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_add<float, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_add");
 			tvec4<float, P> Result(uninitialize);
 			Result.data = _mm_add_ps(a.data, b.data);
 			return Result;
@@ -66,8 +279,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_add<double, P, true>
 	{
-		static tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_add<double, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_add");
 			tvec4<double, P> Result(uninitialize);
 			Result.data = _mm256_add_pd(a.data, b.data);
 			return Result;
@@ -78,8 +296,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_sub<float, P, true>
 	{
-		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_sub<float, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_sub");
 			tvec4<float, P> Result(uninitialize);
 			Result.data = _mm_sub_ps(a.data, b.data);
 			return Result;
@@ -90,8 +313,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_sub<double, P, true>
 	{
-		static tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_sub<double, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_sub");
 			tvec4<double, P> Result(uninitialize);
 			Result.data = _mm256_sub_pd(a.data, b.data);
 			return Result;
@@ -102,8 +330,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_mul<float, P, true>
 	{
-		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_mul<float, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_mul");
 			tvec4<float, P> Result(uninitialize);
 			Result.data = _mm_mul_ps(a.data, b.data);
 			return Result;
@@ -114,8 +347,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_mul<double, P, true>
 	{
-		static tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_mul<double, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_mul");
 			tvec4<double, P> Result(uninitialize);
 			Result.data = _mm256_mul_pd(a.data, b.data);
 			return Result;
@@ -126,8 +364,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_div<float, P, true>
 	{
-		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_div<float, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_div");
 			tvec4<float, P> Result(uninitialize);
 			Result.data = _mm_div_ps(a.data, b.data);
 			return Result;
@@ -138,8 +381,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_div<double, P, true>
 	{
-		static tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
+		static GLM_CONSTEXPR_CXX14 tvec4<double, P> call(tvec4<double, P> const & a, tvec4<double, P> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_div<double, P, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_div");
 			tvec4<double, P> Result(uninitialize);
 			Result.data = _mm256_div_pd(a.data, b.data);
 			return Result;
@@ -150,19 +398,97 @@ namespace detail
 	template <>
 	struct compute_vec4_div<float, aligned_lowp, true>
 	{
-		static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & a, tvec4<float, aligned_lowp> const & b)
+		static GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & a, tvec4<float, aligned_lowp> const & b)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_div<float, aligned_lowp, false>::call(a, b);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_div");
 			tvec4<float, aligned_lowp> Result(uninitialize);
 			Result.data = _mm_mul_ps(a.data, _mm_rcp_ps(b.data));
 			return Result;
 		}
 	};
 
+	template <precision P>
+	struct compute_vec4_mul<int32, P, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_mul");
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = glm_ivec4_mul(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul<uint32, P, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_mul");
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = glm_ivec4_mul(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_div<int32, P, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_div");
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = glm_ivec4_div(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_div<uint32, P, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_div");
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = glm_uvec4_div(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mod<int32, P, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_mod");
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = glm_ivec4_mod(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mod<uint32, P, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			GLM_PROFILE_SIMD("compute_vec4_mod");
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = glm_uvec4_mod(a.data, b.data);
+			return Result;
+		}
+	};
+
 	template <typename T, precision P>
 	struct compute_vec4_and<T, P, true, 32, true>
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_and");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_and_si128(a.data, b.data);
 			return Result;
@@ -175,6 +501,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_and");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_and_si256(a.data, b.data);
 			return Result;
@@ -187,6 +514,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_or");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_or_si128(a.data, b.data);
 			return Result;
@@ -199,6 +527,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_or");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_or_si256(a.data, b.data);
 			return Result;
@@ -211,6 +540,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_xor");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_xor_si128(a.data, b.data);
 			return Result;
@@ -223,6 +553,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_xor");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_xor_si256(a.data, b.data);
 			return Result;
@@ -235,6 +566,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_shift_left");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_sll_epi32(a.data, b.data);
 			return Result;
@@ -247,6 +579,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_shift_left");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_sll_epi64(a.data, b.data);
 			return Result;
@@ -259,6 +592,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_shift_right");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_srl_epi32(a.data, b.data);
 			return Result;
@@ -271,6 +605,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const& a, tvec4<T, P> const& b)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_shift_right");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_srl_epi64(a.data, b.data);
 			return Result;
@@ -283,6 +618,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_bitwise_not");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm_xor_si128(v.data, _mm_set1_epi32(-1));
 			return Result;
@@ -295,6 +631,7 @@ namespace detail
 	{
 		static tvec4<T, P> call(tvec4<T, P> const & v)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_bitwise_not");
 			tvec4<T, P> Result(uninitialize);
 			Result.data = _mm256_xor_si256(v.data, _mm_set1_epi32(-1));
 			return Result;
@@ -305,8 +642,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_equal<float, P, false, 32, true>
 	{
-		static bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
+		static GLM_CONSTEXPR_CXX14 bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_equal<float, P, false, 32, false>::call(v1, v2);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_equal");
 			return _mm_movemask_ps(_mm_cmpeq_ps(v1.data, v2.data)) != 0;
 		}
 	};
@@ -316,6 +658,7 @@ namespace detail
 	{
 		static bool call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_equal");
 			return _mm_movemask_epi8(_mm_cmpeq_epi32(v1.data, v2.data)) != 0;
 		}
 	};
@@ -323,8 +666,13 @@ namespace detail
 	template <precision P>
 	struct compute_vec4_nequal<float, P, false, 32, true>
 	{
-		static bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
+		static GLM_CONSTEXPR_CXX14 bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
 		{
+#			if GLM_CONSTANT_EVALUATION
+				if(GLM_IS_CONSTANT_EVALUATED())
+					return compute_vec4_nequal<float, P, false, 32, false>::call(v1, v2);
+#			endif
+			GLM_PROFILE_SIMD("compute_vec4_nequal");
 			return _mm_movemask_ps(_mm_cmpneq_ps(v1.data, v2.data)) != 0;
 		}
 	};
@@ -334,6 +682,7 @@ namespace detail
 	{
 		static bool call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
 		{
+			GLM_PROFILE_SIMD("compute_vec4_nequal");
 			return _mm_movemask_epi8(_mm_cmpneq_epi32(v1.data, v2.data)) != 0;
 		}
 	};
@@ -349,117 +698,189 @@ namespace detail
 #	endif//!GLM_HAS_DEFAULTED_FUNCTIONS
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(float s) :
-		data(_mm_set1_ps(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_lowp>::tvec4(float s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set1_ps(s);
+		}
+#		else
+			data(_mm_set1_ps(s))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(float s) :
-		data(_mm_set1_ps(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_mediump>::tvec4(float s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set1_ps(s);
+		}
+#		else
+			data(_mm_set1_ps(s))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(float s) :
-		data(_mm_set1_ps(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_highp>::tvec4(float s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set1_ps(s);
+		}
+#		else
+			data(_mm_set1_ps(s))
+		{}
+#		endif
 
 #	if GLM_ARCH & GLM_ARCH_AVX_BIT
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<double, aligned_lowp>::tvec4(double s) :
-		data(_mm256_set1_pd(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<double, aligned_lowp>::tvec4(double s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm256_set1_pd(s);
+		}
+#		else
+			data(_mm256_set1_pd(s))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<double, aligned_mediump>::tvec4(double s) :
-		data(_mm256_set1_pd(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<double, aligned_mediump>::tvec4(double s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm256_set1_pd(s);
+		}
+#		else
+			data(_mm256_set1_pd(s))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<double, aligned_highp>::tvec4(double s) :
-		data(_mm256_set1_pd(s))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<double, aligned_highp>::tvec4(double s) :
+#		if GLM_CONSTANT_EVALUATION
+			x(s), y(s), z(s), w(s)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm256_set1_pd(s);
+		}
+#		else
+			data(_mm256_set1_pd(s))
+		{}
+#		endif
 #	endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_lowp>::tvec4(int32 s) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_lowp>::tvec4(int32 s) :
 		data(_mm_set1_epi32(s))
 	{}
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_mediump>::tvec4(int32 s) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_mediump>::tvec4(int32 s) :
 		data(_mm_set1_epi32(s))
 	{}
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_highp>::tvec4(int32 s) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_highp>::tvec4(int32 s) :
 		data(_mm_set1_epi32(s))
 	{}
 
 #	if GLM_ARCH & GLM_ARCH_AVX2_BIT
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int64, aligned_lowp>::tvec4(int64 s) :
+	GLM_FUNC_QUALIFIER tvec4<int64, aligned_lowp>::tvec4(int64 s) :
 		data(_mm256_set1_epi64x(s))
 	{}
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int64, aligned_mediump>::tvec4(int64 s) :
+	GLM_FUNC_QUALIFIER tvec4<int64, aligned_mediump>::tvec4(int64 s) :
 		data(_mm256_set1_epi64x(s))
 	{}
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int64, aligned_highp>::tvec4(int64 s) :
+	GLM_FUNC_QUALIFIER tvec4<int64, aligned_highp>::tvec4(int64 s) :
 		data(_mm256_set1_epi64x(s))
 	{}
 #	endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(float a, float b, float c, float d) :
-		data(_mm_set_ps(d, c, b, a))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_lowp>::tvec4(float a, float b, float c, float d) :
+#		if GLM_CONSTANT_EVALUATION
+			x(a), y(b), z(c), w(d)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set_ps(d, c, b, a);
+		}
+#		else
+			data(_mm_set_ps(d, c, b, a))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(float a, float b, float c, float d) :
-		data(_mm_set_ps(d, c, b, a))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_mediump>::tvec4(float a, float b, float c, float d) :
+#		if GLM_CONSTANT_EVALUATION
+			x(a), y(b), z(c), w(d)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set_ps(d, c, b, a);
+		}
+#		else
+			data(_mm_set_ps(d, c, b, a))
+		{}
+#		endif
 
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(float a, float b, float c, float d) :
-		data(_mm_set_ps(d, c, b, a))
-	{}
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SPECIALIZATION tvec4<float, aligned_highp>::tvec4(float a, float b, float c, float d) :
+#		if GLM_CONSTANT_EVALUATION
+			x(a), y(b), z(c), w(d)
+		{
+			if(!GLM_IS_CONSTANT_EVALUATED())
+				data = _mm_set_ps(d, c, b, a);
+		}
+#		else
+			data(_mm_set_ps(d, c, b, a))
+		{}
+#		endif
 
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_set_epi32(d, c, b, a))
 	{}
 
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_set_epi32(d, c, b, a))
 	{}
 
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<int32, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_set_epi32(d, c, b, a))
 	{}
 /*
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<float, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<float, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 
 	template <>
 	template <>
-	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+	GLM_FUNC_QUALIFIER tvec4<float, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
 		data(_mm_castsi128_ps(_mm_set_epi32(d, c, b, a)))
 	{}
 */
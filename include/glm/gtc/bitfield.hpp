@@ -201,6 +201,143 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int16 v, int8 & x, int8 & y);
+
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint16 v, uint8 & x, uint8 & y);
+
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int32 v, int16 & x, int16 & y);
+
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint16 & x, uint16 & y);
+
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int64 v, int32 & x, int32 & y);
+
+	/// Deinterleaves the bits of v into x and y, reversing bitfieldInterleave.
+	/// The even bits of v are stored in x and the odd bits in y.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int32 v, int8 & x, int8 & y, int8 & z);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int64 v, int16 & x, int16 & y, int16 & z);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int64 v, int32 & x, int32 & y, int32 & z);
+
+	/// Deinterleaves the bits of v into x, y and z, reversing bitfieldInterleave.
+	/// Every third bit of v starting from the first, second and third bits is stored in x, y and z respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y, uint32 & z);
+
+	/// Deinterleaves the bits of v into x, y, z and w, reversing bitfieldInterleave.
+	/// Every fourth bit of v starting from the first, second, third and fourth bits is stored in x, y, z and w respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int32 v, int8 & x, int8 & y, int8 & z, int8 & w);
+
+	/// Deinterleaves the bits of v into x, y, z and w, reversing bitfieldInterleave.
+	/// Every fourth bit of v starting from the first, second, third and fourth bits is stored in x, y, z and w respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z, uint8 & w);
+
+	/// Deinterleaves the bits of v into x, y, z and w, reversing bitfieldInterleave.
+	/// Every fourth bit of v starting from the first, second, third and fourth bits is stored in x, y, z and w respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(int64 v, int16 & x, int16 & y, int16 & z, int16 & w);
+
+	/// Deinterleaves the bits of v into x, y, z and w, reversing bitfieldInterleave.
+	/// Every fourth bit of v starting from the first, second, third and fourth bits is stored in x, y, z and w respectively.
+	/// 
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z, uint16 & w);
+
+	/// Interleaves the bits of the x, y and z components of each element of In, like bitfieldInterleave(uint8, uint8, uint8).
+	/// Keys are computed 4 at a time using SSE2 and 8 at a time using AVX2.
+	/// 
+	/// @param In Array of Count vectors to encode.
+	/// @param Out Array of Count Morton keys.
+	/// @param Count Number of elements.
+	/// @see gtc_bitfield
+	template <precision P>
+	GLM_FUNC_DECL void bitfieldInterleave(tvec3<uint8, P> const * In, uint32 * Out, size_t Count);
+
+	/// Interleaves the 10 lowest bits of the x, y and z components of each element of In into 30 bits Morton keys.
+	/// Keys are computed 4 at a time using SSE2 and 8 at a time using AVX2.
+	/// 
+	/// @param In Array of Count vectors to encode.
+	/// @param Out Array of Count Morton keys.
+	/// @param Count Number of elements.
+	/// @see gtc_bitfield
+	template <precision P>
+	GLM_FUNC_DECL void bitfieldInterleave(tvec3<uint32, P> const * In, uint32 * Out, size_t Count);
+
+	/// Interleaves the bits of the x, y and z components of each element of In, like bitfieldInterleave(uint16, uint16, uint16).
+	/// Keys are computed 2 at a time using SSE2 and 4 at a time using AVX2.
+	/// 
+	/// @param In Array of Count vectors to encode.
+	/// @param Out Array of Count Morton keys.
+	/// @param Count Number of elements.
+	/// @see gtc_bitfield
+	template <precision P>
+	GLM_FUNC_DECL void bitfieldInterleave(tvec3<uint16, P> const * In, uint64 * Out, size_t Count);
+
+	/// Interleaves the bits of the x, y and z components of each element of In, like bitfieldInterleave(uint32, uint32, uint32).
+	/// Only the 22 lowest bits of x and the 21 lowest bits of y and z are encoded.
+	/// Keys are computed 2 at a time using SSE2 and 4 at a time using AVX2.
+	/// 
+	/// @param In Array of Count vectors to encode.
+	/// @param Out Array of Count Morton keys.
+	/// @param Count Number of elements.
+	/// @see gtc_bitfield
+	template <precision P>
+	GLM_FUNC_DECL void bitfieldInterleave(tvec3<uint32, P> const * In, uint64 * Out, size_t Count);
+
 	/// @}
 } //namespace glm
 
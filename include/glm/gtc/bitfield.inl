@@ -220,6 +220,292 @@ namespace detail
 
 		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
 	}
+
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldDeinterleave2(glm::uint32 v)
+	{
+		glm::uint32 REG1(v & glm::uint32(0x55555555));
+
+		REG1 = ((REG1 >>  1) | REG1) & glm::uint32(0x33333333);
+		REG1 = ((REG1 >>  2) | REG1) & glm::uint32(0x0F0F0F0F);
+		REG1 = ((REG1 >>  4) | REG1) & glm::uint32(0x00FF00FF);
+		REG1 = ((REG1 >>  8) | REG1) & glm::uint32(0x0000FFFF);
+
+		return REG1;
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldDeinterleave2(glm::uint64 v)
+	{
+		glm::uint64 REG1(v & glm::uint64(0x5555555555555555ull));
+
+		REG1 = ((REG1 >>  1) | REG1) & glm::uint64(0x3333333333333333ull);
+		REG1 = ((REG1 >>  2) | REG1) & glm::uint64(0x0F0F0F0F0F0F0F0Full);
+		REG1 = ((REG1 >>  4) | REG1) & glm::uint64(0x00FF00FF00FF00FFull);
+		REG1 = ((REG1 >>  8) | REG1) & glm::uint64(0x0000FFFF0000FFFFull);
+		REG1 = ((REG1 >> 16) | REG1) & glm::uint64(0x00000000FFFFFFFFull);
+
+		return REG1;
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldDeinterleave3(glm::uint32 v)
+	{
+		glm::uint32 REG1(v & glm::uint32(0x49249249));
+
+		REG1 = ((REG1 >>  2) | REG1) & glm::uint32(0xC30C30C3);
+		REG1 = ((REG1 >>  4) | REG1) & glm::uint32(0x0F00F00F);
+		REG1 = ((REG1 >>  8) | REG1) & glm::uint32(0xFF0000FF);
+		REG1 = ((REG1 >> 16) | REG1) & glm::uint32(0x000007FF);
+
+		return REG1;
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldDeinterleave3(glm::uint64 v)
+	{
+		glm::uint64 REG1(v & glm::uint64(0x9249249249249249ull));
+
+		REG1 = ((REG1 >>  2) | REG1) & glm::uint64(0x30C30C30C30C30C3ull);
+		REG1 = ((REG1 >>  4) | REG1) & glm::uint64(0xF00F00F00F00F00Full);
+		REG1 = ((REG1 >>  8) | REG1) & glm::uint64(0x00FF0000FF0000FFull);
+		REG1 = ((REG1 >> 16) | REG1) & glm::uint64(0xFFFF00000000FFFFull);
+		REG1 = ((REG1 >> 32) | REG1) & glm::uint64(0x00000000FFFFFFFFull);
+
+		return REG1;
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldDeinterleave4(glm::uint32 v)
+	{
+		glm::uint32 REG1(v & glm::uint32(0x11111111));
+
+		REG1 = ((REG1 >>  3) | REG1) & glm::uint32(0x03030303);
+		REG1 = ((REG1 >>  6) | REG1) & glm::uint32(0x000F000F);
+		REG1 = ((REG1 >> 12) | REG1) & glm::uint32(0x000000FF);
+
+		return REG1;
+	}
+
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldDeinterleave4(glm::uint64 v)
+	{
+		glm::uint64 REG1(v & glm::uint64(0x1111111111111111ull));
+
+		REG1 = ((REG1 >>  3) | REG1) & glm::uint64(0x0303030303030303ull);
+		REG1 = ((REG1 >>  6) | REG1) & glm::uint64(0x000F000F000F000Full);
+		REG1 = ((REG1 >> 12) | REG1) & glm::uint64(0x000000FF000000FFull);
+		REG1 = ((REG1 >> 24) | REG1) & glm::uint64(0x000000000000FFFFull);
+
+		return REG1;
+	}
+
+	// 10 bits per component variant used by the 30 bits Morton keys, bit i moves to bit 3 * i.
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave10(glm::uint32 x, glm::uint32 y, glm::uint32 z)
+	{
+		glm::uint32 REG1(x & glm::uint32(0x000003FF));
+		glm::uint32 REG2(y & glm::uint32(0x000003FF));
+		glm::uint32 REG3(z & glm::uint32(0x000003FF));
+
+		REG1 = ((REG1 << 16) | REG1) & glm::uint32(0x030000FF);
+		REG2 = ((REG2 << 16) | REG2) & glm::uint32(0x030000FF);
+		REG3 = ((REG3 << 16) | REG3) & glm::uint32(0x030000FF);
+
+		REG1 = ((REG1 <<  8) | REG1) & glm::uint32(0x0300F00F);
+		REG2 = ((REG2 <<  8) | REG2) & glm::uint32(0x0300F00F);
+		REG3 = ((REG3 <<  8) | REG3) & glm::uint32(0x0300F00F);
+
+		REG1 = ((REG1 <<  4) | REG1) & glm::uint32(0x030C30C3);
+		REG2 = ((REG2 <<  4) | REG2) & glm::uint32(0x030C30C3);
+		REG3 = ((REG3 <<  4) | REG3) & glm::uint32(0x030C30C3);
+
+		REG1 = ((REG1 <<  2) | REG1) & glm::uint32(0x09249249);
+		REG2 = ((REG2 <<  2) | REG2) & glm::uint32(0x09249249);
+		REG3 = ((REG3 <<  2) | REG3) & glm::uint32(0x09249249);
+
+		return REG1 | (REG2 << 1) | (REG3 << 2);
+	}
+
+	template <typename T, precision P, typename keyType>
+	struct compute_bitfieldInterleave3Array
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<T, P> const * In, keyType * Out, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Out[i] = glm::bitfieldInterleave(In[i].x, In[i].y, In[i].z);
+		}
+	};
+
+	// 32 bits keys hold 10 bits per component, which covers uint8 components too.
+	template <typename T, precision P>
+	struct compute_bitfieldInterleave3Array<T, P, uint32>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<T, P> const * In, uint32 * Out, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Out[i] = bitfieldInterleave10(In[i].x, In[i].y, In[i].z);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Loads 4 consecutive tvec3<uint32> and transposes them to structure of arrays with 3 loads.
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfield_load_soa3(tvec3<uint32, P> const * In, glm_uvec4 & X, glm_uvec4 & Y, glm_uvec4 & Z)
+	{
+		GLM_STATIC_ASSERT(sizeof(tvec3<uint32, P>) == 12, "tvec3 is expected to be tightly packed");
+
+		glm_vec4 const a = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(In) + 0)); // x0 y0 z0 x1
+		glm_vec4 const b = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(In) + 1)); // y1 z1 x2 y2
+		glm_vec4 const c = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(In) + 2)); // z2 x3 y3 z3
+
+		glm_vec4 const bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+		glm_vec4 const ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		glm_vec4 const cb = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+		glm_vec4 const za = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+		X = _mm_castps_si128(_mm_shuffle_ps(a, bc, _MM_SHUFFLE(3, 0, 3, 0)));
+		Y = _mm_castps_si128(_mm_shuffle_ps(ab, cb, _MM_SHUFFLE(2, 0, 2, 0)));
+		Z = _mm_castps_si128(_mm_shuffle_ps(za, c, _MM_SHUFFLE(3, 0, 2, 0)));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// Loads 8 consecutive tvec3<uint8>, 24 bytes, and widens each component to a 32 bits lane.
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfield_load_soa3(tvec3<uint8, P> const * In, __m256i & X, __m256i & Y, __m256i & Z)
+	{
+		GLM_STATIC_ASSERT(sizeof(tvec3<uint8, P>) == 3, "tvec3 is expected to be tightly packed");
+
+		__m128i const Lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In)); // x0 y0 z0 ... y4 z4 x5
+		__m128i const Hi = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(reinterpret_cast<uint8 const*>(In) + 16)); // y5 z5 x6 y6 z6 x7 y7 z7
+
+		__m128i const LoX = _mm_shuffle_epi8(Lo, _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiX = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const LoY = _mm_shuffle_epi8(Lo, _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiY = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const LoZ = _mm_shuffle_epi8(Lo, _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiZ = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1));
+
+		X = _mm256_cvtepu8_epi32(_mm_or_si128(LoX, HiX));
+		Y = _mm256_cvtepu8_epi32(_mm_or_si128(LoY, HiY));
+		Z = _mm256_cvtepu8_epi32(_mm_or_si128(LoZ, HiZ));
+	}
+
+	// Loads 4 consecutive tvec3<uint16>, 24 bytes, and widens each component to a 64 bits lane.
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfield_load_soa3(tvec3<uint16, P> const * In, glm_u64vec4 & X, glm_u64vec4 & Y, glm_u64vec4 & Z)
+	{
+		GLM_STATIC_ASSERT(sizeof(tvec3<uint16, P>) == 6, "tvec3 is expected to be tightly packed");
+
+		__m128i const Lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In)); // x0 y0 z0 x1 y1 z1 x2 y2
+		__m128i const Hi = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(reinterpret_cast<uint8 const*>(In) + 16)); // z2 x3 y3 z3
+
+		__m128i const LoX = _mm_shuffle_epi8(Lo, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiX = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const LoY = _mm_shuffle_epi8(Lo, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiY = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const LoZ = _mm_shuffle_epi8(Lo, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+		__m128i const HiZ = _mm_shuffle_epi8(Hi, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1));
+
+		X = _mm256_cvtepu16_epi64(_mm_or_si128(LoX, HiX));
+		Y = _mm256_cvtepu16_epi64(_mm_or_si128(LoY, HiY));
+		Z = _mm256_cvtepu16_epi64(_mm_or_si128(LoZ, HiZ));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	template <precision P>
+	struct compute_bitfieldInterleave3Array<uint8, P, uint32>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<uint8, P> const * In, uint32 * Out, size_t Count)
+		{
+			size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= Count; i += 8)
+				{
+					__m256i x, y, z;
+					bitfield_load_soa3(In + i, x, y, z);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), glm_u32vec8_interleave3(x, y, z));
+				}
+#			else
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_uvec4 const x = _mm_setr_epi32(In[i].x, In[i + 1].x, In[i + 2].x, In[i + 3].x);
+					glm_uvec4 const y = _mm_setr_epi32(In[i].y, In[i + 1].y, In[i + 2].y, In[i + 3].y);
+					glm_uvec4 const z = _mm_setr_epi32(In[i].z, In[i + 1].z, In[i + 2].z, In[i + 3].z);
+					_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Out + i), glm_u32vec4_interleave3(x, y, z));
+				}
+#			endif
+			for(; i < Count; ++i)
+				Out[i] = bitfieldInterleave10(In[i].x, In[i].y, In[i].z);
+		}
+	};
+
+	template <precision P>
+	struct compute_bitfieldInterleave3Array<uint32, P, uint32>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<uint32, P> const * In, uint32 * Out, size_t Count)
+		{
+			size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_uvec4 x, y, z;
+				bitfield_load_soa3(In + i, x, y, z);
+				_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Out + i), glm_u32vec4_interleave3(x, y, z));
+			}
+			for(; i < Count; ++i)
+				Out[i] = bitfieldInterleave10(In[i].x, In[i].y, In[i].z);
+		}
+	};
+
+#	if !(GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64))
+	// With BMI2, the scalar pdep loop of the primary template is faster than the shift and mask cascade.
+	template <precision P>
+	struct compute_bitfieldInterleave3Array<uint16, P, uint64>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<uint16, P> const * In, uint64 * Out, size_t Count)
+		{
+			size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_u64vec4 x, y, z;
+					bitfield_load_soa3(In + i, x, y, z);
+					_mm256_storeu_si256(reinterpret_cast<glm_u64vec4*>(Out + i), glm_u64vec4_interleave3(x, y, z));
+				}
+#			else
+				for(; i + 2 <= Count; i += 2)
+				{
+					glm_uvec4 const x = _mm_set_epi64x(In[i + 1].x, In[i].x);
+					glm_uvec4 const y = _mm_set_epi64x(In[i + 1].y, In[i].y);
+					glm_uvec4 const z = _mm_set_epi64x(In[i + 1].z, In[i].z);
+					_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Out + i), glm_u64vec2_interleave3(x, y, z));
+				}
+#			endif
+			for(; i < Count; ++i)
+				Out[i] = glm::bitfieldInterleave(In[i].x, In[i].y, In[i].z);
+		}
+	};
+
+	template <precision P>
+	struct compute_bitfieldInterleave3Array<uint32, P, uint64>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec3<uint32, P> const * In, uint64 * Out, size_t Count)
+		{
+			size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				glm_uvec4 x, y, z;
+				bitfield_load_soa3(In + i, x, y, z);
+#				if GLM_ARCH & GLM_ARCH_AVX2_BIT
+					__m256i const Key = glm_u64vec4_interleave3(_mm256_cvtepu32_epi64(x), _mm256_cvtepu32_epi64(y), _mm256_cvtepu32_epi64(z));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Key);
+#				else
+					glm_uvec4 const Zero = _mm_setzero_si128();
+					glm_uvec4 const Key0 = glm_u64vec2_interleave3(_mm_unpacklo_epi32(x, Zero), _mm_unpacklo_epi32(y, Zero), _mm_unpacklo_epi32(z, Zero));
+					glm_uvec4 const Key1 = glm_u64vec2_interleave3(_mm_unpackhi_epi32(x, Zero), _mm_unpackhi_epi32(y, Zero), _mm_unpackhi_epi32(z, Zero));
+					_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Out + i) + 0, Key0);
+					_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Out + i) + 1, Key1);
+#				endif
+			}
+			for(; i < Count; ++i)
+				Out[i] = glm::bitfieldInterleave(In[i].x, In[i].y, In[i].z);
+		}
+	};
+#	endif//!(GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64))
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 }//namespace detail
 
 	template <typename genIUType>
@@ -321,7 +607,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint16 bitfieldInterleave(uint8 x, uint8 y)
 	{
-		return detail::bitfieldInterleave<uint8, uint16>(x, y);
+#		if GLM_HAS_BMI2
+			return static_cast<uint16>(_pdep_u32(x, 0x5555) | _pdep_u32(y, 0xAAAA));
+#		else
+			return detail::bitfieldInterleave<uint8, uint16>(x, y);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
@@ -347,7 +637,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 bitfieldInterleave(uint16 x, uint16 y)
 	{
-		return detail::bitfieldInterleave<uint16, uint32>(x, y);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x55555555) | _pdep_u32(y, 0xAAAAAAAA);
+#		else
+			return detail::bitfieldInterleave<uint16, uint32>(x, y);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
@@ -373,7 +667,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 bitfieldInterleave(uint32 x, uint32 y)
 	{
-		return detail::bitfieldInterleave<uint32, uint64>(x, y);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#		else
+			return detail::bitfieldInterleave<uint32, uint64>(x, y);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
@@ -400,7 +698,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 bitfieldInterleave(uint8 x, uint8 y, uint8 z)
 	{
-		return detail::bitfieldInterleave<uint8, uint32>(x, y, z);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x49249249) | _pdep_u32(y, 0x92492492) | _pdep_u32(z, 0x24924924);
+#		else
+			return detail::bitfieldInterleave<uint8, uint32>(x, y, z);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int16 x, int16 y, int16 z)
@@ -427,7 +729,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z)
 	{
-		return detail::bitfieldInterleave<uint32, uint64>(x, y, z);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			return detail::bitfieldInterleave<uint32, uint64>(x, y, z);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y, int32 z)
@@ -454,7 +760,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 bitfieldInterleave(uint32 x, uint32 y, uint32 z)
 	{
-		return detail::bitfieldInterleave<uint32, uint64>(x, y, z);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#		else
+			return detail::bitfieldInterleave<uint32, uint64>(x, y, z);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z, int8 w)
@@ -482,7 +792,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 bitfieldInterleave(uint8 x, uint8 y, uint8 z, uint8 w)
 	{
-		return detail::bitfieldInterleave<uint8, uint32>(x, y, z, w);
+#		if GLM_HAS_BMI2
+			return _pdep_u32(x, 0x11111111) | _pdep_u32(y, 0x22222222) | _pdep_u32(z, 0x44444444) | _pdep_u32(w, 0x88888888);
+#		else
+			return detail::bitfieldInterleave<uint8, uint32>(x, y, z, w);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int16 x, int16 y, int16 z, int16 w)
@@ -510,6 +824,303 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w)
 	{
-		return detail::bitfieldInterleave<uint16, uint64>(x, y, z, w);
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+#		else
+			return detail::bitfieldInterleave<uint16, uint64>(x, y, z, w);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int16 v, int8 & x, int8 & y)
+	{
+		union sign16
+		{
+			int16 i;
+			uint16 u;
+		} value;
+
+		union sign8
+		{
+			int8 i;
+			uint8 u;
+		} sign_x, sign_y;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u);
+		x = sign_x.i;
+		y = sign_y.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint16 v, uint8 & x, uint8 & y)
+	{
+#		if GLM_HAS_BMI2
+			x = static_cast<uint8>(_pext_u32(v, 0x5555));
+			y = static_cast<uint8>(_pext_u32(v, 0xAAAA));
+#		else
+			x = static_cast<uint8>(detail::bitfieldDeinterleave2(static_cast<uint32>(v)));
+			y = static_cast<uint8>(detail::bitfieldDeinterleave2(static_cast<uint32>(v >> 1)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int32 v, int16 & x, int16 & y)
+	{
+		union sign32
+		{
+			int32 i;
+			uint32 u;
+		} value;
+
+		union sign16
+		{
+			int16 i;
+			uint16 u;
+		} sign_x, sign_y;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u);
+		x = sign_x.i;
+		y = sign_y.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint16 & x, uint16 & y)
+	{
+#		if GLM_HAS_BMI2
+			x = static_cast<uint16>(_pext_u32(v, 0x55555555));
+			y = static_cast<uint16>(_pext_u32(v, 0xAAAAAAAA));
+#		else
+			x = static_cast<uint16>(detail::bitfieldDeinterleave2(static_cast<uint32>(v)));
+			y = static_cast<uint16>(detail::bitfieldDeinterleave2(static_cast<uint32>(v >> 1)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int64 v, int32 & x, int32 & y)
+	{
+		union sign64
+		{
+			int64 i;
+			uint64 u;
+		} value;
+
+		union sign32
+		{
+			int32 i;
+			uint32 u;
+		} sign_x, sign_y;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u);
+		x = sign_x.i;
+		y = sign_y.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			x = static_cast<uint32>(_pext_u64(v, 0x5555555555555555ull));
+			y = static_cast<uint32>(_pext_u64(v, 0xAAAAAAAAAAAAAAAAull));
+#		else
+			x = static_cast<uint32>(detail::bitfieldDeinterleave2(static_cast<uint64>(v)));
+			y = static_cast<uint32>(detail::bitfieldDeinterleave2(static_cast<uint64>(v >> 1)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int32 v, int8 & x, int8 & y, int8 & z)
+	{
+		union sign32
+		{
+			int32 i;
+			uint32 u;
+		} value;
+
+		union sign8
+		{
+			int8 i;
+			uint8 u;
+		} sign_x, sign_y, sign_z;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u, sign_z.u);
+		x = sign_x.i;
+		y = sign_y.i;
+		z = sign_z.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z)
+	{
+#		if GLM_HAS_BMI2
+			x = static_cast<uint8>(_pext_u32(v, 0x49249249));
+			y = static_cast<uint8>(_pext_u32(v, 0x92492492));
+			z = static_cast<uint8>(_pext_u32(v, 0x24924924));
+#		else
+			x = static_cast<uint8>(detail::bitfieldDeinterleave3(v));
+			y = static_cast<uint8>(detail::bitfieldDeinterleave3(v >> 1));
+			z = static_cast<uint8>(detail::bitfieldDeinterleave3(v >> 2));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int64 v, int16 & x, int16 & y, int16 & z)
+	{
+		union sign64
+		{
+			int64 i;
+			uint64 u;
+		} value;
+
+		union sign16
+		{
+			int16 i;
+			uint16 u;
+		} sign_x, sign_y, sign_z;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u, sign_z.u);
+		x = sign_x.i;
+		y = sign_y.i;
+		z = sign_z.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			x = static_cast<uint16>(_pext_u64(v, 0x9249249249249249ull));
+			y = static_cast<uint16>(_pext_u64(v, 0x2492492492492492ull));
+			z = static_cast<uint16>(_pext_u64(v, 0x4924924924924924ull));
+#		else
+			x = static_cast<uint16>(detail::bitfieldDeinterleave3(v));
+			y = static_cast<uint16>(detail::bitfieldDeinterleave3(v >> 1));
+			z = static_cast<uint16>(detail::bitfieldDeinterleave3(v >> 2));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int64 v, int32 & x, int32 & y, int32 & z)
+	{
+		union sign64
+		{
+			int64 i;
+			uint64 u;
+		} value;
+
+		union sign32
+		{
+			int32 i;
+			uint32 u;
+		} sign_x, sign_y, sign_z;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u, sign_z.u);
+		x = sign_x.i;
+		y = sign_y.i;
+		z = sign_z.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint32 & x, uint32 & y, uint32 & z)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			x = static_cast<uint32>(_pext_u64(v, 0x9249249249249249ull));
+			y = static_cast<uint32>(_pext_u64(v, 0x2492492492492492ull));
+			z = static_cast<uint32>(_pext_u64(v, 0x4924924924924924ull));
+#		else
+			x = static_cast<uint32>(detail::bitfieldDeinterleave3(v));
+			y = static_cast<uint32>(detail::bitfieldDeinterleave3(v >> 1));
+			z = static_cast<uint32>(detail::bitfieldDeinterleave3(v >> 2));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int32 v, int8 & x, int8 & y, int8 & z, int8 & w)
+	{
+		union sign32
+		{
+			int32 i;
+			uint32 u;
+		} value;
+
+		union sign8
+		{
+			int8 i;
+			uint8 u;
+		} sign_x, sign_y, sign_z, sign_w;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u, sign_z.u, sign_w.u);
+		x = sign_x.i;
+		y = sign_y.i;
+		z = sign_z.i;
+		w = sign_w.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 v, uint8 & x, uint8 & y, uint8 & z, uint8 & w)
+	{
+#		if GLM_HAS_BMI2
+			x = static_cast<uint8>(_pext_u32(v, 0x11111111));
+			y = static_cast<uint8>(_pext_u32(v, 0x22222222));
+			z = static_cast<uint8>(_pext_u32(v, 0x44444444));
+			w = static_cast<uint8>(_pext_u32(v, 0x88888888));
+#		else
+			x = static_cast<uint8>(detail::bitfieldDeinterleave4(v));
+			y = static_cast<uint8>(detail::bitfieldDeinterleave4(v >> 1));
+			z = static_cast<uint8>(detail::bitfieldDeinterleave4(v >> 2));
+			w = static_cast<uint8>(detail::bitfieldDeinterleave4(v >> 3));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(int64 v, int16 & x, int16 & y, int16 & z, int16 & w)
+	{
+		union sign64
+		{
+			int64 i;
+			uint64 u;
+		} value;
+
+		union sign16
+		{
+			int16 i;
+			uint16 u;
+		} sign_x, sign_y, sign_z, sign_w;
+
+		value.i = v;
+		bitfieldDeinterleave(value.u, sign_x.u, sign_y.u, sign_z.u, sign_w.u);
+		x = sign_x.i;
+		y = sign_y.i;
+		z = sign_z.i;
+		w = sign_w.i;
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 v, uint16 & x, uint16 & y, uint16 & z, uint16 & w)
+	{
+#		if GLM_HAS_BMI2 && (GLM_MODEL == GLM_MODEL_64)
+			x = static_cast<uint16>(_pext_u64(v, 0x1111111111111111ull));
+			y = static_cast<uint16>(_pext_u64(v, 0x2222222222222222ull));
+			z = static_cast<uint16>(_pext_u64(v, 0x4444444444444444ull));
+			w = static_cast<uint16>(_pext_u64(v, 0x8888888888888888ull));
+#		else
+			x = static_cast<uint16>(detail::bitfieldDeinterleave4(v));
+			y = static_cast<uint16>(detail::bitfieldDeinterleave4(v >> 1));
+			z = static_cast<uint16>(detail::bitfieldDeinterleave4(v >> 2));
+			w = static_cast<uint16>(detail::bitfieldDeinterleave4(v >> 3));
+#		endif
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(tvec3<uint8, P> const * In, uint32 * Out, size_t Count)
+	{
+		detail::compute_bitfieldInterleave3Array<uint8, P, uint32>::call(In, Out, Count);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(tvec3<uint32, P> const * In, uint32 * Out, size_t Count)
+	{
+		detail::compute_bitfieldInterleave3Array<uint32, P, uint32>::call(In, Out, Count);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(tvec3<uint16, P> const * In, uint64 * Out, size_t Count)
+	{
+		detail::compute_bitfieldInterleave3Array<uint16, P, uint64>::call(In, Out, Count);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(tvec3<uint32, P> const * In, uint64 * Out, size_t Count)
+	{
+		detail::compute_bitfieldInterleave3Array<uint32, P, uint64>::call(In, Out, Count);
 	}
 }//namespace glm
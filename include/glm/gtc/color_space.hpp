@@ -16,9 +16,11 @@
 // Dependencies
 #include "../detail/setup.hpp"
 #include "../detail/precision.hpp"
+#include "../common.hpp"
 #include "../exponential.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../fwd.hpp"
 #include <limits>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
@@ -46,6 +48,28 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_DECL vecType<T, P> convertSRGBToLinear(vecType<T, P> const & ColorSRGB, T Gamma);
 
+	/// Convert an array of linear colors to sRGB colors with 8 bits components, using the standard sRGB transfer function.
+	/// Components are clamped to [0, 1] and the alpha component is only quantized.
+	/// Large arrays are converted by chunks of rows in parallel when OpenMP is enabled.
+	GLM_FUNC_DECL void convertLinearToSRGB(vec4 const * ColorLinear, u8vec4 * ColorSRGB, size_t Count);
+
+	/// Convert an array of sRGB colors with 8 bits components to linear colors, using a 256 entries lookup table.
+	/// The alpha component is only normalized.
+	/// Large arrays are converted by chunks of rows in parallel when OpenMP is enabled.
+	GLM_FUNC_DECL void convertSRGBToLinear(u8vec4 const * ColorSRGB, vec4 * ColorLinear, size_t Count);
+
+	/// Convert an array of linear colors to sRGB colors, using the standard sRGB transfer function
+	/// approximated by a polynomial with an absolute error below 2e-5.
+	/// Components are clamped to [0, 1]. ColorSRGB may be ColorLinear.
+	/// Large arrays are converted by chunks of rows in parallel when OpenMP is enabled.
+	GLM_FUNC_DECL void convertLinearToSRGB(vec3 const * ColorLinear, vec3 * ColorSRGB, size_t Count);
+
+	/// Convert an array of sRGB colors to linear colors, using the standard sRGB transfer function
+	/// approximated by a polynomial with a relative error below 3e-5.
+	/// Components are clamped to [0, 1]. ColorLinear may be ColorSRGB.
+	/// Large arrays are converted by chunks of rows in parallel when OpenMP is enabled.
+	GLM_FUNC_DECL void convertSRGBToLinear(vec3 const * ColorSRGB, vec3 * ColorLinear, size_t Count);
+
 	/// @}
 } //namespace glm
 
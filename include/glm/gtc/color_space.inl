@@ -1,6 +1,8 @@
 /// @ref gtc_color_space
 /// @file glm/gtc/color_space.inl
 
+#include "../simd/common.h"
+
 namespace glm{
 namespace detail
 {
@@ -47,6 +49,213 @@ namespace detail
 			return tvec4<T, P>(compute_srgbToRgb<T, P, tvec3>::call(tvec3<T, P>(ColorSRGB), Gamma), ColorSRGB.a);
 		}
 	};
+
+	// Below this count, spawning threads costs more than converting the colors.
+	static size_t const color_space_parallel_count = 1 << 16;
+
+	// Colors converted by each thread, a few rows of an image
+	static size_t const color_space_chunk_count = 1 << 14;
+
+	// Linear values of the sRGB encoded 8 bits components
+	GLM_FUNC_QUALIFIER float const * srgb_to_linear_table()
+	{
+		static float const Table[256] =
+		{
+			0.0f, 0.000303526991f, 0.000607053982f, 0.000910580973f, 0.00121410796f, 0.00151763496f, 0.00182116195f, 0.00212468882f,
+			0.00242821593f, 0.0027317428f, 0.00303526991f, 0.00334653584f, 0.00367650739f, 0.00402471703f, 0.00439144205f, 0.00477695325f,
+			0.00518151652f, 0.00560539169f, 0.00604883302f, 0.00651209056f, 0.00699541019f, 0.00749903219f, 0.00802319311f, 0.00856812578f,
+			0.00913405884f, 0.00972121768f, 0.010329823f, 0.0109600937f, 0.0116122449f, 0.012286488f, 0.0129830325f, 0.0137020834f,
+			0.0144438436f, 0.0152085144f, 0.0159962941f, 0.0168073755f, 0.0176419541f, 0.01850022f, 0.0193823613f, 0.0202885624f,
+			0.0212190095f, 0.0221738853f, 0.0231533665f, 0.0241576321f, 0.0251868591f, 0.0262412224f, 0.0273208916f, 0.02842604f,
+			0.0295568351f, 0.0307134446f, 0.0318960324f, 0.0331047662f, 0.0343398079f, 0.0356013142f, 0.0368894488f, 0.0382043719f,
+			0.0395462364f, 0.0409151986f, 0.0423114114f, 0.043735031f, 0.045186203f, 0.0466650873f, 0.0481718257f, 0.0497065671f,
+			0.0512694567f, 0.0528606474f, 0.054480277f, 0.0561284907f, 0.0578054301f, 0.0595112368f, 0.0612460524f, 0.0630100146f,
+			0.064803265f, 0.0666259378f, 0.0684781671f, 0.0703600943f, 0.0722718537f, 0.0742135718f, 0.0761853829f, 0.078187421f,
+			0.0802198201f, 0.0822827071f, 0.0843762085f, 0.0865004584f, 0.0886555836f, 0.0908417106f, 0.0930589661f, 0.0953074694f,
+			0.097587347f, 0.0998987257f, 0.102241732f, 0.104616486f, 0.107023105f, 0.10946171f, 0.111932427f, 0.114435375f,
+			0.116970666f, 0.119538426f, 0.122138776f, 0.124771819f, 0.127437681f, 0.130136475f, 0.13286832f, 0.135633335f,
+			0.138431609f, 0.141263291f, 0.144128472f, 0.147027269f, 0.149959788f, 0.152926147f, 0.155926466f, 0.158960834f,
+			0.162029371f, 0.165132195f, 0.168269396f, 0.171441108f, 0.174647406f, 0.177888423f, 0.18116425f, 0.18447499f,
+			0.187820777f, 0.191201687f, 0.194617838f, 0.198069319f, 0.20155625f, 0.205078736f, 0.208636865f, 0.212230757f,
+			0.215860501f, 0.219526201f, 0.223227963f, 0.226965874f, 0.230740055f, 0.23455058f, 0.238397568f, 0.242281124f,
+			0.246201321f, 0.25015828f, 0.254152089f, 0.258182853f, 0.262250662f, 0.266355604f, 0.270497799f, 0.274677306f,
+			0.278894275f, 0.283148736f, 0.287440836f, 0.291770637f, 0.296138257f, 0.300543785f, 0.304987311f, 0.309468925f,
+			0.313988715f, 0.318546772f, 0.323143214f, 0.327778101f, 0.332451522f, 0.337163627f, 0.341914415f, 0.346704066f,
+			0.351532608f, 0.356400132f, 0.361306787f, 0.366252601f, 0.371237695f, 0.376262128f, 0.38132602f, 0.386429429f,
+			0.391572475f, 0.396755219f, 0.401977777f, 0.407240212f, 0.412542611f, 0.417885065f, 0.423267663f, 0.428690493f,
+			0.434153646f, 0.439657182f, 0.445201188f, 0.450785786f, 0.456411034f, 0.462076992f, 0.467783809f, 0.473531485f,
+			0.479320168f, 0.48514995f, 0.491020858f, 0.496932983f, 0.502886474f, 0.50888133f, 0.514917672f, 0.520995557f,
+			0.527115107f, 0.533276379f, 0.539479494f, 0.545724452f, 0.55201143f, 0.558340371f, 0.564711511f, 0.571124852f,
+			0.577580452f, 0.584078431f, 0.590618849f, 0.597201765f, 0.603827357f, 0.610495567f, 0.617206573f, 0.623960376f,
+			0.630757153f, 0.637596846f, 0.644479692f, 0.651405632f, 0.658374846f, 0.665387273f, 0.672443151f, 0.679542482f,
+			0.686685324f, 0.693871737f, 0.701101899f, 0.708375752f, 0.715693474f, 0.723055124f, 0.730460763f, 0.73791039f,
+			0.745404184f, 0.752942204f, 0.760524511f, 0.768151164f, 0.775822222f, 0.783537805f, 0.791297913f, 0.799102724f,
+			0.806952238f, 0.814846575f, 0.822785735f, 0.830769897f, 0.838799f, 0.846873224f, 0.854992628f, 0.863157213f,
+			0.871367097f, 0.8796224f, 0.887923121f, 0.896269381f, 0.904661179f, 0.913098633f, 0.921581864f, 0.930110872f,
+			0.938685715f, 0.947306514f, 0.955973327f, 0.964686275f, 0.973445296f, 0.982250571f, 0.991102099f, 1.0f
+		};
+		return Table;
+	}
+
+	// Coefficients, from the highest degree, of 1.055 * x^(1 / 2.4) - 0.055 as a polynomial of x^(1 / 4) over [0.0031308, 1]
+	static float const srgb_encode_polynomial[6] = {-6.275899154e-02f, 2.727522437e-01f, -5.575556490e-01f, 1.244213996e+00f, 1.649740003e-01f, -6.162970564e-02f};
+
+	// Coefficients, from the highest degree, of u^0.4 as a polynomial of u^(1 / 2) over [0.0904739, 1], with u = (x + 0.055) / 1.055
+	static float const srgb_decode_polynomial[6] = {8.797514900e-02f, -3.724940359e-01f, 6.784268898e-01f, -7.536025212e-01f, 1.322428747e+00f, 3.726972582e-02f};
+
+	struct srgb_encode
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			float const Clamped = clamp(x, 0.0f, 1.0f);
+			if(Clamped <= 0.0031308f)
+				return Clamped * 12.92f;
+
+			float const t = sqrt(sqrt(Clamped));
+			float Result = srgb_encode_polynomial[0];
+			for(length_t i = 1; i < 6; ++i)
+				Result = Result * t + srgb_encode_polynomial[i];
+			return Result;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x)
+			{
+				glm_vec4 const Clamped = glm_vec4_clamp(x, _mm_setzero_ps(), _mm_set1_ps(1.0f));
+				glm_vec4 const t = _mm_sqrt_ps(_mm_sqrt_ps(Clamped));
+				glm_vec4 Result = _mm_set1_ps(srgb_encode_polynomial[0]);
+				for(length_t i = 1; i < 6; ++i)
+					Result = glm_vec4_fma(Result, t, _mm_set1_ps(srgb_encode_polynomial[i]));
+
+				glm_vec4 const Linear = _mm_mul_ps(Clamped, _mm_set1_ps(12.92f));
+				glm_vec4 const IsLinear = _mm_cmple_ps(Clamped, _mm_set1_ps(0.0031308f));
+				return _mm_or_ps(_mm_and_ps(IsLinear, Linear), _mm_andnot_ps(IsLinear, Result));
+			}
+#		endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+	};
+
+	struct srgb_decode
+	{
+		GLM_FUNC_QUALIFIER static float call(float x)
+		{
+			float const Clamped = clamp(x, 0.0f, 1.0f);
+			if(Clamped <= 0.04045f)
+				return Clamped * 0.0773993808f;
+
+			float const u = (Clamped + 0.055f) * 0.947867299f;
+			float const s = sqrt(u);
+			float Result = srgb_decode_polynomial[0];
+			for(length_t i = 1; i < 6; ++i)
+				Result = Result * s + srgb_decode_polynomial[i];
+			return u * u * Result;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x)
+			{
+				glm_vec4 const Clamped = glm_vec4_clamp(x, _mm_setzero_ps(), _mm_set1_ps(1.0f));
+				glm_vec4 const u = _mm_mul_ps(_mm_add_ps(Clamped, _mm_set1_ps(0.055f)), _mm_set1_ps(0.947867299f));
+				glm_vec4 const s = _mm_sqrt_ps(u);
+				glm_vec4 Result = _mm_set1_ps(srgb_decode_polynomial[0]);
+				for(length_t i = 1; i < 6; ++i)
+					Result = glm_vec4_fma(Result, s, _mm_set1_ps(srgb_decode_polynomial[i]));
+				Result = _mm_mul_ps(_mm_mul_ps(u, u), Result);
+
+				glm_vec4 const Linear = _mm_mul_ps(Clamped, _mm_set1_ps(0.0773993808f));
+				glm_vec4 const IsLinear = _mm_cmple_ps(Clamped, _mm_set1_ps(0.04045f));
+				return _mm_or_ps(_mm_and_ps(IsLinear, Linear), _mm_andnot_ps(IsLinear, Result));
+			}
+#		endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+	};
+
+	// RGB colors are converted as a stream of components
+	template <typename transferType>
+	struct compute_convertRGB
+	{
+		GLM_FUNC_QUALIFIER static void call(vec3 const * In, vec3 * Out, size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(vec3) == sizeof(float) * 3, "GLM: vec3 arrays must be tightly packed");
+
+			float const * Src = reinterpret_cast<float const *>(In);
+			float * Dst = reinterpret_cast<float *>(Out);
+			size_t const Components = Count * 3;
+
+			size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				for(; i + 4 <= Components; i += 4)
+					_mm_storeu_ps(Dst + i, transferType::call(_mm_loadu_ps(Src + i)));
+#			endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < Components; ++i)
+				Dst[i] = transferType::call(Src[i]);
+		}
+	};
+
+	struct compute_convertLinearToSRGB8
+	{
+		GLM_FUNC_QUALIFIER static void call(vec4 const * In, u8vec4 * Out, size_t Count)
+		{
+			size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				glm_vec4 const AlphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+				glm_vec4 const Scale = _mm_set1_ps(255.0f);
+				glm_vec4 const Half = _mm_set1_ps(0.5f);
+
+				for(; i + 4 <= Count; i += 4)
+				{
+					glm_ivec4 Quantized[4];
+					for(size_t j = 0; j < 4; ++j)
+					{
+						glm_vec4 const Color = _mm_loadu_ps(&In[i + j].x);
+						glm_vec4 const Alpha = glm_vec4_clamp(Color, _mm_setzero_ps(), _mm_set1_ps(1.0f));
+						glm_vec4 const Encoded = _mm_or_ps(_mm_and_ps(AlphaMask, Alpha), _mm_andnot_ps(AlphaMask, srgb_encode::call(Color)));
+						Quantized[j] = _mm_cvttps_epi32(glm_vec4_fma(Encoded, Scale, Half));
+					}
+
+					glm_ivec4 const Packed = _mm_packus_epi16(_mm_packs_epi32(Quantized[0], Quantized[1]), _mm_packs_epi32(Quantized[2], Quantized[3]));
+					_mm_storeu_si128(reinterpret_cast<glm_ivec4 *>(&Out[i]), Packed);
+				}
+#			endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < Count; ++i)
+			{
+				Out[i] = u8vec4(
+					static_cast<uint8>(srgb_encode::call(In[i].r) * 255.0f + 0.5f),
+					static_cast<uint8>(srgb_encode::call(In[i].g) * 255.0f + 0.5f),
+					static_cast<uint8>(srgb_encode::call(In[i].b) * 255.0f + 0.5f),
+					static_cast<uint8>(clamp(In[i].a, 0.0f, 1.0f) * 255.0f + 0.5f));
+			}
+		}
+	};
+
+	struct compute_convertSRGB8ToLinear
+	{
+		GLM_FUNC_QUALIFIER static void call(u8vec4 const * In, vec4 * Out, size_t Count)
+		{
+			float const * Table = srgb_to_linear_table();
+			for(size_t i = 0; i < Count; ++i)
+				Out[i] = vec4(Table[In[i].r], Table[In[i].g], Table[In[i].b], static_cast<float>(In[i].a) * (1.0f / 255.0f));
+		}
+	};
+
+	template <typename computeType, typename inType, typename outType>
+	GLM_FUNC_QUALIFIER void convert_colors(inType const * In, outType * Out, size_t Count)
+	{
+#		if GLM_HAS_OPENMP
+		if(Count >= color_space_parallel_count)
+		{
+			int const Chunks = static_cast<int>((Count + color_space_chunk_count - 1) / color_space_chunk_count);
+
+#			pragma omp parallel for
+			for(int Chunk = 0; Chunk < Chunks; ++Chunk)
+			{
+				size_t const First = color_space_chunk_count * static_cast<size_t>(Chunk);
+				size_t const Size = Count - First < color_space_chunk_count ? Count - First : color_space_chunk_count;
+				computeType::call(In + First, Out + First, Size);
+			}
+			return;
+		}
+#		endif//GLM_HAS_OPENMP
+		computeType::call(In, Out, Count);
+	}
 }//namespace detail
 
 	template <typename T, precision P, template <typename, precision> class vecType>
@@ -72,4 +281,24 @@ namespace detail
 	{
 		return detail::compute_srgbToRgb<T, P, vecType>::call(ColorSRGB, Gamma);
 	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec4 const * ColorLinear, u8vec4 * ColorSRGB, size_t Count)
+	{
+		detail::convert_colors<detail::compute_convertLinearToSRGB8>(ColorLinear, ColorSRGB, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(u8vec4 const * ColorSRGB, vec4 * ColorLinear, size_t Count)
+	{
+		detail::convert_colors<detail::compute_convertSRGB8ToLinear>(ColorSRGB, ColorLinear, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec3 const * ColorLinear, vec3 * ColorSRGB, size_t Count)
+	{
+		detail::convert_colors<detail::compute_convertRGB<detail::srgb_encode> >(ColorLinear, ColorSRGB, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(vec3 const * ColorSRGB, vec3 * ColorLinear, size_t Count)
+	{
+		detail::convert_colors<detail::compute_convertRGB<detail::srgb_decode> >(ColorSRGB, ColorLinear, Count);
+	}
 }//namespace glm
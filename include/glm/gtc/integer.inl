@@ -11,10 +11,51 @@ namespace detail
 		{
 			//Equivalent to return findMSB(vec); but save one function call in ASM with VC
 			//return findMSB(vec);
-			return vecType<T, P>(detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8>::call(vec));
+			return vecType<T, P>(detail::compute_findMSB_vec<T, P, vecType, sizeof(T) * 8, Aligned>::call(vec));
 		}
 	};
 
+	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod_integer
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & a, vecType<T, P> const & b)
+		{
+			return a % b;
+		}
+	};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<int8, P, vecType, Aligned> : public compute_mod_integer<int8, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<int16, P, vecType, Aligned> : public compute_mod_integer<int16, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<int32, P, vecType, Aligned> : public compute_mod_integer<int32, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<int64, P, vecType, Aligned> : public compute_mod_integer<int64, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<uint8, P, vecType, Aligned> : public compute_mod_integer<uint8, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<uint16, P, vecType, Aligned> : public compute_mod_integer<uint16, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<uint32, P, vecType, Aligned> : public compute_mod_integer<uint32, P, vecType, Aligned>
+	{};
+
+	template <precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_mod<uint64, P, vecType, Aligned> : public compute_mod_integer<uint64, P, vecType, Aligned>
+	{};
+
 #	if GLM_HAS_BITSCAN_WINDOWS
 		template <precision P, bool Aligned>
 		struct compute_log2<int, P, tvec4, false, Aligned>
@@ -8,7 +8,7 @@
 namespace glm
 {
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> translate
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> translate
 	(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v
@@ -20,7 +20,7 @@ namespace glm
 	}
 	
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> rotate
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> rotate
 	(
 		tmat4x4<T, P> const & m,
 		T angle,
@@ -28,8 +28,8 @@ namespace glm
 	)
 	{
 		T const a = angle;
-		T const c = cos(a);
-		T const s = sin(a);
+		T const c = detail::cos_constexpr(a);
+		T const s = detail::sin_constexpr(a);
 
 		tvec3<T, P> axis(normalize(v));
 		tvec3<T, P> temp((T(1) - c) * axis);
@@ -56,7 +56,7 @@ namespace glm
 	}
 		
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> rotate_slow
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> rotate_slow
 	(
 		tmat4x4<T, P> const & m,
 		T angle, 
@@ -64,8 +64,8 @@ namespace glm
 	)
 	{
 		T const a = angle;
-		T const c = cos(a);
-		T const s = sin(a);
+		T const c = detail::cos_constexpr(a);
+		T const s = detail::sin_constexpr(a);
 		tmat4x4<T, P> Result;
 
 		tvec3<T, P> axis = normalize(v);
@@ -90,7 +90,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale
 	(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v
@@ -105,7 +105,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> scale_slow
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> scale_slow
 	(
 		tmat4x4<T, P> const & m,
 		tvec3<T, P> const & v
@@ -119,7 +119,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top,
@@ -134,7 +134,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -159,7 +159,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> orthoRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> orthoRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -184,7 +184,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> ortho
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> ortho
 	(
 		T left, T right,
 		T bottom, T top
@@ -200,7 +200,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustum
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustum
 	(
 		T left, T right,
 		T bottom, T top,
@@ -215,7 +215,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumLH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -241,7 +241,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> frustumRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> frustumRH
 	(
 		T left, T right,
 		T bottom, T top,
@@ -267,7 +267,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspective
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspective
 	(
 		T fovy,
 		T aspect,
@@ -283,7 +283,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveRH
 	(
 		T fovy,
 		T aspect,
@@ -292,7 +292,7 @@ namespace glm
 	{
 		assert(abs(aspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
 
-		T const tanHalfFovy = tan(fovy / static_cast<T>(2));
+		T const tanHalfFovy = detail::tan_constexpr(fovy / static_cast<T>(2));
 
 		tmat4x4<T, defaultp> Result(static_cast<T>(0));
 		Result[0][0] = static_cast<T>(1) / (aspect * tanHalfFovy);
@@ -311,7 +311,7 @@ namespace glm
 	}
 	
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveLH
 	(
 		T fovy,
 		T aspect,
@@ -320,7 +320,7 @@ namespace glm
 	{
 		assert(abs(aspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
 
-		T const tanHalfFovy = tan(fovy / static_cast<T>(2));
+		T const tanHalfFovy = detail::tan_constexpr(fovy / static_cast<T>(2));
 		
 		tmat4x4<T, defaultp> Result(static_cast<T>(0));
 		Result[0][0] = static_cast<T>(1) / (aspect * tanHalfFovy);
@@ -339,7 +339,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveFov
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveFov
 	(
 		T fov,
 		T width, T height,
@@ -354,7 +354,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveFovRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveFovRH
 	(
 		T fov,
 		T width, T height,
@@ -366,7 +366,7 @@ namespace glm
 		assert(fov > static_cast<T>(0));
 	
 		T const rad = fov;
-		T const h = glm::cos(static_cast<T>(0.5) * rad) / glm::sin(static_cast<T>(0.5) * rad);
+		T const h = detail::cos_constexpr(static_cast<T>(0.5) * rad) / detail::sin_constexpr(static_cast<T>(0.5) * rad);
 		T const w = h * height / width; ///todo max(width , Height) / min(width , Height)?
 
 		tmat4x4<T, defaultp> Result(static_cast<T>(0));
@@ -386,7 +386,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> perspectiveFovLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> perspectiveFovLH
 	(
 		T fov,
 		T width, T height,
@@ -398,7 +398,7 @@ namespace glm
 		assert(fov > static_cast<T>(0));
 	
 		T const rad = fov;
-		T const h = glm::cos(static_cast<T>(0.5) * rad) / glm::sin(static_cast<T>(0.5) * rad);
+		T const h = detail::cos_constexpr(static_cast<T>(0.5) * rad) / detail::sin_constexpr(static_cast<T>(0.5) * rad);
 		T const w = h * height / width; ///todo max(width , Height) / min(width , Height)?
 
 		tmat4x4<T, defaultp> Result(static_cast<T>(0));
@@ -418,7 +418,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> infinitePerspective
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> infinitePerspective
 	(
 		T fovy,
 		T aspect,
@@ -433,14 +433,14 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> infinitePerspectiveRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> infinitePerspectiveRH
 	(
 		T fovy,
 		T aspect,
 		T zNear
 	)
 	{
-		T const range = tan(fovy / T(2)) * zNear;
+		T const range = detail::tan_constexpr(fovy / T(2)) * zNear;
 		T const left = -range * aspect;
 		T const right = range * aspect;
 		T const bottom = -range;
@@ -456,14 +456,14 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> infinitePerspectiveLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> infinitePerspectiveLH
 	(
 		T fovy,
 		T aspect,
 		T zNear
 	)
 	{
-		T const range = tan(fovy / T(2)) * zNear;
+		T const range = detail::tan_constexpr(fovy / T(2)) * zNear;
 		T const left = -range * aspect;
 		T const right = range * aspect;
 		T const bottom = -range;
@@ -480,7 +480,7 @@ namespace glm
 
 	// Infinite projection matrix: http://www.terathon.com/gdc07_lengyel.pdf
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> tweakedInfinitePerspective
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> tweakedInfinitePerspective
 	(
 		T fovy,
 		T aspect,
@@ -488,7 +488,7 @@ namespace glm
 		T ep
 	)
 	{
-		T const range = tan(fovy / T(2)) * zNear;	
+		T const range = detail::tan_constexpr(fovy / T(2)) * zNear;	
 		T const left = -range * aspect;
 		T const right = range * aspect;
 		T const bottom = -range;
@@ -504,7 +504,7 @@ namespace glm
 	}
 
 	template <typename T>
-	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> tweakedInfinitePerspective
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, defaultp> tweakedInfinitePerspective
 	(
 		T fovy,
 		T aspect,
@@ -515,7 +515,7 @@ namespace glm
 	}
 
 	template <typename T, typename U, precision P>
-	GLM_FUNC_QUALIFIER tvec3<T, P> project
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tvec3<T, P> project
 	(
 		tvec3<T, P> const & obj,
 		tmat4x4<T, P> const & model,
@@ -568,7 +568,7 @@ namespace glm
 	}
 
 	template <typename T, precision P, typename U>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> pickMatrix
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> pickMatrix
 	(
 		tvec2<T, P> const & center,
 		tvec2<T, P> const & delta,
@@ -592,7 +592,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAt
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAt
 	(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
@@ -607,7 +607,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAtRH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtRH
 	(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
@@ -635,7 +635,7 @@ namespace glm
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> lookAtLH
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_CXX14 tmat4x4<T, P> lookAtLH
 	(
 		tvec3<T, P> const & eye,
 		tvec3<T, P> const & center,
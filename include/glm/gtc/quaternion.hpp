@@ -10,6 +10,9 @@
 ///
 /// @brief Defines a templated quaternion type and several quaternion operations.
 ///
+/// Float quaternions with mediump or lowp precision qualifiers evaluate length, normalize, mix and slerp
+/// with the approximations of core_func_exponential and core_func_trigonometric.
+///
 /// <glm/gtc/quaternion.hpp> need to be included to use these functionalities.
 
 #pragma once
@@ -48,8 +51,8 @@ namespace glm
 		/// Return the count of components of a quaternion
 		GLM_FUNC_DECL GLM_CONSTEXPR length_type length() const;
 
-		GLM_FUNC_DECL T & operator[](length_type i);
-		GLM_FUNC_DECL T const & operator[](length_type i) const;
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T & operator[](length_type i);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T const & operator[](length_type i) const;
 
 		// -- Implicit basic constructors --
 
@@ -71,8 +74,8 @@ namespace glm
 
 		/// Explicit conversion operators
 #		if GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
-			GLM_FUNC_DECL explicit operator tmat3x3<T, P>();
-			GLM_FUNC_DECL explicit operator tmat4x4<T, P>();
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit operator tmat3x3<T, P>();
+			GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 explicit operator tmat4x4<T, P>();
 #		endif
 
 		/// Create a quaternion from two normalized axis
@@ -81,91 +84,91 @@ namespace glm
 		/// @param v A second normalized axis
 		/// @see gtc_quaternion
 		/// @see http://lolengine.net/blog/2013/09/18/beautiful-maths-quaternion-from-vectors
-		GLM_FUNC_DECL tquat(tvec3<T, P> const & u, tvec3<T, P> const & v);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat(tvec3<T, P> const & u, tvec3<T, P> const & v);
 
 		/// Build a quaternion from euler angles (pitch, yaw, roll), in radians.
-		GLM_FUNC_DECL GLM_EXPLICIT tquat(tvec3<T, P> const & eulerAngles);
-		GLM_FUNC_DECL GLM_EXPLICIT tquat(tmat3x3<T, P> const & m);
-		GLM_FUNC_DECL GLM_EXPLICIT tquat(tmat4x4<T, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 GLM_EXPLICIT tquat(tvec3<T, P> const & eulerAngles);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 GLM_EXPLICIT tquat(tmat3x3<T, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 GLM_EXPLICIT tquat(tmat4x4<T, P> const & m);
 
 		// -- Unary arithmetic operators --
 
 		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<T, P> const & m) GLM_DEFAULT;
 
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator=(tquat<U, P> const & m);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator=(tquat<U, P> const & m);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator+=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator+=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(tquat<U, P> const & q);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(tquat<U, P> const & q);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator*=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator*=(U s);
 		template <typename U>
-		GLM_FUNC_DECL tquat<T, P> & operator/=(U s);
+		GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> & operator/=(U s);
 	};
 
 	// -- Unary bit operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator+(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator-(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator-(tquat<T, P> const & q);
 
 	// -- Binary operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator+(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, tquat<T, P> const & p);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tquat<T, P> const & q, tvec3<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> operator*(tvec3<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tquat<T, P> const & q, tvec4<T, P> const & v);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec4<T, P> operator*(tvec4<T, P> const & v, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(tquat<T, P> const & q, T const & s);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator*(T const & s, tquat<T, P> const & q);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> operator/(tquat<T, P> const & q, T const & s);
 
 	// -- Boolean operators --
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator==(tquat<T, P> const & q1, tquat<T, P> const & q2);
 
 	template <typename T, precision P>
-	GLM_FUNC_DECL bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 bool operator!=(tquat<T, P> const & q1, tquat<T, P> const & q2);
 
 	/// Returns the length of the quaternion.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL T length(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T length(tquat<T, P> const & q);
 
 	/// Returns the normalized quaternion.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> normalize(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> normalize(tquat<T, P> const & q);
 		
 	/// Returns dot product of q1 and q2, i.e., q1[0] * q2[0] + q1[1] * q2[1] + ...
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P, template <typename, precision> class quatType>
-	GLM_FUNC_DECL T dot(quatType<T, P> const & x, quatType<T, P> const & y);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 T dot(quatType<T, P> const & x, quatType<T, P> const & y);
 
 	/// Spherical linear interpolation of two quaternions.
 	/// The interpolation is oriented and the rotation is performed at constant speed.
@@ -189,7 +192,7 @@ namespace glm
 	/// @tparam T Value type used to build the quaternion. Supported: half, float or double.
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> lerp(tquat<T, P> const & x, tquat<T, P> const & y, T a);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> lerp(tquat<T, P> const & x, tquat<T, P> const & y, T a);
 
 	/// Spherical linear interpolation of two quaternions.
 	/// The interpolation always take the short path and the rotation is performed at constant speed.
@@ -206,13 +209,13 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> conjugate(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> conjugate(tquat<T, P> const & q);
 
 	/// Returns the q inverse.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> inverse(tquat<T, P> const & q);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> inverse(tquat<T, P> const & q);
 
 	/// Rotates a quaternion from a vector of 3 components axis and an angle.
 	/// 
@@ -222,7 +225,7 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> rotate(tquat<T, P> const & q, T const & angle, tvec3<T, P> const & axis);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> rotate(tquat<T, P> const & q, T const & angle, tvec3<T, P> const & axis);
 
 	/// Returns euler angles, pitch as x, yaw as y, roll as z.
 	/// The result is expressed in radians if GLM_FORCE_RADIANS is defined or degrees otherwise.
@@ -253,25 +256,25 @@ namespace glm
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat3x3<T, P> mat3_cast(tquat<T, P> const & x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat3x3<T, P> mat3_cast(tquat<T, P> const & x);
 
 	/// Converts a quaternion to a 4 * 4 matrix.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tmat4x4<T, P> mat4_cast(tquat<T, P> const & x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tmat4x4<T, P> mat4_cast(tquat<T, P> const & x);
 
 	/// Converts a 3 * 3 matrix to a quaternion.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> quat_cast(tmat3x3<T, P> const & x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> quat_cast(tmat3x3<T, P> const & x);
 
 	/// Converts a 4 * 4 matrix to a quaternion.
 	/// 
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> quat_cast(tmat4x4<T, P> const & x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> quat_cast(tmat4x4<T, P> const & x);
 
 	/// Returns the quaternion rotation angle.
 	///
@@ -283,7 +286,7 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tvec3<T, P> axis(tquat<T, P> const & x);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tvec3<T, P> axis(tquat<T, P> const & x);
 
 	/// Build a quaternion from an angle and a normalized axis.
 	///
@@ -292,7 +295,7 @@ namespace glm
 	///
 	/// @see gtc_quaternion
 	template <typename T, precision P>
-	GLM_FUNC_DECL tquat<T, P> angleAxis(T const & angle, tvec3<T, P> const & axis);
+	GLM_FUNC_DECL GLM_CONSTEXPR_CXX14 tquat<T, P> angleAxis(T const & angle, tvec3<T, P> const & axis);
 
 	/// Returns the component-wise comparison result of x < y.
 	/// 
@@ -345,3 +348,28 @@ namespace glm
 } //namespace glm
 
 #include "quaternion.inl"
+
+#if GLM_EXTERN_TEMPLATES
+namespace glm
+{
+#	define GLM_EXTERN_TEMPLATE_QUAT(T) \
+		extern template struct tquat<T, highp>; \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> operator*(tquat<T, highp> const &, tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tvec3<T, highp> operator*(tquat<T, highp> const &, tvec3<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tvec4<T, highp> operator*(tquat<T, highp> const &, tvec4<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> normalize(tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> slerp(tquat<T, highp> const &, tquat<T, highp> const &, T); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> conjugate(tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> inverse(tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tmat3x3<T, highp> mat3_cast(tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tmat4x4<T, highp> mat4_cast(tquat<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> quat_cast(tmat3x3<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> quat_cast(tmat4x4<T, highp> const &); \
+		GLM_EXTERN_TEMPLATE tquat<T, highp> angleAxis(T const &, tvec3<T, highp> const &);
+
+	GLM_EXTERN_TEMPLATE_QUAT(float)
+	GLM_EXTERN_TEMPLATE_QUAT(double)
+
+#	undef GLM_EXTERN_TEMPLATE_QUAT
+}//namespace glm
+#endif//GLM_EXTERN_TEMPLATES
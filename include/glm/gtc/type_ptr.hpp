@@ -29,6 +29,21 @@
 /// glUniformMatrix4fv(uniformMatrixLoc, 1, GL_FALSE, glm::value_ptr(someMatrix));
 /// @endcode
 ///
+/// tstrided_view exposes the elements of an external buffer, for example an attribute of
+/// an interleaved vertex buffer, as references to glm types without copying them.
+///
+/// Example:
+/// @code
+/// struct vertex { glm::vec3 Position; glm::vec3 Normal; glm::vec2 TexCoord; };
+///
+/// glm::tstrided_view<glm::vec3> Normals(&Vertices[0].Normal, sizeof(vertex), VertexCount);
+/// for(std::size_t i = 0; i < Normals.size(); ++i)
+///     Normals[i] = glm::normalize(Normals[i]);
+///
+/// float const * Buffer = MapBuffer();
+/// glm::tstrided_view<glm::vec3 const> Positions = glm::make_vec3_view(Buffer, 8 * sizeof(float), VertexCount);
+/// @endcode
+///
 /// <glm/gtc/type_ptr.hpp> need to be included to use these functionalities.
 
 #pragma once
@@ -48,6 +63,7 @@
 #include "../mat4x3.hpp"
 #include "../mat4x4.hpp"
 #include <cstring>
+#include <iterator>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_type_ptr extension included")
@@ -143,6 +159,121 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL tquat<T, defaultp> make_quat(T const * const ptr);
 
+	/// Random access iterator over the elements of a tstrided_view.
+	/// @see gtc_type_ptr
+	template <typename genType>
+	class tstrided_iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef genType value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef genType * pointer;
+		typedef genType & reference;
+
+		GLM_FUNC_DECL tstrided_iterator();
+		GLM_FUNC_DECL tstrided_iterator(genType * Element, size_t Stride);
+
+		GLM_FUNC_DECL reference operator*() const;
+		GLM_FUNC_DECL pointer operator->() const;
+		GLM_FUNC_DECL reference operator[](difference_type Offset) const;
+
+		GLM_FUNC_DECL tstrided_iterator & operator++();
+		GLM_FUNC_DECL tstrided_iterator operator++(int);
+		GLM_FUNC_DECL tstrided_iterator & operator--();
+		GLM_FUNC_DECL tstrided_iterator operator--(int);
+		GLM_FUNC_DECL tstrided_iterator & operator+=(difference_type Offset);
+		GLM_FUNC_DECL tstrided_iterator & operator-=(difference_type Offset);
+		GLM_FUNC_DECL tstrided_iterator operator+(difference_type Offset) const;
+		GLM_FUNC_DECL tstrided_iterator operator-(difference_type Offset) const;
+		GLM_FUNC_DECL difference_type operator-(tstrided_iterator const & It) const;
+
+		GLM_FUNC_DECL bool operator==(tstrided_iterator const & It) const;
+		GLM_FUNC_DECL bool operator!=(tstrided_iterator const & It) const;
+		GLM_FUNC_DECL bool operator<(tstrided_iterator const & It) const;
+		GLM_FUNC_DECL bool operator>(tstrided_iterator const & It) const;
+		GLM_FUNC_DECL bool operator<=(tstrided_iterator const & It) const;
+		GLM_FUNC_DECL bool operator>=(tstrided_iterator const & It) const;
+
+	private:
+		char * Element;
+		std::ptrdiff_t Stride;
+	};
+
+	/// Non-owning view of Count elements of type genType, each one Stride bytes after the previous one.
+	/// Elements are accessed in place, through genType references: use a const genType for read only views.
+	/// genType is typically a vector type whose components are stored tightly packed in the external buffer.
+	/// @see gtc_type_ptr
+	template <typename genType>
+	class tstrided_view
+	{
+	public:
+		typedef genType value_type;
+		typedef genType & reference;
+		typedef tstrided_iterator<genType> iterator;
+
+		/// Build an empty view.
+		GLM_FUNC_DECL tstrided_view();
+
+		/// @param First Address of the first element.
+		/// @param Stride Distance in bytes between two elements, sizeof(genType) for a contiguous array.
+		/// @param Count Number of elements.
+		GLM_FUNC_DECL tstrided_view(genType * First, size_t Stride, size_t Count);
+
+		/// Build a read only view from a mutable view.
+		template <typename U>
+		GLM_FUNC_DECL tstrided_view(tstrided_view<U> const & View);
+
+		GLM_FUNC_DECL reference operator[](size_t Index) const;
+
+		/// Address of the first element.
+		GLM_FUNC_DECL genType * data() const;
+		/// Distance in bytes between two elements.
+		GLM_FUNC_DECL size_t stride() const;
+		/// Number of elements.
+		GLM_FUNC_DECL size_t size() const;
+		/// Return true if the elements are contiguous, in which case data() can be used as an array.
+		GLM_FUNC_DECL bool contiguous() const;
+
+		GLM_FUNC_DECL iterator begin() const;
+		GLM_FUNC_DECL iterator end() const;
+
+	private:
+		genType * First;
+		size_t Stride;
+		size_t Count;
+	};
+
+	/// Build a view of Count 2 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec2<T, highp> const> make_vec2_view(T const * First, size_t Stride, size_t Count);
+
+	/// Build a view of Count 3 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec3<T, highp> const> make_vec3_view(T const * First, size_t Stride, size_t Count);
+
+	/// Build a view of Count 4 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec4<T, highp> const> make_vec4_view(T const * First, size_t Stride, size_t Count);
+
+	/// Build a mutable view of Count 2 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec2<T, highp> > make_vec2_view(T * First, size_t Stride, size_t Count);
+
+	/// Build a mutable view of Count 3 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec3<T, highp> > make_vec3_view(T * First, size_t Stride, size_t Count);
+
+	/// Build a mutable view of Count 4 components vectors from a pointer to the components of the first one.
+	/// @see gtc_type_ptr
+	template <typename T>
+	GLM_FUNC_DECL tstrided_view<tvec4<T, highp> > make_vec4_view(T * First, size_t Stride, size_t Count);
+
 	/// @}
 }//namespace glm
 
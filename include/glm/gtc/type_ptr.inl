@@ -306,9 +306,8 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER tvec3<T, defaultp> make_vec3(T const * const ptr)
 	{
-		tvec3<T, defaultp> Result;
-		memcpy(value_ptr(Result), ptr, sizeof(tvec3<T, defaultp>));
-		return Result;
+		// Aligned tvec3 may be padded to 4 components
+		return tvec3<T, defaultp>(ptr[0], ptr[1], ptr[2]);
 	}
 
 	/// Build a vector from a pointer.
@@ -336,9 +335,7 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER tmat2x3<T, defaultp> make_mat2x3(T const * const ptr)
 	{
-		tmat2x3<T, defaultp> Result;
-		memcpy(value_ptr(Result), ptr, sizeof(tmat2x3<T, defaultp>));
-		return Result;
+		return tmat2x3<T, defaultp>(make_vec3(ptr + 0), make_vec3(ptr + 3));
 	}
 
 	/// Build a matrix from a pointer.
@@ -366,9 +363,7 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER tmat3x3<T, defaultp> make_mat3x3(T const * const ptr)
 	{
-		tmat3x3<T, defaultp> Result;
-		memcpy(value_ptr(Result), ptr, sizeof(tmat3x3<T, defaultp>));
-		return Result;
+		return tmat3x3<T, defaultp>(make_vec3(ptr + 0), make_vec3(ptr + 3), make_vec3(ptr + 6));
 	}
 
 	//! Build a matrix from a pointer.
@@ -396,9 +391,7 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER tmat4x3<T, defaultp> make_mat4x3(T const * const ptr)
 	{
-		tmat4x3<T, defaultp> Result;
-		memcpy(value_ptr(Result), ptr, sizeof(tmat4x3<T, defaultp>));
-		return Result;
+		return tmat4x3<T, defaultp>(make_vec3(ptr + 0), make_vec3(ptr + 3), make_vec3(ptr + 6), make_vec3(ptr + 9));
 	}
 
 	//! Build a matrix from a pointer.
@@ -445,6 +438,239 @@ namespace glm
 		return Result;
 	}
 
+	// -- tstrided_iterator --
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType>::tstrided_iterator()
+		: Element(NULL)
+		, Stride(0)
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType>::tstrided_iterator(genType * Element, size_t Stride)
+		: Element(reinterpret_cast<char *>(const_cast<void *>(static_cast<void const *>(Element))))
+		, Stride(static_cast<std::ptrdiff_t>(Stride))
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_iterator<genType>::reference tstrided_iterator<genType>::operator*() const
+	{
+		return *reinterpret_cast<genType *>(this->Element);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_iterator<genType>::pointer tstrided_iterator<genType>::operator->() const
+	{
+		return reinterpret_cast<genType *>(this->Element);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_iterator<genType>::reference tstrided_iterator<genType>::operator[](difference_type Offset) const
+	{
+		return *reinterpret_cast<genType *>(this->Element + Offset * this->Stride);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> & tstrided_iterator<genType>::operator++()
+	{
+		this->Element += this->Stride;
+		return *this;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> tstrided_iterator<genType>::operator++(int)
+	{
+		tstrided_iterator Result(*this);
+		this->Element += this->Stride;
+		return Result;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> & tstrided_iterator<genType>::operator--()
+	{
+		this->Element -= this->Stride;
+		return *this;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> tstrided_iterator<genType>::operator--(int)
+	{
+		tstrided_iterator Result(*this);
+		this->Element -= this->Stride;
+		return Result;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> & tstrided_iterator<genType>::operator+=(difference_type Offset)
+	{
+		this->Element += Offset * this->Stride;
+		return *this;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> & tstrided_iterator<genType>::operator-=(difference_type Offset)
+	{
+		this->Element -= Offset * this->Stride;
+		return *this;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> tstrided_iterator<genType>::operator+(difference_type Offset) const
+	{
+		return tstrided_iterator(*this) += Offset;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_iterator<genType> tstrided_iterator<genType>::operator-(difference_type Offset) const
+	{
+		return tstrided_iterator(*this) -= Offset;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_iterator<genType>::difference_type tstrided_iterator<genType>::operator-(tstrided_iterator const & It) const
+	{
+		return this->Stride ? (this->Element - It.Element) / this->Stride : 0;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator==(tstrided_iterator const & It) const
+	{
+		return this->Element == It.Element;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator!=(tstrided_iterator const & It) const
+	{
+		return this->Element != It.Element;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator<(tstrided_iterator const & It) const
+	{
+		return *this - It < 0;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator>(tstrided_iterator const & It) const
+	{
+		return *this - It > 0;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator<=(tstrided_iterator const & It) const
+	{
+		return *this - It <= 0;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_iterator<genType>::operator>=(tstrided_iterator const & It) const
+	{
+		return *this - It >= 0;
+	}
+
+	// -- tstrided_view --
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_view<genType>::tstrided_view()
+		: First(NULL)
+		, Stride(sizeof(genType))
+		, Count(0)
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER tstrided_view<genType>::tstrided_view(genType * First, size_t Stride, size_t Count)
+		: First(First)
+		, Stride(Stride)
+		, Count(Count)
+	{}
+
+	template <typename genType>
+	template <typename U>
+	GLM_FUNC_QUALIFIER tstrided_view<genType>::tstrided_view(tstrided_view<U> const & View)
+		: First(View.data())
+		, Stride(View.stride())
+		, Count(View.size())
+	{}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_view<genType>::reference tstrided_view<genType>::operator[](size_t Index) const
+	{
+		assert(Index < this->Count);
+		return *reinterpret_cast<genType *>(reinterpret_cast<char *>(const_cast<void *>(static_cast<void const *>(this->First))) + Index * this->Stride);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER genType * tstrided_view<genType>::data() const
+	{
+		return this->First;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER size_t tstrided_view<genType>::stride() const
+	{
+		return this->Stride;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER size_t tstrided_view<genType>::size() const
+	{
+		return this->Count;
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool tstrided_view<genType>::contiguous() const
+	{
+		return this->Stride == sizeof(genType);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_view<genType>::iterator tstrided_view<genType>::begin() const
+	{
+		return iterator(this->First, this->Stride);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER typename tstrided_view<genType>::iterator tstrided_view<genType>::end() const
+	{
+		return this->begin() + static_cast<std::ptrdiff_t>(this->Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec2<T, highp> const> make_vec2_view(T const * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec2<T, highp> const>(reinterpret_cast<tvec2<T, highp> const *>(First), Stride, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec3<T, highp> const> make_vec3_view(T const * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec3<T, highp> const>(reinterpret_cast<tvec3<T, highp> const *>(First), Stride, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec4<T, highp> const> make_vec4_view(T const * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec4<T, highp> const>(reinterpret_cast<tvec4<T, highp> const *>(First), Stride, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec2<T, highp> > make_vec2_view(T * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec2<T, highp> >(reinterpret_cast<tvec2<T, highp> *>(First), Stride, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec3<T, highp> > make_vec3_view(T * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec3<T, highp> >(reinterpret_cast<tvec3<T, highp> *>(First), Stride, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tstrided_view<tvec4<T, highp> > make_vec4_view(T * First, size_t Stride, size_t Count)
+	{
+		return tstrided_view<tvec4<T, highp> >(reinterpret_cast<tvec4<T, highp> *>(First), Stride, Count);
+	}
+
 	/// @}
 }//namespace glm
 
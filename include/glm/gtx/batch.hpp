@@ -0,0 +1,85 @@
+/// @ref gtx_batch
+/// @file glm/gtx/batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch GLM_GTX_batch
+/// @ingroup gtx
+///
+/// @brief Apply vector and matrix operations to arrays of values.
+///
+/// Single precision and 32 bits integer arrays are processed with SSE2, AVX or AVX-512 and double precision matrix arrays with AVX or AVX-512,
+/// according to GLM_ARCH or, when GLM_FORCE_RUNTIME_DISPATCH is defined, to the running CPU.
+/// AVX-512 kernels process 4 vectors or 1 matrix per 512 bits register and handle the tail of the arrays with masked loads and stores.
+///
+/// Results may be stored in place of an operand array, but must not partially overlap it.
+/// When GLM_FORCE_FLUSH_DENORMALS is defined, floating point arrays are processed with denormals flushed to zero, see GLM_GTX_float_environment.
+///
+/// <glm/gtx/batch.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "float_environment.hpp"
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch
+	/// @{
+
+	/// Result[i] = a[i] + b[i] for i in [0, Count).
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchAdd(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count);
+
+	/// Result[i] = a[i] - b[i] for i in [0, Count).
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchSub(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count);
+
+	/// Result[i] = a[i] * b[i] for i in [0, Count), component-wise.
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchMul(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count);
+
+	/// Result[i] = a[i] / b[i] for i in [0, Count), component-wise.
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchDiv(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count);
+
+	/// Transform a stream of vectors: Result[i] = m * v[i] for i in [0, Count).
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchMul(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * Result, size_t Count);
+
+	/// Result[i] = a[i] * b[i] for i in [0, Count), matrix products.
+	/// @see gtx_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchMul(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * Result, size_t Count);
+
+	/// Result[i] = uaddCarry(x[i], y[i], Carry[i]) for i in [0, Count).
+	/// Words of multi-word integers are summed in parallel, the carries are then propagated word by word.
+	/// @see gtx_batch
+	GLM_FUNC_DECL void batchUaddCarry(uint const * x, uint const * y, uint * Result, uint * Carry, size_t Count);
+
+	/// Result[i] = usubBorrow(x[i], y[i], Borrow[i]) for i in [0, Count).
+	/// @see gtx_batch
+	GLM_FUNC_DECL void batchUsubBorrow(uint const * x, uint const * y, uint * Result, uint * Borrow, size_t Count);
+
+	/// umulExtended(x[i], y[i], msb[i], lsb[i]) for i in [0, Count), the 64 bits products of multi-word multiplications.
+	/// @see gtx_batch
+	GLM_FUNC_DECL void batchUmulExtended(uint const * x, uint const * y, uint * msb, uint * lsb, size_t Count);
+
+	/// imulExtended(x[i], y[i], msb[i], lsb[i]) for i in [0, Count).
+	/// @see gtx_batch
+	GLM_FUNC_DECL void batchImulExtended(int const * x, int const * y, int * msb, int * lsb, size_t Count);
+
+	/// @}
+}// namespace glm
+
+#include "batch.inl"
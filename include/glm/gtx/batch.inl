@@ -0,0 +1,732 @@
+/// @ref gtx_batch
+/// @file glm/gtx/batch.inl
+
+#include "../simd/matrix.h"
+#include "../simd/integer.h"
+#include "../simd/cpu.h"
+
+namespace glm{
+namespace detail
+{
+	// Select the best kernel of a kernelsType family, whose sse, avx and avx512 members are declared for the instruction sets
+	// of GLM_ARCH and, with GLM_FORCE_RUNTIME_DISPATCH, for the instruction sets selectable at runtime.
+	template <typename kernelsType>
+	GLM_FUNC_QUALIFIER typename kernelsType::kernel batch_select()
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			return &kernelsType::avx512;
+#		else
+#			if GLM_HAS_RUNTIME_DISPATCH_AVX512
+				if(glm_cpu_arch() & GLM_ARCH_AVX512_BIT)
+					return &kernelsType::avx512;
+#			endif
+#			if GLM_HAS_RUNTIME_DISPATCH && !(GLM_ARCH & GLM_ARCH_AVX2_BIT)
+				if(glm_cpu_arch() & GLM_ARCH_AVX2_BIT)
+					return &kernelsType::avx;
+				return &kernelsType::sse;
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				return &kernelsType::avx;
+#			else
+				return &kernelsType::sse;
+#			endif
+#		endif
+	}
+
+	// With runtime dispatch the selection is cached in a function pointer, otherwise it is resolved at compile time.
+	template <typename kernelsType>
+	GLM_FUNC_QUALIFIER typename kernelsType::kernel batch_kernel()
+	{
+#		if GLM_HAS_RUNTIME_DISPATCH
+			static typename kernelsType::kernel const Kernel = batch_select<kernelsType>();
+			return Kernel;
+#		else
+			return batch_select<kernelsType>();
+#		endif
+	}
+
+#	if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256 batch_fma(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_HAS_FMA || (GLM_HAS_RUNTIME_DISPATCH && !(GLM_ARCH & GLM_ARCH_AVX2_BIT))
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256d batch_fma(__m256d a, __m256d b, __m256d c)
+	{
+#		if GLM_HAS_FMA || (GLM_HAS_RUNTIME_DISPATCH && !(GLM_ARCH & GLM_ARCH_AVX2_BIT))
+			return _mm256_fmadd_pd(a, b, c);
+#		else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#		endif
+	}
+#	endif
+
+	// -- Component-wise operators, one overload per register type --
+
+#	define GLM_BATCH_OPERATOR(name, op, ps) \
+	struct name \
+	{ \
+		template <typename genType> \
+		GLM_FUNC_QUALIFIER static genType call(genType const & a, genType const & b){return a op b;} \
+		GLM_BATCH_OPERATOR_SSE(ps) \
+		GLM_BATCH_OPERATOR_AVX(ps) \
+		GLM_BATCH_OPERATOR_AVX512(ps) \
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#		define GLM_BATCH_OPERATOR_SSE(ps) GLM_FUNC_QUALIFIER static __m128 call(__m128 a, __m128 b){return _mm_##ps(a, b);}
+#	else
+#		define GLM_BATCH_OPERATOR_SSE(ps)
+#	endif
+#	if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+#		define GLM_BATCH_OPERATOR_AVX(ps) GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 static __m256 call(__m256 a, __m256 b){return _mm256_##ps(a, b);}
+#	else
+#		define GLM_BATCH_OPERATOR_AVX(ps)
+#	endif
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+#		define GLM_BATCH_OPERATOR_AVX512(ps) GLM_FUNC_QUALIFIER GLM_TARGET_AVX512 static __m512 call(__m512 a, __m512 b){return _mm512_##ps(a, b);}
+#	else
+#		define GLM_BATCH_OPERATOR_AVX512(ps)
+#	endif
+
+	GLM_BATCH_OPERATOR(batch_add, +, add_ps)
+	GLM_BATCH_OPERATOR(batch_sub, -, sub_ps)
+	GLM_BATCH_OPERATOR(batch_mul, *, mul_ps)
+	GLM_BATCH_OPERATOR(batch_div, /, div_ps)
+
+#	undef GLM_BATCH_OPERATOR_AVX512
+#	undef GLM_BATCH_OPERATOR_AVX
+#	undef GLM_BATCH_OPERATOR_SSE
+#	undef GLM_BATCH_OPERATOR
+
+	// -- vec4 operators, arrays of Count vec4 --
+
+	template <typename T, precision P, typename opType>
+	struct compute_batchVec4
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Result[i] = opType::call(a[i], b[i]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <typename opType>
+	struct batch_vec4_kernels
+	{
+		typedef void (*kernel)(float const * a, float const * b, float * Result, size_t Count);
+
+		GLM_FUNC_QUALIFIER static void sse(float const * a, float const * b, float * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 4; i += 4)
+				_mm_storeu_ps(Result + i, opType::call(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		}
+
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		GLM_TARGET_AVX2 static void avx(float const * a, float const * b, float * Result, size_t Count)
+		{
+			size_t i = 0;
+			for(; i + 8 <= Count * 4; i += 8)
+				_mm256_storeu_ps(Result + i, opType::call(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+			if(i < Count * 4)
+				_mm_storeu_ps(Result + i, opType::call(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		}
+#		endif
+
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+		GLM_TARGET_AVX512 static void avx512(float const * a, float const * b, float * Result, size_t Count)
+		{
+			size_t i = 0;
+			for(; i + 16 <= Count * 4; i += 16)
+				_mm512_storeu_ps(Result + i, opType::call(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+
+			// Masked lanes are neither read nor written, b lanes are set to 1 to avoid spurious division by zero flags
+			if(i < Count * 4)
+			{
+				__mmask16 const Mask = static_cast<__mmask16>((1u << (Count * 4 - i)) - 1u);
+				__m512 const A = _mm512_maskz_loadu_ps(Mask, a + i);
+				__m512 const B = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), Mask, b + i);
+				_mm512_mask_storeu_ps(Result + i, Mask, opType::call(A, B));
+			}
+		}
+#		endif
+	};
+
+	template <precision P, typename opType>
+	struct compute_batchVec4<float, P, opType>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<float, P> const * a, tvec4<float, P> const * b, tvec4<float, P> * Result, size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(tvec4<float, P>) == sizeof(float) * 4, "tvec4 is expected to be tightly packed");
+
+			batch_kernel<batch_vec4_kernels<opType> >()(
+				reinterpret_cast<float const *>(a), reinterpret_cast<float const *>(b), reinterpret_cast<float *>(Result), Count);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// -- mat4 * vec4 streams --
+
+	template <typename T, precision P>
+	struct compute_batchTransform
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Result[i] = m * v[i];
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct batch_transform_kernels
+	{
+		typedef void (*kernel)(float const * m, float const * v, float * Result, size_t Count);
+
+		GLM_FUNC_QUALIFIER static void sse(float const * m, float const * v, float * Result, size_t Count)
+		{
+			glm_vec4 const Columns[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+			for(size_t i = 0; i < Count * 4; i += 4)
+				_mm_storeu_ps(Result + i, glm_mat4_mul_vec4(Columns, _mm_loadu_ps(v + i)));
+		}
+
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		// Two vectors per register, each 128 bits lane splatting the components of its vector
+		GLM_TARGET_AVX2 static void avx(float const * m, float const * v, float * Result, size_t Count)
+		{
+			__m256 const C0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 0));
+			__m256 const C1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 4));
+			__m256 const C2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 8));
+			__m256 const C3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m + 12));
+
+			size_t i = 0;
+			for(; i + 8 <= Count * 4; i += 8)
+			{
+				__m256 const V = _mm256_loadu_ps(v + i);
+				__m256 R = _mm256_mul_ps(C3, _mm256_permute_ps(V, _MM_SHUFFLE(3, 3, 3, 3)));
+				R = batch_fma(C2, _mm256_permute_ps(V, _MM_SHUFFLE(2, 2, 2, 2)), R);
+				R = batch_fma(C1, _mm256_permute_ps(V, _MM_SHUFFLE(1, 1, 1, 1)), R);
+				R = batch_fma(C0, _mm256_permute_ps(V, _MM_SHUFFLE(0, 0, 0, 0)), R);
+				_mm256_storeu_ps(Result + i, R);
+			}
+			if(i < Count * 4)
+				sse(m, v + i, Result + i, 1);
+		}
+#		endif
+
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+		// The broadcast, permute, shift, unpack and mul AVX-512 intrinsics of GCC 12 pass _mm512_undefined_* as the unused operand of their masked builtins
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic push
+#			pragma GCC diagnostic ignored "-Wuninitialized"
+#			pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#		endif
+		// Four vectors per register, the last ones loaded and stored with a mask
+		GLM_TARGET_AVX512 static void avx512(float const * m, float const * v, float * Result, size_t Count)
+		{
+			__m512 const C0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 0));
+			__m512 const C1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4));
+			__m512 const C2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+			__m512 const C3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+
+			for(size_t i = 0; i < Count * 4; i += 16)
+			{
+				__mmask16 const Mask = Count * 4 - i >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (Count * 4 - i)) - 1u);
+				__m512 const V = _mm512_maskz_loadu_ps(Mask, v + i);
+				__m512 R = _mm512_mul_ps(C3, _mm512_permute_ps(V, _MM_SHUFFLE(3, 3, 3, 3)));
+				R = _mm512_fmadd_ps(C2, _mm512_permute_ps(V, _MM_SHUFFLE(2, 2, 2, 2)), R);
+				R = _mm512_fmadd_ps(C1, _mm512_permute_ps(V, _MM_SHUFFLE(1, 1, 1, 1)), R);
+				R = _mm512_fmadd_ps(C0, _mm512_permute_ps(V, _MM_SHUFFLE(0, 0, 0, 0)), R);
+				_mm512_mask_storeu_ps(Result + i, Mask, R);
+			}
+		}
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic pop
+#		endif
+#		endif
+	};
+
+	template <precision P>
+	struct compute_batchTransform<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec4<float, P> const * v, tvec4<float, P> * Result, size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(tvec4<float, P>) == sizeof(float) * 4, "tvec4 is expected to be tightly packed");
+
+			batch_kernel<batch_transform_kernels>()(&m[0][0], reinterpret_cast<float const *>(v), reinterpret_cast<float *>(Result), Count);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// -- mat4 * mat4 products --
+
+	template <typename T, precision P>
+	struct compute_batchMat4
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Result[i] = a[i] * b[i];
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <typename T>
+	struct batch_mat4_kernels
+	{};
+
+	// Operands of each product are loaded before its result is stored, so that Result may be a or b.
+	template <>
+	struct batch_mat4_kernels<float>
+	{
+		typedef void (*kernel)(float const * a, float const * b, float * Result, size_t Count);
+
+		GLM_FUNC_QUALIFIER static void sse(float const * a, float const * b, float * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				glm_vec4 const A[4] = {_mm_loadu_ps(a + i + 0), _mm_loadu_ps(a + i + 4), _mm_loadu_ps(a + i + 8), _mm_loadu_ps(a + i + 12)};
+				glm_vec4 const B[4] = {_mm_loadu_ps(b + i + 0), _mm_loadu_ps(b + i + 4), _mm_loadu_ps(b + i + 8), _mm_loadu_ps(b + i + 12)};
+				glm_vec4 R[4];
+				glm_mat4_mul(A, B, R);
+				for(int c = 0; c < 4; ++c)
+					_mm_storeu_ps(Result + i + c * 4, R[c]);
+			}
+		}
+
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		// Two columns of b per register: R[j] = sum(A[k] * B[j][k])
+		GLM_TARGET_AVX2 static void avx(float const * a, float const * b, float * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				__m256 const A0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + i + 0));
+				__m256 const A1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + i + 4));
+				__m256 const A2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + i + 8));
+				__m256 const A3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + i + 12));
+				__m256 const B01 = _mm256_loadu_ps(b + i + 0);
+				__m256 const B23 = _mm256_loadu_ps(b + i + 8);
+
+				__m256 R01 = _mm256_mul_ps(A3, _mm256_permute_ps(B01, _MM_SHUFFLE(3, 3, 3, 3)));
+				R01 = batch_fma(A2, _mm256_permute_ps(B01, _MM_SHUFFLE(2, 2, 2, 2)), R01);
+				R01 = batch_fma(A1, _mm256_permute_ps(B01, _MM_SHUFFLE(1, 1, 1, 1)), R01);
+				R01 = batch_fma(A0, _mm256_permute_ps(B01, _MM_SHUFFLE(0, 0, 0, 0)), R01);
+
+				__m256 R23 = _mm256_mul_ps(A3, _mm256_permute_ps(B23, _MM_SHUFFLE(3, 3, 3, 3)));
+				R23 = batch_fma(A2, _mm256_permute_ps(B23, _MM_SHUFFLE(2, 2, 2, 2)), R23);
+				R23 = batch_fma(A1, _mm256_permute_ps(B23, _MM_SHUFFLE(1, 1, 1, 1)), R23);
+				R23 = batch_fma(A0, _mm256_permute_ps(B23, _MM_SHUFFLE(0, 0, 0, 0)), R23);
+
+				_mm256_storeu_ps(Result + i + 0, R01);
+				_mm256_storeu_ps(Result + i + 8, R23);
+			}
+		}
+#		endif
+
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic push
+#			pragma GCC diagnostic ignored "-Wuninitialized"
+#			pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#		endif
+		// A whole matrix per register
+		GLM_TARGET_AVX512 static void avx512(float const * a, float const * b, float * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				__m512 const B = _mm512_loadu_ps(b + i);
+				__m512 R = _mm512_mul_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + i + 12)), _mm512_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3)));
+				R = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + i + 8)), _mm512_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2)), R);
+				R = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + i + 4)), _mm512_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1)), R);
+				R = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + i + 0)), _mm512_permute_ps(B, _MM_SHUFFLE(0, 0, 0, 0)), R);
+				_mm512_storeu_ps(Result + i, R);
+			}
+		}
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic pop
+#		endif
+#		endif
+	};
+
+	template <>
+	struct batch_mat4_kernels<double>
+	{
+		typedef void (*kernel)(double const * a, double const * b, double * Result, size_t Count);
+
+		GLM_FUNC_QUALIFIER static void sse(double const * a, double const * b, double * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				double R[16];
+				for(int c = 0; c < 4; ++c)
+				for(int r = 0; r < 4; ++r)
+					R[c * 4 + r] = a[i + r] * b[i + c * 4] + a[i + 4 + r] * b[i + c * 4 + 1] + a[i + 8 + r] * b[i + c * 4 + 2] + a[i + 12 + r] * b[i + c * 4 + 3];
+				for(int j = 0; j < 16; ++j)
+					Result[i + j] = R[j];
+			}
+		}
+
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		// One column per register: R[j] = sum(A[k] * B[j][k])
+		GLM_TARGET_AVX2 static void avx(double const * a, double const * b, double * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				__m256d const A0 = _mm256_loadu_pd(a + i + 0);
+				__m256d const A1 = _mm256_loadu_pd(a + i + 4);
+				__m256d const A2 = _mm256_loadu_pd(a + i + 8);
+				__m256d const A3 = _mm256_loadu_pd(a + i + 12);
+
+				__m256d R[4];
+				for(int c = 0; c < 4; ++c)
+				{
+					double const * B = b + i + c * 4;
+					R[c] = _mm256_mul_pd(A3, _mm256_broadcast_sd(B + 3));
+					R[c] = batch_fma(A2, _mm256_broadcast_sd(B + 2), R[c]);
+					R[c] = batch_fma(A1, _mm256_broadcast_sd(B + 1), R[c]);
+					R[c] = batch_fma(A0, _mm256_broadcast_sd(B + 0), R[c]);
+				}
+				for(int c = 0; c < 4; ++c)
+					_mm256_storeu_pd(Result + i + c * 4, R[c]);
+			}
+		}
+#		endif
+
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic push
+#			pragma GCC diagnostic ignored "-Wuninitialized"
+#			pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#		endif
+		// Two columns per register, each 256 bits half splatting the components of its column of b
+		GLM_TARGET_AVX512 static void avx512(double const * a, double const * b, double * Result, size_t Count)
+		{
+			for(size_t i = 0; i < Count * 16; i += 16)
+			{
+				__m512d const A0 = _mm512_broadcast_f64x4(_mm256_loadu_pd(a + i + 0));
+				__m512d const A1 = _mm512_broadcast_f64x4(_mm256_loadu_pd(a + i + 4));
+				__m512d const A2 = _mm512_broadcast_f64x4(_mm256_loadu_pd(a + i + 8));
+				__m512d const A3 = _mm512_broadcast_f64x4(_mm256_loadu_pd(a + i + 12));
+				__m512d const B01 = _mm512_loadu_pd(b + i + 0);
+				__m512d const B23 = _mm512_loadu_pd(b + i + 8);
+
+				__m512d R01 = _mm512_mul_pd(A3, _mm512_permutex_pd(B01, _MM_SHUFFLE(3, 3, 3, 3)));
+				R01 = _mm512_fmadd_pd(A2, _mm512_permutex_pd(B01, _MM_SHUFFLE(2, 2, 2, 2)), R01);
+				R01 = _mm512_fmadd_pd(A1, _mm512_permutex_pd(B01, _MM_SHUFFLE(1, 1, 1, 1)), R01);
+				R01 = _mm512_fmadd_pd(A0, _mm512_permutex_pd(B01, _MM_SHUFFLE(0, 0, 0, 0)), R01);
+
+				__m512d R23 = _mm512_mul_pd(A3, _mm512_permutex_pd(B23, _MM_SHUFFLE(3, 3, 3, 3)));
+				R23 = _mm512_fmadd_pd(A2, _mm512_permutex_pd(B23, _MM_SHUFFLE(2, 2, 2, 2)), R23);
+				R23 = _mm512_fmadd_pd(A1, _mm512_permutex_pd(B23, _MM_SHUFFLE(1, 1, 1, 1)), R23);
+				R23 = _mm512_fmadd_pd(A0, _mm512_permutex_pd(B23, _MM_SHUFFLE(0, 0, 0, 0)), R23);
+
+				_mm512_storeu_pd(Result + i + 0, R01);
+				_mm512_storeu_pd(Result + i + 8, R23);
+			}
+		}
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic pop
+#		endif
+#		endif
+	};
+
+	template <typename T, precision P>
+	struct compute_batchMat4Simd
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * Result, size_t Count)
+		{
+			GLM_STATIC_ASSERT(sizeof(tmat4x4<T, P>) == sizeof(T) * 16, "tmat4x4 is expected to be tightly packed");
+
+			batch_kernel<batch_mat4_kernels<T> >()(
+				reinterpret_cast<T const *>(a), reinterpret_cast<T const *>(b), reinterpret_cast<T *>(Result), Count);
+		}
+	};
+
+	template <precision P>
+	struct compute_batchMat4<float, P> : public compute_batchMat4Simd<float, P>
+	{};
+
+	template <precision P>
+	struct compute_batchMat4<double, P> : public compute_batchMat4Simd<double, P>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// -- Extended integer arithmetic, arrays of Count 32 bits integers with two results each --
+
+	// Each operator computes Result0 and Result1 in the order of the outputs of its GLSL function
+	struct batch_uadd_carry
+	{
+		GLM_FUNC_QUALIFIER static void call(uint x, uint y, uint & Sum, uint & Carry){Sum = uaddCarry(x, y, Carry);}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static void call(__m128i x, __m128i y, __m128i & Sum, __m128i & Carry){Sum = glm_uvec4_add_carry(x, y, &Carry);}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 static void call(__m256i x, __m256i y, __m256i & Sum, __m256i & Carry)
+		{
+			Sum = _mm256_add_epi32(x, y);
+			Carry = _mm256_add_epi32(_mm256_cmpeq_epi32(_mm256_max_epu32(x, Sum), Sum), _mm256_set1_epi32(1));
+		}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX512 static void call(__m512i x, __m512i y, __m512i & Sum, __m512i & Carry)
+		{
+			Sum = _mm512_add_epi32(x, y);
+			Carry = _mm512_maskz_mov_epi32(_mm512_cmplt_epu32_mask(Sum, x), _mm512_set1_epi32(1));
+		}
+#		endif
+	};
+
+	struct batch_usub_borrow
+	{
+		GLM_FUNC_QUALIFIER static void call(uint x, uint y, uint & Diff, uint & Borrow){Diff = usubBorrow(x, y, Borrow);}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static void call(__m128i x, __m128i y, __m128i & Diff, __m128i & Borrow){Diff = glm_uvec4_sub_borrow(x, y, &Borrow);}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 static void call(__m256i x, __m256i y, __m256i & Diff, __m256i & Borrow)
+		{
+			Borrow = _mm256_add_epi32(_mm256_cmpeq_epi32(_mm256_max_epu32(x, y), x), _mm256_set1_epi32(1));
+			Diff = _mm256_sub_epi32(x, y);
+		}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX512 static void call(__m512i x, __m512i y, __m512i & Diff, __m512i & Borrow)
+		{
+			Borrow = _mm512_maskz_mov_epi32(_mm512_cmplt_epu32_mask(x, y), _mm512_set1_epi32(1));
+			Diff = _mm512_sub_epi32(x, y);
+		}
+#		endif
+	};
+
+	// The products of the even and odd lanes are interleaved back within each 128 bits lane, as glm_uvec4_mul_extended
+	struct batch_umul_extended
+	{
+		GLM_FUNC_QUALIFIER static void call(uint x, uint y, uint & msb, uint & lsb){umulExtended(x, y, msb, lsb);}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static void call(__m128i x, __m128i y, __m128i & msb, __m128i & lsb){glm_uvec4_mul_extended(x, y, &msb, &lsb);}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 static void call(__m256i x, __m256i y, __m256i & msb, __m256i & lsb)
+		{
+			__m256i const mul0 = _mm256_mul_epu32(x, y);
+			__m256i const mul1 = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32));
+			__m256i const unp0 = _mm256_unpacklo_epi32(mul0, mul1);
+			__m256i const unp1 = _mm256_unpackhi_epi32(mul0, mul1);
+			lsb = _mm256_unpacklo_epi64(unp0, unp1);
+			msb = _mm256_unpackhi_epi64(unp0, unp1);
+		}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic push
+#			pragma GCC diagnostic ignored "-Wuninitialized"
+#			pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#		endif
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX512 static void call(__m512i x, __m512i y, __m512i & msb, __m512i & lsb)
+		{
+			__m512i const mul0 = _mm512_mul_epu32(x, y);
+			__m512i const mul1 = _mm512_mul_epu32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32));
+			__m512i const unp0 = _mm512_unpacklo_epi32(mul0, mul1);
+			__m512i const unp1 = _mm512_unpackhi_epi32(mul0, mul1);
+			lsb = _mm512_unpacklo_epi64(unp0, unp1);
+			msb = _mm512_unpackhi_epi64(unp0, unp1);
+		}
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic pop
+#		endif
+#		endif
+	};
+
+	struct batch_imul_extended
+	{
+		GLM_FUNC_QUALIFIER static void call(int x, int y, int & msb, int & lsb){imulExtended(x, y, msb, lsb);}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static void call(__m128i x, __m128i y, __m128i & msb, __m128i & lsb){glm_ivec4_mul_extended(x, y, &msb, &lsb);}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 static void call(__m256i x, __m256i y, __m256i & msb, __m256i & lsb)
+		{
+			__m256i const mul0 = _mm256_mul_epi32(x, y);
+			__m256i const mul1 = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32));
+			__m256i const unp0 = _mm256_unpacklo_epi32(mul0, mul1);
+			__m256i const unp1 = _mm256_unpackhi_epi32(mul0, mul1);
+			lsb = _mm256_unpacklo_epi64(unp0, unp1);
+			msb = _mm256_unpackhi_epi64(unp0, unp1);
+		}
+#		endif
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic push
+#			pragma GCC diagnostic ignored "-Wuninitialized"
+#			pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#		endif
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX512 static void call(__m512i x, __m512i y, __m512i & msb, __m512i & lsb)
+		{
+			__m512i const mul0 = _mm512_mul_epi32(x, y);
+			__m512i const mul1 = _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32));
+			__m512i const unp0 = _mm512_unpacklo_epi32(mul0, mul1);
+			__m512i const unp1 = _mm512_unpackhi_epi32(mul0, mul1);
+			lsb = _mm512_unpacklo_epi64(unp0, unp1);
+			msb = _mm512_unpackhi_epi64(unp0, unp1);
+		}
+#		if GLM_COMPILER & GLM_COMPILER_GCC
+#			pragma GCC diagnostic pop
+#		endif
+#		endif
+	};
+
+	template <typename T, typename opType>
+	struct compute_batchExtended
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T * Result0, T * Result1, size_t Count)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				opType::call(x[i], y[i], Result0[i], Result1[i]);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <typename T, typename opType>
+	struct batch_extended_kernels
+	{
+		typedef void (*kernel)(T const * x, T const * y, T * Result0, T * Result1, size_t Count);
+
+		GLM_FUNC_QUALIFIER static void sse(T const * x, T const * y, T * Result0, T * Result1, size_t Count)
+		{
+			size_t i = 0;
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m128i R0, R1;
+				opType::call(_mm_loadu_si128(reinterpret_cast<__m128i const *>(x + i)), _mm_loadu_si128(reinterpret_cast<__m128i const *>(y + i)), R0, R1);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Result0 + i), R0);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Result1 + i), R1);
+			}
+			for(; i < Count; ++i)
+				opType::call(x[i], y[i], Result0[i], Result1[i]);
+		}
+
+#		if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+		// 256 bits integer instructions are AVX2, AVX only builds keep the SSE2 kernel
+		GLM_TARGET_AVX2 static void avx(T const * x, T const * y, T * Result0, T * Result1, size_t Count)
+		{
+			size_t i = 0;
+#			if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+				for(; i + 8 <= Count; i += 8)
+				{
+					__m256i R0, R1;
+					opType::call(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(x + i)), _mm256_loadu_si256(reinterpret_cast<__m256i const *>(y + i)), R0, R1);
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(Result0 + i), R0);
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(Result1 + i), R1);
+				}
+#			endif
+			sse(x + i, y + i, Result0 + i, Result1 + i, Count - i);
+		}
+#		endif
+
+#		if (GLM_ARCH & GLM_ARCH_AVX512_BIT) || GLM_HAS_RUNTIME_DISPATCH_AVX512
+		GLM_TARGET_AVX512 static void avx512(T const * x, T const * y, T * Result0, T * Result1, size_t Count)
+		{
+			for(size_t i = 0; i < Count; i += 16)
+			{
+				__mmask16 const Mask = Count - i >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (Count - i)) - 1u);
+				__m512i R0, R1;
+				opType::call(_mm512_maskz_loadu_epi32(Mask, x + i), _mm512_maskz_loadu_epi32(Mask, y + i), R0, R1);
+				_mm512_mask_storeu_epi32(Result0 + i, Mask, R0);
+				_mm512_mask_storeu_epi32(Result1 + i, Mask, R1);
+			}
+		}
+#		endif
+	};
+
+	template <typename T, typename opType>
+	struct compute_batchExtendedSimd
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T * Result0, T * Result1, size_t Count)
+		{
+			batch_kernel<batch_extended_kernels<T, opType> >()(x, y, Result0, Result1, Count);
+		}
+	};
+
+	template <>
+	struct compute_batchExtended<uint, batch_uadd_carry> : public compute_batchExtendedSimd<uint, batch_uadd_carry>
+	{};
+
+	template <>
+	struct compute_batchExtended<uint, batch_usub_borrow> : public compute_batchExtendedSimd<uint, batch_usub_borrow>
+	{};
+
+	template <>
+	struct compute_batchExtended<uint, batch_umul_extended> : public compute_batchExtendedSimd<uint, batch_umul_extended>
+	{};
+
+	template <>
+	struct compute_batchExtended<int, batch_imul_extended> : public compute_batchExtendedSimd<int, batch_imul_extended>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchAdd(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchVec4<T, P, detail::batch_add>::call(a, b, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchSub(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchVec4<T, P, detail::batch_sub>::call(a, b, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchMul(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchVec4<T, P, detail::batch_mul>::call(a, b, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchDiv(tvec4<T, P> const * a, tvec4<T, P> const * b, tvec4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchVec4<T, P, detail::batch_div>::call(a, b, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchMul(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchTransform<T, P>::call(m, v, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchMul(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * Result, size_t Count)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_batchMat4<T, P>::call(a, b, Result, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batchUaddCarry(uint const * x, uint const * y, uint * Result, uint * Carry, size_t Count)
+	{
+		detail::compute_batchExtended<uint, detail::batch_uadd_carry>::call(x, y, Result, Carry, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batchUsubBorrow(uint const * x, uint const * y, uint * Result, uint * Borrow, size_t Count)
+	{
+		detail::compute_batchExtended<uint, detail::batch_usub_borrow>::call(x, y, Result, Borrow, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batchUmulExtended(uint const * x, uint const * y, uint * msb, uint * lsb, size_t Count)
+	{
+		detail::compute_batchExtended<uint, detail::batch_umul_extended>::call(x, y, msb, lsb, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batchImulExtended(int const * x, int const * y, int * msb, int * lsb, size_t Count)
+	{
+		detail::compute_batchExtended<int, detail::batch_imul_extended>::call(x, y, msb, lsb, Count);
+	}
+}//namespace glm
@@ -0,0 +1,86 @@
+/// @ref gtx_divider
+/// @file glm/gtx/divider.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_divider GLM_GTX_divider
+/// @ingroup gtx
+///
+/// @brief Divide 32 bits integer scalars and vectors by a runtime invariant divisor with a multiplication and shifts.
+///
+/// A divider precomputes a fixed point reciprocal of its divisor once, following the algorithms of libdivide,
+/// so that each following division costs a high multiplication, an addition and shifts instead of a hardware division.
+/// Aligned ivec4 and uvec4 are divided with SSE2 in a few instructions.
+/// Quotients are truncated toward zero and remainders have the sign of the dividend, as the / and % operators.
+///
+/// <glm/gtx/divider.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_divider extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_divider
+	/// @{
+
+	/// Reciprocal of a 32 bits integer divisor.
+	/// @tparam T int or uint
+	/// @see gtx_divider
+	template <typename T>
+	struct tdivider
+	{
+		typedef T value_type;
+
+		/// @param Value Divisor, must not be 0.
+		GLM_FUNC_DECL explicit tdivider(T Value);
+
+		/// Divisor the reciprocal was computed for.
+		T Divisor;
+		/// Fixed point reciprocal, 0 for powers of two.
+		T Magic;
+		/// Right shift applied to the high product.
+		int Shift;
+		/// Whether the reciprocal needs 33 bits, the dividend is added back to the high product.
+		bool Add;
+		/// Whether the divisor is negative.
+		bool Negative;
+	};
+
+	/// Divider of signed integers.
+	/// @see gtx_divider
+	typedef tdivider<int>		idivider;
+
+	/// Divider of unsigned integers.
+	/// @see gtx_divider
+	typedef tdivider<uint>		udivider;
+
+	/// Quotient of x by the divisor of d, truncated toward zero.
+	/// @see gtx_divider
+	template <typename T>
+	GLM_FUNC_DECL T operator/(T x, tdivider<T> const & d);
+
+	/// Component wise quotients of x by the divisor of d, truncated toward zero.
+	/// @see gtx_divider
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<T, P> operator/(vecType<T, P> const & x, tdivider<T> const & d);
+
+	/// Remainder of x by the divisor of d, with the sign of x.
+	/// @see gtx_divider
+	template <typename T>
+	GLM_FUNC_DECL T operator%(T x, tdivider<T> const & d);
+
+	/// Component wise remainders of x by the divisor of d, with the signs of x.
+	/// @see gtx_divider
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<T, P> operator%(vecType<T, P> const & x, tdivider<T> const & d);
+
+	/// @}
+}//namespace glm
+
+#include "divider.inl"
@@ -0,0 +1,211 @@
+/// @ref gtx_divider
+/// @file glm/gtx/divider.inl
+
+#include "../simd/integer.h"
+
+namespace glm{
+namespace detail
+{
+	template <typename T>
+	struct compute_divider
+	{};
+
+	template <>
+	struct compute_divider<uint32>
+	{
+		GLM_FUNC_QUALIFIER static void gen(tdivider<uint32> & d)
+		{
+			int const Log2 = findMSB(d.Divisor);
+
+			d.Magic = 0;
+			d.Shift = Log2;
+			d.Add = false;
+			d.Negative = false;
+
+			if((d.Divisor & (d.Divisor - 1)) == 0)
+				return;
+
+			// 2^(32 + Log2) / Divisor fits in 32 bits as Divisor > 2^Log2
+			uint64 const Dividend = static_cast<uint64>(1) << (32 + Log2);
+			uint32 Magic = static_cast<uint32>(Dividend / d.Divisor);
+			uint32 const Rem = static_cast<uint32>(Dividend % d.Divisor);
+
+			if(d.Divisor - Rem >= (static_cast<uint32>(1) << Log2))
+			{
+				// The 33 bits reciprocal 2^(33 + Log2) / Divisor, its top bit is implied by Add
+				uint32 const TwiceRem = Rem + Rem;
+				Magic += Magic;
+				if(TwiceRem >= d.Divisor || TwiceRem < Rem)
+					Magic += 1;
+				d.Add = true;
+			}
+			d.Magic = Magic + 1;
+		}
+
+		GLM_FUNC_QUALIFIER static uint32 call(uint32 x, tdivider<uint32> const & d)
+		{
+			if(d.Magic == 0)
+				return x >> d.Shift;
+
+			uint32 const High = static_cast<uint32>((static_cast<uint64>(d.Magic) * x) >> 32);
+			if(d.Add)
+				return (((x - High) >> 1) + High) >> d.Shift;
+			return High >> d.Shift;
+		}
+	};
+
+	template <>
+	struct compute_divider<int32>
+	{
+		GLM_FUNC_QUALIFIER static void gen(tdivider<int32> & d)
+		{
+			uint32 const AbsDivisor = d.Divisor < 0 ? 0u - static_cast<uint32>(d.Divisor) : static_cast<uint32>(d.Divisor);
+			int const Log2 = findMSB(AbsDivisor);
+
+			d.Magic = 0;
+			d.Shift = Log2;
+			d.Add = false;
+			d.Negative = d.Divisor < 0;
+
+			if((AbsDivisor & (AbsDivisor - 1)) == 0)
+				return;
+
+			// 2^(31 + Log2) / |Divisor| fits in 32 bits as |Divisor| > 2^Log2
+			uint64 const Dividend = static_cast<uint64>(1) << (31 + Log2);
+			uint32 Magic = static_cast<uint32>(Dividend / AbsDivisor);
+			uint32 const Rem = static_cast<uint32>(Dividend % AbsDivisor);
+
+			if(AbsDivisor - Rem < (static_cast<uint32>(1) << Log2))
+				d.Shift = Log2 - 1;
+			else
+			{
+				// The reciprocal 2^(32 + Log2) / |Divisor| overflows int32, the dividend is added back to the high product
+				uint32 const TwiceRem = Rem + Rem;
+				Magic += Magic;
+				if(TwiceRem >= AbsDivisor || TwiceRem < Rem)
+					Magic += 1;
+				d.Add = true;
+			}
+			Magic += 1;
+			d.Magic = static_cast<int32>(d.Negative ? 0u - Magic : Magic);
+		}
+
+		GLM_FUNC_QUALIFIER static int32 call(int32 x, tdivider<int32> const & d)
+		{
+			uint32 const Sign = d.Negative ? ~0u : 0u;
+
+			if(d.Magic == 0)
+			{
+				// Bias negative dividends by Divisor - 1 so that the arithmetic shift rounds toward zero
+				uint32 const Mask = (static_cast<uint32>(1) << d.Shift) - 1u;
+				uint32 const Biased = static_cast<uint32>(x) + (static_cast<uint32>(x >> 31) & Mask);
+				int32 const Quotient = static_cast<int32>(Biased) >> d.Shift;
+				return static_cast<int32>((static_cast<uint32>(Quotient) ^ Sign) - Sign);
+			}
+
+			uint32 High = static_cast<uint32>((static_cast<int64>(d.Magic) * x) >> 32);
+			if(d.Add)
+				High += (static_cast<uint32>(x) ^ Sign) - Sign;
+			int32 const Quotient = static_cast<int32>(High) >> d.Shift;
+			return Quotient + (Quotient < 0 ? 1 : 0);
+		}
+	};
+
+	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
+	struct compute_divide_divider
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x, tdivider<T> const & d)
+		{
+			vecType<T, P> Result(uninitialize);
+			for(length_t i = 0; i < x.length(); ++i)
+				Result[i] = compute_divider<T>::call(x[i], d);
+			return Result;
+		}
+	};
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+	template <precision P>
+	struct compute_divide_divider<uint32, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<uint32, P> call(tvec4<uint32, P> const & x, tdivider<uint32> const & d)
+		{
+			glm_uvec4 const shf0 = _mm_cvtsi32_si128(d.Shift);
+
+			tvec4<uint32, P> Result(uninitialize);
+			if(d.Magic == 0)
+				Result.data = _mm_srl_epi32(x.data, shf0);
+			else
+			{
+				glm_uvec4 const hig0 = glm_uvec4_mulhi(x.data, _mm_set1_epi32(static_cast<int>(d.Magic)));
+				glm_uvec4 const add0 = d.Add ? _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(x.data, hig0), 1), hig0) : hig0;
+				Result.data = _mm_srl_epi32(add0, shf0);
+			}
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_divide_divider<int32, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<int32, P> call(tvec4<int32, P> const & x, tdivider<int32> const & d)
+		{
+			glm_ivec4 const shf0 = _mm_cvtsi32_si128(d.Shift);
+			glm_ivec4 const sgn0 = _mm_set1_epi32(d.Negative ? -1 : 0);
+
+			glm_ivec4 quo0;
+			if(d.Magic == 0)
+			{
+				glm_ivec4 const msk0 = _mm_set1_epi32(static_cast<int>((static_cast<uint32>(1) << d.Shift) - 1u));
+				glm_ivec4 const add0 = _mm_add_epi32(x.data, _mm_and_si128(_mm_srai_epi32(x.data, 31), msk0));
+				quo0 = _mm_sub_epi32(_mm_xor_si128(_mm_sra_epi32(add0, shf0), sgn0), sgn0);
+			}
+			else
+			{
+				glm_ivec4 const hig0 = glm_ivec4_mulhi(x.data, _mm_set1_epi32(d.Magic));
+				glm_ivec4 const add0 = d.Add ? _mm_add_epi32(hig0, _mm_sub_epi32(_mm_xor_si128(x.data, sgn0), sgn0)) : hig0;
+				glm_ivec4 const sra0 = _mm_sra_epi32(add0, shf0);
+				quo0 = _mm_sub_epi32(sra0, _mm_srai_epi32(sra0, 31));
+			}
+
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = quo0;
+			return Result;
+		}
+	};
+#	endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tdivider<T>::tdivider(T Value) :
+		Divisor(Value)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_integer && sizeof(T) == 4, "'tdivider' only accept 32 bits integer divisors");
+		assert(Value != T(0));
+
+		detail::compute_divider<T>::gen(*this);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T operator/(T x, tdivider<T> const & d)
+	{
+		return detail::compute_divider<T>::call(x, d);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> operator/(vecType<T, P> const & x, tdivider<T> const & d)
+	{
+		return detail::compute_divide_divider<T, P, vecType, detail::is_aligned<P>::value>::call(x, d);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T operator%(T x, tdivider<T> const & d)
+	{
+		return x - (x / d) * d.Divisor;
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> operator%(vecType<T, P> const & x, tdivider<T> const & d)
+	{
+		return x - (x / d) * d.Divisor;
+	}
+}//namespace glm
@@ -0,0 +1,193 @@
+/// @ref gtx_expression
+/// @file glm/gtx/expression.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_expression GLM_GTX_expression
+/// @ingroup gtx
+///
+/// @brief Evaluate four components vector expressions in a single pass without intermediate vectors.
+///
+/// glm::expr wraps a vector or an array of vectors into a lazy expression. Adding, subtracting, multiplying
+/// and dividing expressions, vectors and scalars, and multiplying a 4 * 4 matrix by an expression, builds
+/// an expression tree instead of computing intermediate vectors. The tree is evaluated when converted to a vector
+/// or, for arrays, by glm::evaluate in a single loop over the elements.
+/// Single precision expressions are evaluated with SSE2 and products feeding an addition or a subtraction are
+/// contracted into fused multiply-add instructions when GLM_ARCH includes AVX2 and the compiler enables FMA (GLM_HAS_FMA).
+/// The expression nodes must be inlined to be fused, like the core operators they replace.
+///
+/// Expressions hold copies of the vectors and matrices and pointers to the arrays they were built from.
+///
+/// <glm/gtx/expression.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "float_environment.hpp"
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_expression extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct expr_vec4;
+
+	template <typename T, precision P>
+	struct expr_array;
+
+	template <typename T>
+	struct expr_scalar;
+
+	template <typename L, typename R, typename op>
+	struct expr_binary;
+
+	template <typename E>
+	struct expr_negate;
+
+	template <typename T, typename E>
+	struct expr_mat4_mul;
+
+	struct expr_add;
+	struct expr_sub;
+	struct expr_mul;
+	struct expr_div;
+}//namespace detail
+
+	/// @addtogroup gtx_expression
+	/// @{
+
+	/// Lazy four components vector expression.
+	/// @tparam E Expression tree node
+	/// @see gtx_expression
+	template <typename E>
+	struct texpr
+	{
+		typedef typename E::value_type value_type;
+
+		GLM_FUNC_DECL explicit texpr(E const & Root);
+
+		/// Evaluate the expression.
+		template <precision P>
+		GLM_FUNC_DECL operator tvec4<value_type, P>() const;
+
+		E Node;
+	};
+
+	/// Expression of a vector.
+	/// @see gtx_expression
+	template <typename T, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_vec4<T, P> > expr(tvec4<T, P> const & v);
+
+	/// Expression of the i-th element of an array of vectors, evaluated for each element by glm::evaluate.
+	/// @see gtx_expression
+	template <typename T, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_array<T, P> > expr(tvec4<T, P> const * Array);
+
+	/// Evaluate an expression.
+	/// @see gtx_expression
+	template <typename E>
+	GLM_FUNC_DECL tvec4<typename E::value_type, defaultp> evaluate(texpr<E> const & Expression);
+
+	/// Result[i] = Expression evaluated for the i-th elements of its arrays, for i in [0, Count).
+	/// Result may be one of the arrays of the expression, but must not partially overlap them.
+	/// @see gtx_expression
+	template <typename T, precision P, typename E>
+	GLM_FUNC_DECL void evaluate(tvec4<T, P> * Result, size_t Count, texpr<E> const & Expression);
+
+	/// @see gtx_expression
+	template <typename E>
+	GLM_FUNC_DECL texpr<detail::expr_negate<E> > operator-(texpr<E> const & a);
+
+	/// @see gtx_expression
+	template <typename L, typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, R, detail::expr_add> > operator+(texpr<L> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_add> > operator+(texpr<L> const & a, tvec4<typename L::value_type, P> const & b);
+
+	/// @see gtx_expression
+	template <typename R, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_add> > operator+(tvec4<typename R::value_type, P> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_add> > operator+(texpr<L> const & a, typename L::value_type b);
+
+	/// @see gtx_expression
+	template <typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_add> > operator+(typename R::value_type a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, R, detail::expr_sub> > operator-(texpr<L> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_sub> > operator-(texpr<L> const & a, tvec4<typename L::value_type, P> const & b);
+
+	/// @see gtx_expression
+	template <typename R, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_sub> > operator-(tvec4<typename R::value_type, P> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_sub> > operator-(texpr<L> const & a, typename L::value_type b);
+
+	/// @see gtx_expression
+	template <typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_sub> > operator-(typename R::value_type a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, R, detail::expr_mul> > operator*(texpr<L> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_mul> > operator*(texpr<L> const & a, tvec4<typename L::value_type, P> const & b);
+
+	/// @see gtx_expression
+	template <typename R, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_mul> > operator*(tvec4<typename R::value_type, P> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_mul> > operator*(texpr<L> const & a, typename L::value_type b);
+
+	/// @see gtx_expression
+	template <typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_mul> > operator*(typename R::value_type a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, R, detail::expr_div> > operator/(texpr<L> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_div> > operator/(texpr<L> const & a, tvec4<typename L::value_type, P> const & b);
+
+	/// @see gtx_expression
+	template <typename R, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_div> > operator/(tvec4<typename R::value_type, P> const & a, texpr<R> const & b);
+
+	/// @see gtx_expression
+	template <typename L>
+	GLM_FUNC_DECL texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_div> > operator/(texpr<L> const & a, typename L::value_type b);
+
+	/// @see gtx_expression
+	template <typename R>
+	GLM_FUNC_DECL texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_div> > operator/(typename R::value_type a, texpr<R> const & b);
+
+	/// Product of a matrix by a column vector expression.
+	/// @see gtx_expression
+	template <typename R, precision P>
+	GLM_FUNC_DECL texpr<detail::expr_mat4_mul<typename R::value_type, R> > operator*(tmat4x4<typename R::value_type, P> const & m, texpr<R> const & v);
+
+	/// @}
+}//namespace glm
+
+#include "expression.inl"
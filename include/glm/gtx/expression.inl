@@ -0,0 +1,489 @@
+/// @ref gtx_expression
+/// @file glm/gtx/expression.inl
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	// Each node evaluates the i-th element of its expression: value computes it component by component,
+	// packet computes single precision expressions in a SSE register.
+
+	template <typename T, precision P>
+	struct expr_vec4
+	{
+		typedef T value_type;
+
+		GLM_FUNC_QUALIFIER explicit expr_vec4(tvec4<T, P> const & v) : Value(v) {}
+
+		GLM_FUNC_QUALIFIER tvec4<T, packed_highp> value(size_t) const
+		{
+			return tvec4<T, packed_highp>(this->Value);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t) const
+			{
+				return _mm_loadu_ps(&this->Value.x);
+			}
+#		endif
+
+		tvec4<T, P> Value;
+	};
+
+	template <typename T, precision P>
+	struct expr_array
+	{
+		typedef T value_type;
+
+		GLM_FUNC_QUALIFIER explicit expr_array(tvec4<T, P> const * Array) : Data(Array) {}
+
+		GLM_FUNC_QUALIFIER tvec4<T, packed_highp> value(size_t i) const
+		{
+			return tvec4<T, packed_highp>(this->Data[i]);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t i) const
+			{
+				return _mm_loadu_ps(&this->Data[i].x);
+			}
+#		endif
+
+		tvec4<T, P> const * Data;
+	};
+
+	template <typename T>
+	struct expr_scalar
+	{
+		typedef T value_type;
+
+		GLM_FUNC_QUALIFIER explicit expr_scalar(T s) : Value(s) {}
+
+		GLM_FUNC_QUALIFIER tvec4<T, packed_highp> value(size_t) const
+		{
+			return tvec4<T, packed_highp>(this->Value);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t) const
+			{
+				return _mm_set1_ps(this->Value);
+			}
+#		endif
+
+		T Value;
+	};
+
+	struct expr_add
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static T call(T a, T b)
+		{
+			return a + b;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b)
+			{
+				return glm_vec4_add(a, b);
+			}
+#		endif
+	};
+
+	struct expr_sub
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static T call(T a, T b)
+		{
+			return a - b;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b)
+			{
+				return glm_vec4_sub(a, b);
+			}
+#		endif
+	};
+
+	struct expr_mul
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static T call(T a, T b)
+		{
+			return a * b;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b)
+			{
+				return glm_vec4_mul(a, b);
+			}
+#		endif
+	};
+
+	struct expr_div
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static T call(T a, T b)
+		{
+			return a / b;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b)
+			{
+				return glm_vec4_div(a, b);
+			}
+#		endif
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// Contracts a product operand of an addition or a subtraction into a fused multiply-add
+		template <typename L, typename R, typename op>
+		struct expr_fuse
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(L const & a, R const & b, size_t i)
+			{
+				return op::call(a.packet(i), b.packet(i));
+			}
+		};
+
+		template <typename A, typename B, typename R>
+		struct expr_fuse<expr_binary<A, B, expr_mul>, R, expr_add>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(expr_binary<A, B, expr_mul> const & a, R const & b, size_t i)
+			{
+				return glm_vec4_fma(a.First.packet(i), a.Second.packet(i), b.packet(i));
+			}
+		};
+
+		template <typename L, typename A, typename B>
+		struct expr_fuse<L, expr_binary<A, B, expr_mul>, expr_add>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(L const & a, expr_binary<A, B, expr_mul> const & b, size_t i)
+			{
+				return glm_vec4_fma(b.First.packet(i), b.Second.packet(i), a.packet(i));
+			}
+		};
+
+		template <typename A, typename B, typename C, typename D>
+		struct expr_fuse<expr_binary<A, B, expr_mul>, expr_binary<C, D, expr_mul>, expr_add>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(expr_binary<A, B, expr_mul> const & a, expr_binary<C, D, expr_mul> const & b, size_t i)
+			{
+				return glm_vec4_fma(a.First.packet(i), a.Second.packet(i), b.packet(i));
+			}
+		};
+
+		template <typename A, typename B, typename R>
+		struct expr_fuse<expr_binary<A, B, expr_mul>, R, expr_sub>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(expr_binary<A, B, expr_mul> const & a, R const & b, size_t i)
+			{
+				return glm_vec4_fms(a.First.packet(i), a.Second.packet(i), b.packet(i));
+			}
+		};
+
+		template <typename L, typename A, typename B>
+		struct expr_fuse<L, expr_binary<A, B, expr_mul>, expr_sub>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(L const & a, expr_binary<A, B, expr_mul> const & b, size_t i)
+			{
+				return glm_vec4_fnma(b.First.packet(i), b.Second.packet(i), a.packet(i));
+			}
+		};
+
+		template <typename A, typename B, typename C, typename D>
+		struct expr_fuse<expr_binary<A, B, expr_mul>, expr_binary<C, D, expr_mul>, expr_sub>
+		{
+			GLM_FUNC_QUALIFIER static glm_vec4 call(expr_binary<A, B, expr_mul> const & a, expr_binary<C, D, expr_mul> const & b, size_t i)
+			{
+				return glm_vec4_fms(a.First.packet(i), a.Second.packet(i), b.packet(i));
+			}
+		};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	template <typename L, typename R, typename op>
+	struct expr_binary
+	{
+		typedef typename L::value_type value_type;
+
+		GLM_FUNC_QUALIFIER expr_binary(L const & a, R const & b) : First(a), Second(b) {}
+
+		GLM_FUNC_QUALIFIER tvec4<value_type, packed_highp> value(size_t i) const
+		{
+			tvec4<value_type, packed_highp> const a(this->First.value(i));
+			tvec4<value_type, packed_highp> const b(this->Second.value(i));
+			return tvec4<value_type, packed_highp>(op::call(a.x, b.x), op::call(a.y, b.y), op::call(a.z, b.z), op::call(a.w, b.w));
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t i) const
+			{
+				return expr_fuse<L, R, op>::call(this->First, this->Second, i);
+			}
+#		endif
+
+		L First;
+		R Second;
+	};
+
+	template <typename E>
+	struct expr_negate
+	{
+		typedef typename E::value_type value_type;
+
+		GLM_FUNC_QUALIFIER explicit expr_negate(E const & a) : Operand(a) {}
+
+		GLM_FUNC_QUALIFIER tvec4<value_type, packed_highp> value(size_t i) const
+		{
+			tvec4<value_type, packed_highp> const a(this->Operand.value(i));
+			return tvec4<value_type, packed_highp>(-a.x, -a.y, -a.z, -a.w);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t i) const
+			{
+				return _mm_xor_ps(this->Operand.packet(i), _mm_set1_ps(-0.0f));
+			}
+#		endif
+
+		E Operand;
+	};
+
+	template <typename T, typename E>
+	struct expr_mat4_mul
+	{
+		typedef T value_type;
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER expr_mat4_mul(tmat4x4<T, P> const & m, E const & v) : Matrix(m), Operand(v) {}
+
+		GLM_FUNC_QUALIFIER tvec4<T, packed_highp> value(size_t i) const
+		{
+			tvec4<T, packed_highp> const v(this->Operand.value(i));
+			return this->Matrix[0] * v.x + this->Matrix[1] * v.y + this->Matrix[2] * v.z + this->Matrix[3] * v.w;
+		}
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			GLM_FUNC_QUALIFIER glm_vec4 packet(size_t i) const
+			{
+				glm_vec4 const v = this->Operand.packet(i);
+
+				glm_vec4 const mul0 = glm_vec4_mul(_mm_loadu_ps(&this->Matrix[0].x), _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+				glm_vec4 const fma1 = glm_vec4_fma(_mm_loadu_ps(&this->Matrix[1].x), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), mul0);
+				glm_vec4 const fma2 = glm_vec4_fma(_mm_loadu_ps(&this->Matrix[2].x), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), fma1);
+				return glm_vec4_fma(_mm_loadu_ps(&this->Matrix[3].x), _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), fma2);
+			}
+#		endif
+
+		tmat4x4<T, packed_highp> Matrix;
+		E Operand;
+	};
+
+	template <typename T, precision P, typename E>
+	struct compute_expr_evaluate
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<T, P> * Result, size_t Count, E const & Node)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				Result[i] = tvec4<T, P>(Node.value(i));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template <precision P, typename E>
+	struct compute_expr_evaluate<float, P, E>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<float, P> * Result, size_t Count, E const & Node)
+		{
+			for(size_t i = 0; i < Count; ++i)
+				_mm_storeu_ps(&Result[i].x, Node.packet(i));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER texpr<E>::texpr(E const & Root)
+		: Node(Root)
+	{}
+
+	template <typename E>
+	template <precision P>
+	GLM_FUNC_QUALIFIER texpr<E>::operator tvec4<typename texpr<E>::value_type, P>() const
+	{
+		tvec4<value_type, P> Result(uninitialize);
+		detail::compute_expr_evaluate<value_type, P, E>::call(&Result, 1, this->Node);
+		return Result;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_vec4<T, P> > expr(tvec4<T, P> const & v)
+	{
+		return texpr<detail::expr_vec4<T, P> >(detail::expr_vec4<T, P>(v));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_array<T, P> > expr(tvec4<T, P> const * Array)
+	{
+		return texpr<detail::expr_array<T, P> >(detail::expr_array<T, P>(Array));
+	}
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER tvec4<typename E::value_type, defaultp> evaluate(texpr<E> const & Expression)
+	{
+		return tvec4<typename E::value_type, defaultp>(Expression);
+	}
+
+	template <typename T, precision P, typename E>
+	GLM_FUNC_QUALIFIER void evaluate(tvec4<T, P> * Result, size_t Count, texpr<E> const & Expression)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_expr_evaluate<T, P, E>::call(Result, Count, Expression.Node);
+	}
+
+	template <typename E>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_negate<E> > operator-(texpr<E> const & a)
+	{
+		return texpr<detail::expr_negate<E> >(detail::expr_negate<E>(a.Node));
+	}
+
+	// operator+
+
+	template <typename L, typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, R, detail::expr_add> > operator+(texpr<L> const & a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_binary<L, R, detail::expr_add> >(detail::expr_binary<L, R, detail::expr_add>(a.Node, b.Node));
+	}
+
+	template <typename L, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_add> > operator+(texpr<L> const & a, tvec4<typename L::value_type, P> const & b)
+	{
+		return a + expr(b);
+	}
+
+	template <typename R, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_add> > operator+(tvec4<typename R::value_type, P> const & a, texpr<R> const & b)
+	{
+		return expr(a) + b;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_add> > operator+(texpr<L> const & a, typename L::value_type b)
+	{
+		return a + texpr<detail::expr_scalar<typename L::value_type> >(detail::expr_scalar<typename L::value_type>(b));
+	}
+
+	template <typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_add> > operator+(typename R::value_type a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_scalar<typename R::value_type> >(detail::expr_scalar<typename R::value_type>(a)) + b;
+	}
+
+	// operator-
+
+	template <typename L, typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, R, detail::expr_sub> > operator-(texpr<L> const & a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_binary<L, R, detail::expr_sub> >(detail::expr_binary<L, R, detail::expr_sub>(a.Node, b.Node));
+	}
+
+	template <typename L, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_sub> > operator-(texpr<L> const & a, tvec4<typename L::value_type, P> const & b)
+	{
+		return a - expr(b);
+	}
+
+	template <typename R, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_sub> > operator-(tvec4<typename R::value_type, P> const & a, texpr<R> const & b)
+	{
+		return expr(a) - b;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_sub> > operator-(texpr<L> const & a, typename L::value_type b)
+	{
+		return a - texpr<detail::expr_scalar<typename L::value_type> >(detail::expr_scalar<typename L::value_type>(b));
+	}
+
+	template <typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_sub> > operator-(typename R::value_type a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_scalar<typename R::value_type> >(detail::expr_scalar<typename R::value_type>(a)) - b;
+	}
+
+	// operator*
+
+	template <typename L, typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, R, detail::expr_mul> > operator*(texpr<L> const & a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_binary<L, R, detail::expr_mul> >(detail::expr_binary<L, R, detail::expr_mul>(a.Node, b.Node));
+	}
+
+	template <typename L, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_mul> > operator*(texpr<L> const & a, tvec4<typename L::value_type, P> const & b)
+	{
+		return a * expr(b);
+	}
+
+	template <typename R, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_mul> > operator*(tvec4<typename R::value_type, P> const & a, texpr<R> const & b)
+	{
+		return expr(a) * b;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_mul> > operator*(texpr<L> const & a, typename L::value_type b)
+	{
+		return a * texpr<detail::expr_scalar<typename L::value_type> >(detail::expr_scalar<typename L::value_type>(b));
+	}
+
+	template <typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_mul> > operator*(typename R::value_type a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_scalar<typename R::value_type> >(detail::expr_scalar<typename R::value_type>(a)) * b;
+	}
+
+	// operator/
+
+	template <typename L, typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, R, detail::expr_div> > operator/(texpr<L> const & a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_binary<L, R, detail::expr_div> >(detail::expr_binary<L, R, detail::expr_div>(a.Node, b.Node));
+	}
+
+	template <typename L, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_vec4<typename L::value_type, P>, detail::expr_div> > operator/(texpr<L> const & a, tvec4<typename L::value_type, P> const & b)
+	{
+		return a / expr(b);
+	}
+
+	template <typename R, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_vec4<typename R::value_type, P>, R, detail::expr_div> > operator/(tvec4<typename R::value_type, P> const & a, texpr<R> const & b)
+	{
+		return expr(a) / b;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<L, detail::expr_scalar<typename L::value_type>, detail::expr_div> > operator/(texpr<L> const & a, typename L::value_type b)
+	{
+		return a / texpr<detail::expr_scalar<typename L::value_type> >(detail::expr_scalar<typename L::value_type>(b));
+	}
+
+	template <typename R>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_binary<detail::expr_scalar<typename R::value_type>, R, detail::expr_div> > operator/(typename R::value_type a, texpr<R> const & b)
+	{
+		return texpr<detail::expr_scalar<typename R::value_type> >(detail::expr_scalar<typename R::value_type>(a)) / b;
+	}
+
+	// Matrix product
+
+	template <typename R, precision P>
+	GLM_FUNC_QUALIFIER texpr<detail::expr_mat4_mul<typename R::value_type, R> > operator*(tmat4x4<typename R::value_type, P> const & m, texpr<R> const & v)
+	{
+		return texpr<detail::expr_mat4_mul<typename R::value_type, R> >(detail::expr_mat4_mul<typename R::value_type, R>(m, v.Node));
+	}
+}//namespace glm
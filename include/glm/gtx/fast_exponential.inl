@@ -1,8 +1,95 @@
 /// @ref gtx_fast_exponential
 /// @file glm/gtx/fast_exponential.inl
 
-namespace glm
+#include "../simd/exponential.h"
+
+namespace glm{
+namespace detail
 {
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastExp
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastExp, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastExp2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastExp2, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastLog
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastLog, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastLog2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastLog2, x);
+		}
+	};
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+	template <precision P>
+	struct compute_fastExp<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_exp(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastExp2<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_exp(glm_vec4_mul(x.data, _mm_set1_ps(0.69314718055994530941723212145818f)));
+			return Result;
+		}
+	};
+
+	// fastLog is std::log, the vectorized logarithm is both faster and as accurate
+	template <precision P>
+	struct compute_fastLog<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_log(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastLog2<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_log2(x.data);
+			return Result;
+		}
+	};
+#	endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+}//namespace detail
+
 	// fastPow:
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType fastPow(genType x, genType y)
@@ -84,7 +171,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastExp(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastExp, x);
+		return detail::compute_fastExp<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// fastLog
@@ -106,7 +193,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastLog(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastLog, x);
+		return detail::compute_fastLog<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	//fastExp2, ln2 = 0.69314718055994530941723212145818f
@@ -119,7 +206,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastExp2(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastExp2, x);
+		return detail::compute_fastExp2<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// fastLog2, ln2 = 0.69314718055994530941723212145818f
@@ -132,6 +219,6 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastLog2(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastLog2, x);
+		return detail::compute_fastLog2<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 }//namespace glm
@@ -1,8 +1,54 @@
 /// @ref gtx_fast_square_root
 /// @file glm/gtx/fast_square_root.inl
 
-namespace glm
+#include "../simd/exponential.h"
+
+namespace glm{
+namespace detail
 {
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastSqrt
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastSqrt, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastInverseSqrt
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::compute_inversesqrt<vecType, T, P, Aligned>::call(x);
+		}
+	};
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+	template <precision P>
+	struct compute_fastSqrt<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_sqrt(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastInverseSqrt<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_inversesqrt(x.data);
+			return Result;
+		}
+	};
+#	endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+}//namespace detail
+
 	// fastSqrt
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType fastSqrt(genType x)
@@ -15,7 +61,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastSqrt(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastSqrt, x);
+		return detail::compute_fastSqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// fastInversesqrt
@@ -33,7 +79,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastInverseSqrt(vecType<T, P> const & x)
 	{
-		return detail::compute_inversesqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
+		return detail::compute_fastInverseSqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// fastLength
@@ -1,6 +1,8 @@
 /// @ref gtx_fast_trigonometry
 /// @file glm/gtx/fast_trigonometry.inl
 
+#include "../simd/trigonometric.h"
+
 namespace glm{
 namespace detail
 {
@@ -26,6 +28,149 @@ namespace detail
 	{
 		return detail::functor1<T, T, P, vecType>::call(cos_52s, x);
 	}
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastCos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastCos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastSin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastSin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastTan
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastTan, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastAsin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastAsin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastAcos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastAcos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastAtan
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(fastAtan, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_fastAtan2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & y, vecType<T, P> const & x)
+		{
+			return detail::functor2<T, P, vecType>::call(fastAtan, y, x);
+		}
+	};
+
+	// Branchless kernels evaluating the same approximations as the scalar functions
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+	template <precision P>
+	struct compute_fastCos<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_cos(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastSin<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_sin(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastTan<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_tan(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastAsin<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_asin(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastAcos<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_acos(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastAtan<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_atan(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_fastAtan2<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & y, tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_fast_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+#	endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
 }//namespace detail
 
 	// wrapAngle
@@ -60,7 +205,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastCos(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastCos, x);
+		return detail::compute_fastCos<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// sin
@@ -73,7 +218,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastSin(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastSin, x);
+		return detail::compute_fastSin<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// tan
@@ -86,7 +231,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastTan(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastTan, x);
+		return detail::compute_fastTan<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// asin
@@ -99,7 +244,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastAsin(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastAsin, x);
+		return detail::compute_fastAsin<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// acos
@@ -112,7 +257,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastAcos(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastAcos, x);
+		return detail::compute_fastAcos<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 
 	// atan
@@ -126,7 +271,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastAtan(vecType<T, P> const & y, vecType<T, P> const & x)
 	{
-		return detail::functor2<T, P, vecType>::call(fastAtan, y, x);
+		return detail::compute_fastAtan2<vecType, T, P, detail::is_aligned<P>::value>::call(y, x);
 	}
 
 	template <typename T> 
@@ -138,6 +283,6 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> fastAtan(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(fastAtan, x);
+		return detail::compute_fastAtan<vecType, T, P, detail::is_aligned<P>::value>::call(x);
 	}
 }//namespace glm
@@ -0,0 +1,81 @@
+/// @ref gtx_float_environment
+/// @file glm/gtx/float_environment.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_float_environment GLM_GTX_float_environment
+/// @ingroup gtx
+///
+/// @brief Scoped control of the flush-to-zero, denormals-are-zero and rounding modes of the SIMD floating point unit.
+///
+/// Arithmetic producing or consuming denormal numbers is handled by microcode on most x86 processors,
+/// up to two orders of magnitude slower than on normal numbers. float_environment_guard sets the MXCSR
+/// flush-to-zero and denormals-are-zero modes for its lifetime and restores the caller environment on destruction.
+///
+/// When GLM_FORCE_FLUSH_DENORMALS is defined before including GLM, the array functions of GLM_GTX_batch,
+/// GLM_GTX_expression and GLM_GTX_frustum flush denormals for the duration of each call.
+///
+/// The MXCSR register is only controlled when GLM_ARCH includes SSE2, otherwise the guard has no effect.
+///
+/// <glm/gtx/float_environment.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <limits>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_float_environment extension included")
+#endif
+
+// User defines: GLM_FORCE_FLUSH_DENORMALS
+
+#if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_FLUSH_DENORMALS_DISPLAYED)
+#	define GLM_MESSAGE_FLUSH_DENORMALS_DISPLAYED
+#	if defined(GLM_FORCE_FLUSH_DENORMALS) && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#		pragma message("GLM: Array functions flush denormals")
+#	elif defined(GLM_FORCE_FLUSH_DENORMALS)
+#		pragma message("GLM: GLM_FORCE_FLUSH_DENORMALS ignored, the floating point environment is only controlled with SSE2")
+#	endif
+#endif//GLM_MESSAGES
+
+namespace glm
+{
+	/// @addtogroup gtx_float_environment
+	/// @{
+
+	/// Set the floating point environment of the SIMD unit for the lifetime of the object.
+	/// Guards may be nested, each restoring the modes which were current when it was constructed.
+	/// Exception flags raised during the lifetime of the guard remain raised after its destruction.
+	/// The environment is a per thread state.
+	/// Without strict floating point semantics (e.g. -frounding-math or /fp:strict), compilers may schedule arithmetic kept in registers
+	/// outside of the scope of the guard, results meant to be computed in the environment of the guard should go through memory, as the array functions do.
+	/// @see gtx_float_environment
+	class float_environment_guard
+	{
+	public:
+		/// @param FlushDenormals Flush denormal results to zero and read denormal operands as zero when true, handle denormals as IEEE 754 requires when false.
+		/// @param Rounding Rounding mode of the SIMD operations, std::round_indeterminate keeps the current mode.
+		GLM_FUNC_DECL explicit float_environment_guard(bool FlushDenormals = true, std::float_round_style Rounding = std::round_indeterminate);
+		GLM_FUNC_DECL ~float_environment_guard();
+
+	private:
+		float_environment_guard(float_environment_guard const &);
+		float_environment_guard & operator=(float_environment_guard const &);
+
+		unsigned int Environment;
+	};
+
+	/// Return true if denormal results are flushed to zero in the current floating point environment.
+	/// @see gtx_float_environment
+	GLM_FUNC_DECL bool flushDenormals();
+
+	/// Return the rounding mode of the current floating point environment.
+	/// @see gtx_float_environment
+	GLM_FUNC_DECL std::float_round_style roundingMode();
+
+	/// @}
+}//namespace glm
+
+#include "float_environment.inl"
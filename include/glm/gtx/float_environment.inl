@@ -0,0 +1,111 @@
+/// @ref gtx_float_environment
+/// @file glm/gtx/float_environment.inl
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// MXCSR fields
+		static unsigned int const mxcsr_exception_flags = 0x003F;
+		static unsigned int const mxcsr_denormals_are_zero = 0x0040;
+		static unsigned int const mxcsr_flush_to_zero = 0x8000;
+		static unsigned int const mxcsr_rounding_mask = 0x6000;
+		static unsigned int const mxcsr_round_nearest = 0x0000;
+		static unsigned int const mxcsr_round_down = 0x2000;
+		static unsigned int const mxcsr_round_up = 0x4000;
+		static unsigned int const mxcsr_round_toward_zero = 0x6000;
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Floating point environment of the array functions, flushing denormals when GLM_FORCE_FLUSH_DENORMALS is defined
+	struct batch_float_environment
+	{
+#		if defined(GLM_FORCE_FLUSH_DENORMALS)
+			GLM_FUNC_QUALIFIER batch_float_environment() :
+				Guard(true, std::round_indeterminate)
+			{}
+
+			float_environment_guard Guard;
+#		else
+			GLM_FUNC_QUALIFIER batch_float_environment()
+			{}
+#		endif
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER float_environment_guard::float_environment_guard(bool FlushDenormals, std::float_round_style Rounding) :
+		Environment(0)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			this->Environment = _mm_getcsr();
+
+			unsigned int Csr = this->Environment;
+			if(FlushDenormals)
+				Csr |= detail::mxcsr_flush_to_zero | detail::mxcsr_denormals_are_zero;
+			else
+				Csr &= ~(detail::mxcsr_flush_to_zero | detail::mxcsr_denormals_are_zero);
+
+			switch(Rounding)
+			{
+			case std::round_to_nearest:
+				Csr = (Csr & ~detail::mxcsr_rounding_mask) | detail::mxcsr_round_nearest;
+				break;
+			case std::round_toward_neg_infinity:
+				Csr = (Csr & ~detail::mxcsr_rounding_mask) | detail::mxcsr_round_down;
+				break;
+			case std::round_toward_infinity:
+				Csr = (Csr & ~detail::mxcsr_rounding_mask) | detail::mxcsr_round_up;
+				break;
+			case std::round_toward_zero:
+				Csr = (Csr & ~detail::mxcsr_rounding_mask) | detail::mxcsr_round_toward_zero;
+				break;
+			default:
+				break;
+			}
+
+			if(Csr != this->Environment)
+				_mm_setcsr(Csr);
+#		else
+			(void)FlushDenormals;
+			(void)Rounding;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER float_environment_guard::~float_environment_guard()
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			// Restore the control fields, keeping the exception flags raised in the scope of the guard as feupdateenv does
+			unsigned int const Csr = _mm_getcsr();
+			unsigned int const Restored = this->Environment | (Csr & detail::mxcsr_exception_flags);
+			if(Csr != Restored)
+				_mm_setcsr(Restored);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER bool flushDenormals()
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return (_mm_getcsr() & detail::mxcsr_flush_to_zero) != 0;
+#		else
+			return false;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::float_round_style roundingMode()
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			switch(_mm_getcsr() & detail::mxcsr_rounding_mask)
+			{
+			case detail::mxcsr_round_down:
+				return std::round_toward_neg_infinity;
+			case detail::mxcsr_round_up:
+				return std::round_toward_infinity;
+			case detail::mxcsr_round_toward_zero:
+				return std::round_toward_zero;
+			default:
+				return std::round_to_nearest;
+			}
+#		else
+			return std::round_to_nearest;
+#		endif
+	}
+}//namespace glm
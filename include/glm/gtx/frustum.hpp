@@ -0,0 +1,128 @@
+/// @ref gtx_frustum
+/// @file glm/gtx/frustum.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_transform (dependence)
+///
+/// @defgroup gtx_frustum GLM_GTX_frustum
+/// @ingroup gtx
+///
+/// @brief Extract the clip planes of a projection matrix and cull spheres and boxes against them.
+///
+/// Planes are stored in a tvec4 as (normal.x, normal.y, normal.z, distance) with the normal pointing
+/// toward the inside of the frustum, so that a point p is inside a plane when dot(normal, p) + distance >= 0.
+/// The six planes are ordered left, right, bottom, top, near and far.
+///
+/// <glm/gtx/frustum.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_transform.hpp"
+#include "../gtc/type_ptr.hpp"
+#include "float_environment.hpp"
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_frustum extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum
+	/// @{
+
+	/// Extract the six normalized clip planes of a projection or view-projection matrix
+	/// whose clip space depth range is [0, 1] (Direct3D, Metal, Vulkan), using the Gribb-Hartmann method.
+	/// The extraction is independent of the handedness of the matrix.
+	/// Planes with a null normal, like the far plane of infinitePerspective, are not normalized and never cull.
+	///
+	/// @param m Projection or view-projection matrix, for example built with perspectiveLH or perspectiveRH.
+	/// @param Planes Output array receiving the left, right, bottom, top, near and far planes.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumPlanesZO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6]);
+
+	/// Extract the six normalized clip planes of a projection or view-projection matrix
+	/// whose clip space depth range is [-1, 1] (OpenGL), using the Gribb-Hartmann method.
+	/// The extraction is independent of the handedness of the matrix.
+	/// Planes with a null normal, like the far plane of infinitePerspective, are not normalized and never cull.
+	///
+	/// @param m Projection or view-projection matrix, for example built with perspectiveLH or perspectiveRH.
+	/// @param Planes Output array receiving the left, right, bottom, top, near and far planes.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumPlanesNO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6]);
+
+	/// Extract the six normalized clip planes of a projection or view-projection matrix.
+	/// If GLM_FORCE_DEPTH_ZERO_TO_ONE is defined, the clip space depth range is assumed to be [0, 1],
+	/// otherwise [-1, 1], matching the matrices built by GLM_GTC_matrix_transform.
+	///
+	/// @param m Projection or view-projection matrix.
+	/// @param Planes Output array receiving the left, right, bottom, top, near and far planes.
+	/// @see gtx_frustum
+	/// @see - frustumPlanesZO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6])
+	/// @see - frustumPlanesNO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6])
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumPlanes(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6]);
+
+	/// Return true if the sphere is at least partially inside the frustum.
+	/// The test is conservative: spheres close to a frustum corner may be reported visible.
+	///
+	/// @param Planes Frustum planes returned by frustumPlanes.
+	/// @param Sphere Sphere center stored in xyz and radius stored in w.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool frustumIntersectSphere(tvec4<T, P> const Planes[6], tvec4<T, P> const & Sphere);
+
+	/// Return true if the axis aligned box is at least partially inside the frustum.
+	/// The test is conservative: boxes close to a frustum corner may be reported visible.
+	///
+	/// @param Planes Frustum planes returned by frustumPlanes.
+	/// @param Min Minimum corner of the box.
+	/// @param Max Maximum corner of the box.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool frustumIntersectAABB(tvec4<T, P> const Planes[6], tvec3<T, P> const & Min, tvec3<T, P> const & Max);
+
+	/// Cull an array of spheres against a frustum.
+	/// Bit i % 32 of Visibility[i / 32] is set if Spheres[i] is at least partially inside the frustum, cleared otherwise.
+	/// Visibility must hold at least (Count + 31) / 32 words. Unused bits of the last word are cleared.
+	/// With float values, 4 spheres are tested per iteration using SSE2 and 8 using AVX.
+	///
+	/// @param Planes Frustum planes returned by frustumPlanes.
+	/// @param Spheres Array of spheres, center stored in xyz and radius stored in w.
+	/// @param Count Number of spheres.
+	/// @param Visibility Output visibility bitmask.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumCullSpheres(tvec4<T, P> const Planes[6], tvec4<T, P> const * Spheres, size_t Count, uint32 * Visibility);
+
+	/// Cull the spheres of a strided view, for example stored in an array of instance structures.
+	/// Spheres are gathered by blocks to run the batched kernel of frustumCullSpheres.
+	///
+	/// @param Planes Frustum planes returned by frustumPlanes.
+	/// @param Spheres View of tvec4 spheres, center stored in xyz and radius stored in w.
+	/// @param Visibility Output visibility bitmask of at least (Spheres.size() + 31) / 32 words.
+	/// @see gtx_frustum
+	template <typename T, precision P, typename genType>
+	GLM_FUNC_DECL void frustumCullSpheres(tvec4<T, P> const Planes[6], tstrided_view<genType> const & Spheres, uint32 * Visibility);
+
+	/// Cull an array of axis aligned boxes against a frustum.
+	/// Bit i % 32 of Visibility[i / 32] is set if the box i is at least partially inside the frustum, cleared otherwise.
+	/// Visibility must hold at least (Count + 31) / 32 words. Unused bits of the last word are cleared.
+	/// With float values, 4 boxes are tested per iteration using SSE2 and 8 using AVX.
+	///
+	/// @param Planes Frustum planes returned by frustumPlanes.
+	/// @param Min Array of minimum box corners.
+	/// @param Max Array of maximum box corners.
+	/// @param Count Number of boxes.
+	/// @param Visibility Output visibility bitmask.
+	/// @see gtx_frustum
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumCullAABBs(tvec4<T, P> const Planes[6], tvec3<T, P> const * Min, tvec3<T, P> const * Max, size_t Count, uint32 * Visibility);
+
+	/// @}
+}// namespace glm
+
+#include "frustum.inl"
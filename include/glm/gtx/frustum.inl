@@ -0,0 +1,493 @@
+/// @ref gtx_frustum
+/// @file glm/gtx/frustum.inl
+
+#include "../simd/common.h"
+#include "../simd/cpu.h"
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec4<T, P> frustum_normalize_plane(tvec4<T, P> const & Plane)
+	{
+		T const Length = length(tvec3<T, P>(Plane));
+		return Length > static_cast<T>(0) ? Plane / Length : Plane;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustum_extract_planes(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6], bool ZeroToOne)
+	{
+		tvec4<T, P> const Row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		tvec4<T, P> const Row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		tvec4<T, P> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		tvec4<T, P> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		Planes[0] = frustum_normalize_plane(Row3 + Row0);
+		Planes[1] = frustum_normalize_plane(Row3 - Row0);
+		Planes[2] = frustum_normalize_plane(Row3 + Row1);
+		Planes[3] = frustum_normalize_plane(Row3 - Row1);
+		Planes[4] = frustum_normalize_plane(ZeroToOne ? Row2 : Row3 + Row2);
+		Planes[5] = frustum_normalize_plane(Row3 - Row2);
+	}
+
+	template <typename T, precision P>
+	struct compute_frustumCullSpheres
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<T, P> const Planes[6], tvec4<T, P> const * Spheres, size_t Count, uint32 * Visibility)
+		{
+			for(size_t First = 0; First < Count; First += 32)
+			{
+				size_t const Last = Count - First < 32 ? Count : First + 32;
+
+				uint32 Bits = 0;
+				for(size_t i = First; i < Last; ++i)
+					Bits |= static_cast<uint32>(frustumIntersectSphere(Planes, Spheres[i])) << (i - First);
+				Visibility[First / 32] = Bits;
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_frustumCullAABBs
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<T, P> const Planes[6], tvec3<T, P> const * Min, tvec3<T, P> const * Max, size_t Count, uint32 * Visibility)
+		{
+			for(size_t First = 0; First < Count; First += 32)
+			{
+				size_t const Last = Count - First < 32 ? Count : First + 32;
+
+				uint32 Bits = 0;
+				for(size_t i = First; i < Last; ++i)
+					Bits |= static_cast<uint32>(frustumIntersectAABB(Planes, Min[i], Max[i])) << (i - First);
+				Visibility[First / 32] = Bits;
+			}
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Loads 4 consecutive tvec3 and transposes them to structure of arrays, with 3 loads when they are tightly packed.
+	template <precision P>
+	GLM_FUNC_QUALIFIER void frustum_load_soa3(tvec3<float, P> const * v, glm_vec4 & X, glm_vec4 & Y, glm_vec4 & Z)
+	{
+		if(sizeof(tvec3<float, P>) == sizeof(float) * 4)
+		{
+			// Aligned tvec3 are padded to 4 components
+			glm_vec4 W = _mm_loadu_ps(&v[3].x);
+			X = _mm_loadu_ps(&v[0].x);
+			Y = _mm_loadu_ps(&v[1].x);
+			Z = _mm_loadu_ps(&v[2].x);
+			_MM_TRANSPOSE4_PS(X, Y, Z, W);
+			return;
+		}
+
+		GLM_STATIC_ASSERT(sizeof(tvec3<float, P>) == sizeof(float) * 3 || sizeof(tvec3<float, P>) == sizeof(float) * 4, "tvec3 is expected to be tightly packed or padded to 4 components");
+
+		float const * Data = &v[0].x;
+		glm_vec4 const a = _mm_loadu_ps(Data + 0); // x0 y0 z0 x1
+		glm_vec4 const b = _mm_loadu_ps(Data + 4); // y1 z1 x2 y2
+		glm_vec4 const c = _mm_loadu_ps(Data + 8); // z2 x3 y3 z3
+
+		glm_vec4 const bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2)); // x2 y2 z2 x3
+		X = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(3, 0, 3, 0));
+
+		glm_vec4 const ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)); // y0 y0 y1 y1
+		glm_vec4 const cb = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+		Y = _mm_shuffle_ps(ab, cb, _MM_SHUFFLE(2, 0, 2, 0));
+
+		glm_vec4 const za = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)); // z0 z0 z1 z1
+		Z = _mm_shuffle_ps(za, c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	// Planes splatted in structure of arrays form, shared by the sphere and box kernels.
+	struct frustum_planes_sse
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER explicit frustum_planes_sse(tvec4<float, P> const Planes[6])
+		{
+			for(int i = 0; i < 6; ++i)
+			{
+				X[i] = _mm_set1_ps(Planes[i].x);
+				Y[i] = _mm_set1_ps(Planes[i].y);
+				Z[i] = _mm_set1_ps(Planes[i].z);
+				W[i] = _mm_set1_ps(Planes[i].w);
+				AbsX[i] = _mm_set1_ps(abs(Planes[i].x));
+				AbsY[i] = _mm_set1_ps(abs(Planes[i].y));
+				AbsZ[i] = _mm_set1_ps(abs(Planes[i].z));
+			}
+		}
+
+		// Returns a 4 bits mask of the lanes whose signed distance plus radius is positive for all planes.
+		GLM_FUNC_QUALIFIER int visible(glm_vec4 CenterX, glm_vec4 CenterY, glm_vec4 CenterZ, glm_vec4 RadiusX, glm_vec4 RadiusY, glm_vec4 RadiusZ) const
+		{
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 Outside = Zero;
+			for(int i = 0; i < 6; ++i)
+			{
+				glm_vec4 const Rad0 = glm_vec4_fma(AbsX[i], RadiusX, glm_vec4_fma(AbsY[i], RadiusY, _mm_mul_ps(AbsZ[i], RadiusZ)));
+				glm_vec4 const Dst0 = glm_vec4_fma(X[i], CenterX, glm_vec4_fma(Y[i], CenterY, glm_vec4_fma(Z[i], CenterZ, _mm_add_ps(W[i], Rad0))));
+				Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Dst0, Zero));
+			}
+			return ~_mm_movemask_ps(Outside) & 0xF;
+		}
+
+		GLM_FUNC_QUALIFIER int visible(glm_vec4 CenterX, glm_vec4 CenterY, glm_vec4 CenterZ, glm_vec4 Radius) const
+		{
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 Outside = Zero;
+			for(int i = 0; i < 6; ++i)
+			{
+				glm_vec4 const Dst0 = glm_vec4_fma(X[i], CenterX, glm_vec4_fma(Y[i], CenterY, glm_vec4_fma(Z[i], CenterZ, _mm_add_ps(W[i], Radius))));
+				Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Dst0, Zero));
+			}
+			return ~_mm_movemask_ps(Outside) & 0xF;
+		}
+
+		glm_vec4 X[6], Y[6], Z[6], W[6];
+		glm_vec4 AbsX[6], AbsY[6], AbsZ[6];
+	};
+
+#	if (GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+	// With runtime dispatch, the AVX kernels are only selected on AVX2 CPUs and GLM_TARGET_AVX2 enables FMA.
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256 frustum_fma(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_HAS_FMA || (GLM_HAS_RUNTIME_DISPATCH && !(GLM_ARCH & GLM_ARCH_AVX2_BIT))
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256 frustum_combine(glm_vec4 Lo, glm_vec4 Hi)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(Lo), Hi, 1);
+	}
+
+	struct frustum_planes_avx
+	{
+		template <precision P>
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 explicit frustum_planes_avx(tvec4<float, P> const Planes[6])
+		{
+			for(int i = 0; i < 6; ++i)
+			{
+				X[i] = _mm256_set1_ps(Planes[i].x);
+				Y[i] = _mm256_set1_ps(Planes[i].y);
+				Z[i] = _mm256_set1_ps(Planes[i].z);
+				W[i] = _mm256_set1_ps(Planes[i].w);
+				AbsX[i] = _mm256_set1_ps(abs(Planes[i].x));
+				AbsY[i] = _mm256_set1_ps(abs(Planes[i].y));
+				AbsZ[i] = _mm256_set1_ps(abs(Planes[i].z));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 int visible(__m256 CenterX, __m256 CenterY, __m256 CenterZ, __m256 RadiusX, __m256 RadiusY, __m256 RadiusZ) const
+		{
+			__m256 const Zero = _mm256_setzero_ps();
+			__m256 Outside = Zero;
+			for(int i = 0; i < 6; ++i)
+			{
+				__m256 const Rad0 = frustum_fma(AbsX[i], RadiusX, frustum_fma(AbsY[i], RadiusY, _mm256_mul_ps(AbsZ[i], RadiusZ)));
+				__m256 const Dst0 = frustum_fma(X[i], CenterX, frustum_fma(Y[i], CenterY, frustum_fma(Z[i], CenterZ, _mm256_add_ps(W[i], Rad0))));
+				Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Dst0, Zero, _CMP_LT_OQ));
+			}
+			return ~_mm256_movemask_ps(Outside) & 0xFF;
+		}
+
+		GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 int visible(__m256 CenterX, __m256 CenterY, __m256 CenterZ, __m256 Radius) const
+		{
+			__m256 const Zero = _mm256_setzero_ps();
+			__m256 Outside = Zero;
+			for(int i = 0; i < 6; ++i)
+			{
+				__m256 const Dst0 = frustum_fma(X[i], CenterX, frustum_fma(Y[i], CenterY, frustum_fma(Z[i], CenterZ, _mm256_add_ps(W[i], Radius))));
+				Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Dst0, Zero, _CMP_LT_OQ));
+			}
+			return ~_mm256_movemask_ps(Outside) & 0xFF;
+		}
+
+		__m256 X[6], Y[6], Z[6], W[6];
+		__m256 AbsX[6], AbsY[6], AbsZ[6];
+	};
+
+	// Not force inlined: with runtime dispatch, it is called through a function pointer from SSE2 code
+	template <precision P>
+	GLM_TARGET_AVX2 void frustum_cull_spheres_avx(tvec4<float, P> const Planes[6], tvec4<float, P> const * Spheres, size_t Count, uint32 * Visibility)
+	{
+		frustum_planes_avx const Simd(Planes);
+
+		for(size_t First = 0; First < Count; First += 32)
+		{
+			size_t const Last = Count - First < 32 ? Count : First + 32;
+
+			uint32 Bits = 0;
+			size_t i = First;
+			for(; i + 8 <= Last; i += 8)
+			{
+				__m256 const s0 = frustum_combine(_mm_loadu_ps(&Spheres[i + 0].x), _mm_loadu_ps(&Spheres[i + 4].x));
+				__m256 const s1 = frustum_combine(_mm_loadu_ps(&Spheres[i + 1].x), _mm_loadu_ps(&Spheres[i + 5].x));
+				__m256 const s2 = frustum_combine(_mm_loadu_ps(&Spheres[i + 2].x), _mm_loadu_ps(&Spheres[i + 6].x));
+				__m256 const s3 = frustum_combine(_mm_loadu_ps(&Spheres[i + 3].x), _mm_loadu_ps(&Spheres[i + 7].x));
+
+				__m256 const t0 = _mm256_unpacklo_ps(s0, s1);
+				__m256 const t1 = _mm256_unpackhi_ps(s0, s1);
+				__m256 const t2 = _mm256_unpacklo_ps(s2, s3);
+				__m256 const t3 = _mm256_unpackhi_ps(s2, s3);
+
+				__m256 const X = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				__m256 const Y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				__m256 const Z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				__m256 const R = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+				Bits |= static_cast<uint32>(Simd.visible(X, Y, Z, R)) << (i - First);
+			}
+			for(; i < Last; ++i)
+				Bits |= static_cast<uint32>(frustumIntersectSphere(Planes, Spheres[i])) << (i - First);
+			Visibility[First / 32] = Bits;
+		}
+	}
+
+	// Not force inlined: with runtime dispatch, it is called through a function pointer from SSE2 code
+	template <precision P>
+	GLM_TARGET_AVX2 void frustum_cull_aabbs_avx(tvec4<float, P> const Planes[6], tvec3<float, P> const * Min, tvec3<float, P> const * Max, size_t Count, uint32 * Visibility)
+	{
+		frustum_planes_avx const Simd(Planes);
+		__m256 const Half = _mm256_set1_ps(0.5f);
+
+		for(size_t First = 0; First < Count; First += 32)
+		{
+			size_t const Last = Count - First < 32 ? Count : First + 32;
+
+			uint32 Bits = 0;
+			size_t i = First;
+			for(; i + 8 <= Last; i += 8)
+			{
+				glm_vec4 MinX0, MinY0, MinZ0, MaxX0, MaxY0, MaxZ0;
+				glm_vec4 MinX1, MinY1, MinZ1, MaxX1, MaxY1, MaxZ1;
+				frustum_load_soa3(Min + i, MinX0, MinY0, MinZ0);
+				frustum_load_soa3(Max + i, MaxX0, MaxY0, MaxZ0);
+				frustum_load_soa3(Min + i + 4, MinX1, MinY1, MinZ1);
+				frustum_load_soa3(Max + i + 4, MaxX1, MaxY1, MaxZ1);
+
+				__m256 const LoX = frustum_combine(MinX0, MinX1);
+				__m256 const LoY = frustum_combine(MinY0, MinY1);
+				__m256 const LoZ = frustum_combine(MinZ0, MinZ1);
+				__m256 const HiX = frustum_combine(MaxX0, MaxX1);
+				__m256 const HiY = frustum_combine(MaxY0, MaxY1);
+				__m256 const HiZ = frustum_combine(MaxZ0, MaxZ1);
+
+				int const Mask = Simd.visible(
+					_mm256_mul_ps(_mm256_add_ps(LoX, HiX), Half),
+					_mm256_mul_ps(_mm256_add_ps(LoY, HiY), Half),
+					_mm256_mul_ps(_mm256_add_ps(LoZ, HiZ), Half),
+					_mm256_mul_ps(_mm256_sub_ps(HiX, LoX), Half),
+					_mm256_mul_ps(_mm256_sub_ps(HiY, LoY), Half),
+					_mm256_mul_ps(_mm256_sub_ps(HiZ, LoZ), Half));
+
+				Bits |= static_cast<uint32>(Mask) << (i - First);
+			}
+			for(; i < Last; ++i)
+				Bits |= static_cast<uint32>(frustumIntersectAABB(Planes, Min[i], Max[i])) << (i - First);
+			Visibility[First / 32] = Bits;
+		}
+	}
+#	endif//(GLM_ARCH & GLM_ARCH_AVX_BIT) || GLM_HAS_RUNTIME_DISPATCH
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void frustum_cull_spheres_sse(tvec4<float, P> const Planes[6], tvec4<float, P> const * Spheres, size_t Count, uint32 * Visibility)
+	{
+		frustum_planes_sse const Simd(Planes);
+
+		for(size_t First = 0; First < Count; First += 32)
+		{
+			size_t const Last = Count - First < 32 ? Count : First + 32;
+
+			uint32 Bits = 0;
+			size_t i = First;
+			for(; i + 4 <= Last; i += 4)
+			{
+				glm_vec4 X = _mm_loadu_ps(&Spheres[i + 0].x);
+				glm_vec4 Y = _mm_loadu_ps(&Spheres[i + 1].x);
+				glm_vec4 Z = _mm_loadu_ps(&Spheres[i + 2].x);
+				glm_vec4 R = _mm_loadu_ps(&Spheres[i + 3].x);
+				_MM_TRANSPOSE4_PS(X, Y, Z, R);
+
+				Bits |= static_cast<uint32>(Simd.visible(X, Y, Z, R)) << (i - First);
+			}
+			for(; i < Last; ++i)
+				Bits |= static_cast<uint32>(frustumIntersectSphere(Planes, Spheres[i])) << (i - First);
+			Visibility[First / 32] = Bits;
+		}
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void frustum_cull_aabbs_sse(tvec4<float, P> const Planes[6], tvec3<float, P> const * Min, tvec3<float, P> const * Max, size_t Count, uint32 * Visibility)
+	{
+		frustum_planes_sse const Simd(Planes);
+		glm_vec4 const Half = _mm_set1_ps(0.5f);
+
+		for(size_t First = 0; First < Count; First += 32)
+		{
+			size_t const Last = Count - First < 32 ? Count : First + 32;
+
+			uint32 Bits = 0;
+			size_t i = First;
+			for(; i + 4 <= Last; i += 4)
+			{
+				glm_vec4 MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+				frustum_load_soa3(Min + i, MinX, MinY, MinZ);
+				frustum_load_soa3(Max + i, MaxX, MaxY, MaxZ);
+
+				int const Mask = Simd.visible(
+					_mm_mul_ps(_mm_add_ps(MinX, MaxX), Half),
+					_mm_mul_ps(_mm_add_ps(MinY, MaxY), Half),
+					_mm_mul_ps(_mm_add_ps(MinZ, MaxZ), Half),
+					_mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half),
+					_mm_mul_ps(_mm_sub_ps(MaxY, MinY), Half),
+					_mm_mul_ps(_mm_sub_ps(MaxZ, MinZ), Half));
+
+				Bits |= static_cast<uint32>(Mask) << (i - First);
+			}
+			for(; i < Last; ++i)
+				Bits |= static_cast<uint32>(frustumIntersectAABB(Planes, Min[i], Max[i])) << (i - First);
+			Visibility[First / 32] = Bits;
+		}
+	}
+
+	template <precision P>
+	struct compute_frustumCullSpheres<float, P>
+	{
+		typedef void (*kernel)(tvec4<float, P> const Planes[6], tvec4<float, P> const * Spheres, size_t Count, uint32 * Visibility);
+
+		GLM_FUNC_QUALIFIER static void call(tvec4<float, P> const Planes[6], tvec4<float, P> const * Spheres, size_t Count, uint32 * Visibility)
+		{
+#			if GLM_HAS_RUNTIME_DISPATCH
+				static kernel const Kernel = glm_cpu_arch() & GLM_ARCH_AVX2_BIT ? &frustum_cull_spheres_avx<P> : &frustum_cull_spheres_sse<P>;
+				Kernel(Planes, Spheres, Count, Visibility);
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				frustum_cull_spheres_avx(Planes, Spheres, Count, Visibility);
+#			else
+				frustum_cull_spheres_sse(Planes, Spheres, Count, Visibility);
+#			endif
+		}
+	};
+
+	template <precision P>
+	struct compute_frustumCullAABBs<float, P>
+	{
+		typedef void (*kernel)(tvec4<float, P> const Planes[6], tvec3<float, P> const * Min, tvec3<float, P> const * Max, size_t Count, uint32 * Visibility);
+
+		GLM_FUNC_QUALIFIER static void call(tvec4<float, P> const Planes[6], tvec3<float, P> const * Min, tvec3<float, P> const * Max, size_t Count, uint32 * Visibility)
+		{
+#			if GLM_HAS_RUNTIME_DISPATCH
+				static kernel const Kernel = glm_cpu_arch() & GLM_ARCH_AVX2_BIT ? &frustum_cull_aabbs_avx<P> : &frustum_cull_aabbs_sse<P>;
+				Kernel(Planes, Min, Max, Count, Visibility);
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				frustum_cull_aabbs_avx(Planes, Min, Max, Count, Visibility);
+#			else
+				frustum_cull_aabbs_sse(Planes, Min, Max, Count, Visibility);
+#			endif
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Contiguous views of spheres of the type of the planes are culled in place, other views are copied by blocks
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool frustum_cull_spheres_contiguous(tvec4<T, P> const Planes[6], tvec4<T, P> const * Spheres, size_t Count, uint32 * Visibility)
+	{
+		compute_frustumCullSpheres<T, P>::call(Planes, Spheres, Count, Visibility);
+		return true;
+	}
+
+	template <typename T, precision P, typename genType>
+	GLM_FUNC_QUALIFIER bool frustum_cull_spheres_contiguous(tvec4<T, P> const[6], genType const *, size_t, uint32 *)
+	{
+		return false;
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6])
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'frustumPlanesZO' only accept floating-point inputs");
+
+		detail::frustum_extract_planes(m, Planes, true);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6])
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'frustumPlanesNO' only accept floating-point inputs");
+
+		detail::frustum_extract_planes(m, Planes, false);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumPlanes(tmat4x4<T, P> const & m, tvec4<T, P> Planes[6])
+	{
+#		if GLM_DEPTH_CLIP_SPACE == GLM_DEPTH_ZERO_TO_ONE
+			frustumPlanesZO(m, Planes);
+#		else
+			frustumPlanesNO(m, Planes);
+#		endif
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool frustumIntersectSphere(tvec4<T, P> const Planes[6], tvec4<T, P> const & Sphere)
+	{
+		for(int i = 0; i < 6; ++i)
+		{
+			T const Distance = Planes[i].x * Sphere.x + Planes[i].y * Sphere.y + Planes[i].z * Sphere.z + Planes[i].w;
+			if(Distance + Sphere.w < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool frustumIntersectAABB(tvec4<T, P> const Planes[6], tvec3<T, P> const & Min, tvec3<T, P> const & Max)
+	{
+		tvec3<T, P> const Center = (Min + Max) * static_cast<T>(0.5);
+		tvec3<T, P> const Extent = (Max - Min) * static_cast<T>(0.5);
+
+		for(int i = 0; i < 6; ++i)
+		{
+			T const Distance = Planes[i].x * Center.x + Planes[i].y * Center.y + Planes[i].z * Center.z + Planes[i].w;
+			T const Radius = abs(Planes[i].x) * Extent.x + abs(Planes[i].y) * Extent.y + abs(Planes[i].z) * Extent.z;
+			if(Distance + Radius < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumCullSpheres(tvec4<T, P> const Planes[6], tvec4<T, P> const * Spheres, size_t Count, uint32 * Visibility)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_frustumCullSpheres<T, P>::call(Planes, Spheres, Count, Visibility);
+	}
+
+	template <typename T, precision P, typename genType>
+	GLM_FUNC_QUALIFIER void frustumCullSpheres(tvec4<T, P> const Planes[6], tstrided_view<genType> const & Spheres, uint32 * Visibility)
+	{
+		detail::batch_float_environment const Environment;
+		if(Spheres.contiguous() && detail::frustum_cull_spheres_contiguous(Planes, Spheres.data(), Spheres.size(), Visibility))
+			return;
+
+		// Blocks are a multiple of 32 spheres so that each block writes whole visibility words
+		size_t const BlockSize = 256;
+		tvec4<T, P> Block[BlockSize];
+		for(size_t First = 0; First < Spheres.size(); First += BlockSize)
+		{
+			size_t const Count = min(BlockSize, Spheres.size() - First);
+			for(size_t i = 0; i < Count; ++i)
+				Block[i] = Spheres[First + i];
+			detail::compute_frustumCullSpheres<T, P>::call(Planes, Block, Count, Visibility + First / 32);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumCullAABBs(tvec4<T, P> const Planes[6], tvec3<T, P> const * Min, tvec3<T, P> const * Max, size_t Count, uint32 * Visibility)
+	{
+		detail::batch_float_environment const Environment;
+		detail::compute_frustumCullAABBs<T, P>::call(Planes, Min, Max, Count, Visibility);
+	}
+}//namespace glm
@@ -7,6 +7,11 @@
 /// @ingroup gtx
 /// 
 /// @brief Add std::hash support for glm types
+///
+/// Vectors, quaternions and matrices are hashed as a single block of memory rather than component by component,
+/// so that a tmat4x4 costs a handful of multiplications instead of 16 std::hash calls.
+/// Floating-point +0 and -0 compare equal and hash to the same value.
+/// Hash values are not guaranteed to be stable across GLM versions or platforms.
 /// 
 /// <glm/gtx/hash.hpp> need to be included to use these functionalities.
 
@@ -21,6 +26,7 @@
 
 #include "../gtc/quaternion.hpp"
 #include "../gtx/dual_quaternion.hpp"
+#include "../gtc/type_ptr.hpp"
 
 #include "../mat2x2.hpp"
 #include "../mat2x3.hpp"
@@ -38,6 +44,45 @@
 #	error "GLM_GTX_hash requires C++11 standard library support"
 #endif
 
+namespace glm
+{
+	/// @addtogroup gtx_hash
+	/// @{
+
+	/// Hash the storage of a vector, quaternion or matrix as one block.
+	/// The 64 bits words of the storage are mixed with 32 by 32 bits multiplications then finalized with an avalanche.
+	///
+	/// @tparam genType tvec1, tvec2, tvec3, tvec4, tquat, tdualquat or tmatCxR type.
+	/// @param Value Value to hash.
+	/// @param Seed Seed of the hash.
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL uint64 hashBlock(genType const & Value, uint64 Seed = 0);
+
+	/// Hash an array of vectors, quaternions or matrices, producing the same values as hashBlock for each element.
+	/// With 32 bits components, 2 values are hashed per iteration using SSE2 and 4 using AVX2.
+	///
+	/// @param Values Array of values to hash.
+	/// @param Count Number of values.
+	/// @param Hashes Output array of Count hashes.
+	/// @param Seed Seed of the hash.
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL void hashBlock(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed = 0);
+
+	/// Hash the values of a strided view, for example the positions of an interleaved vertex buffer.
+	/// Values are gathered by blocks to run the SIMD kernel of the array version.
+	///
+	/// @param Values View of the values to hash.
+	/// @param Hashes Output array of Values.size() hashes.
+	/// @param Seed Seed of the hash.
+	/// @see gtx_hash
+	template <typename genType>
+	GLM_FUNC_DECL void hashBlock(tstrided_view<genType> const & Values, uint64 * Hashes, uint64 Seed = 0);
+
+	/// @}
+}//namespace glm
+
 namespace std
 {
 	template <typename T, glm::precision P>
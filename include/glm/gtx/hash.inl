@@ -10,7 +10,12 @@
 ///
 /// <glm/gtx/hash.inl> need to be included to use these functionalities.
 
-namespace glm {
+#include "../simd/cpu.h"
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace glm{
 namespace detail
 {
 	GLM_INLINE void hash_combine(size_t &seed, size_t hash)
@@ -18,168 +23,403 @@ namespace detail
 		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
 		seed ^= hash;
 	}
-}}
+
+	// One key per 64 bits word of the largest type, dmat4x4, taken from the default secret of XXH3
+	static uint64 const hash_secret[16] =
+	{
+		0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+		0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL, 0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL,
+		0xcb00c391bb52283cULL, 0xa32e531b8b65d088ULL, 0x4ef90da297486471ULL, 0xd8acdea946ef1938ULL,
+		0x3f349ce33f76faa8ULL, 0x1d4f0bc7c7bbdcf9ULL, 0x3159b4cd4be0518aULL, 0x647378d9c97e9fc8ULL
+	};
+
+	GLM_FUNC_QUALIFIER uint64 hash_accumulate(uint64 Acc, uint64 Word, uint64 Key)
+	{
+		// XXH3 accumulation: the swapped word keeps the input bits when a half of the keyed word is null
+		uint64 const Keyed = Word ^ Key;
+		return Acc + ((Word << 32) | (Word >> 32)) + (Keyed & 0xffffffffULL) * (Keyed >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_avalanche(uint64 Hash)
+	{
+		// MurmurHash3 fmix64
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdULL;
+		Hash ^= Hash >> 33;
+		Hash *= 0xc4ceb9fe1a85ec53ULL;
+		Hash ^= Hash >> 33;
+		return Hash;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T hash_canonicalize(T Value)
+	{
+		// Turn -0 into +0, integers are left unchanged
+		return std::numeric_limits<T>::is_iec559 && Value == static_cast<T>(0) ? static_cast<T>(0) : Value;
+	}
+
+	// Canonical bits of a component, zero extended to 64 bits
+	template <typename T>
+	GLM_FUNC_QUALIFIER uint64 hash_bits(T Value)
+	{
+		T const Canonical = hash_canonicalize(Value);
+		uint64 Bits = 0;
+		std::memcpy(&Bits, &Canonical, sizeof(T));
+		return Bits;
+	}
+
+	// Aligned types with 3 components columns are padded with an unspecified lane, they are hashed as their packed equivalent
+	template <typename genType>
+	struct hash_packed
+	{
+		typedef genType type;
+	};
+
+	template <typename T, precision P>
+	struct hash_packed<tvec3<T, P> >
+	{
+		typedef tvec3<T, packed_highp> type;
+	};
+
+	template <typename T, precision P>
+	struct hash_packed<tmat2x3<T, P> >
+	{
+		typedef tmat2x3<T, packed_highp> type;
+	};
+
+	template <typename T, precision P>
+	struct hash_packed<tmat3x3<T, P> >
+	{
+		typedef tmat3x3<T, packed_highp> type;
+	};
+
+	template <typename T, precision P>
+	struct hash_packed<tmat4x3<T, P> >
+	{
+		typedef tmat4x3<T, packed_highp> type;
+	};
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 hash_block(genType const & Value, uint64 Seed)
+	{
+		typedef typename genType::value_type T;
+
+		GLM_STATIC_ASSERT(sizeof(genType) % sizeof(T) == 0 && sizeof(genType) <= sizeof(hash_secret), "'hashBlock' requires a tightly packed glm type");
+
+		size_t const Components = sizeof(genType) / sizeof(T);
+		size_t const Words = (sizeof(genType) + 7) / 8;
+		T const * In = reinterpret_cast<T const *>(&Value);
+
+		uint64 Acc = Seed + sizeof(genType) * 0x9e3779b185ebca87ULL;
+		if(sizeof(T) == 8)
+		{
+			for(size_t i = 0; i < Components; ++i)
+				Acc = hash_accumulate(Acc, hash_bits(In[i]), hash_secret[i] + Seed);
+		}
+		else if(sizeof(T) == 4)
+		{
+			// Components are packed into words in memory order, like the SIMD loads of hashBlock arrays
+			for(size_t i = 0; i < Components; i += 2)
+			{
+				uint64 const Word = hash_bits(In[i]) | (i + 1 < Components ? hash_bits(In[i + 1]) << 32 : 0);
+				Acc = hash_accumulate(Acc, Word, hash_secret[i / 2] + Seed);
+			}
+		}
+		else
+		{
+			T Canonical[Words * 8 / sizeof(T)];
+			for(size_t i = 0; i < Words * 8 / sizeof(T); ++i)
+				Canonical[i] = i < Components ? hash_canonicalize(In[i]) : static_cast<T>(0);
+
+			uint64 Block[Words];
+			std::memcpy(Block, Canonical, sizeof(Block));
+			for(size_t i = 0; i < Words; ++i)
+				Acc = hash_accumulate(Acc, Block[i], hash_secret[i] + Seed);
+		}
+		return hash_avalanche(Acc);
+	}
+
+	template <typename genType, bool Simd>
+	struct compute_hashBlockArray
+	{
+		GLM_FUNC_QUALIFIER static void call(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed)
+		{
+			typedef typename hash_packed<genType>::type packed_type;
+
+			for(size_t i = 0; i < Count; ++i)
+				Hashes[i] = hash_block(packed_type(Values[i]), Seed);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Read the 64 bits word Word of a value, zero extending the last word of values with an odd number of 32 bits components.
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 hash_load_word(genType const & Value, size_t Word)
+	{
+		uint64 Result = 0;
+		std::memcpy(&Result, reinterpret_cast<char const *>(&Value) + Word * 8, Word * 8 + 8 <= sizeof(genType) ? 8 : 4);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i hash_canonicalize(__m128i Words, bool Float)
+	{
+		return Float ? _mm_andnot_si128(_mm_cmpeq_epi32(Words, _mm_set1_epi32(static_cast<int>(0x80000000))), Words) : Words;
+	}
+
+	GLM_FUNC_QUALIFIER __m128i hash_accumulate(__m128i Acc, __m128i Words, __m128i Key)
+	{
+		__m128i const Keyed = _mm_xor_si128(Words, Key);
+		__m128i const Product = _mm_mul_epu32(Keyed, _mm_srli_epi64(Keyed, 32));
+		__m128i const Swapped = _mm_shuffle_epi32(Words, _MM_SHUFFLE(2, 3, 0, 1));
+		return _mm_add_epi64(Acc, _mm_add_epi64(Swapped, Product));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i hash_mul64(__m128i a, __m128i b)
+	{
+		// Low 64 bits of a 64 by 64 bits multiplication, without the high 32 bits product
+		__m128i const Low = _mm_mul_epu32(a, b);
+		__m128i const Cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+		return _mm_add_epi64(Low, _mm_slli_epi64(Cross, 32));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i hash_avalanche(__m128i Hash)
+	{
+		Hash = _mm_xor_si128(Hash, _mm_srli_epi64(Hash, 33));
+		Hash = hash_mul64(Hash, _mm_set1_epi64x(static_cast<long long>(0xff51afd7ed558ccdULL)));
+		Hash = _mm_xor_si128(Hash, _mm_srli_epi64(Hash, 33));
+		Hash = hash_mul64(Hash, _mm_set1_epi64x(static_cast<long long>(0xc4ceb9fe1a85ec53ULL)));
+		Hash = _mm_xor_si128(Hash, _mm_srli_epi64(Hash, 33));
+		return Hash;
+	}
+
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256i hash_canonicalize(__m256i Words, bool Float)
+	{
+		return Float ? _mm256_andnot_si256(_mm256_cmpeq_epi32(Words, _mm256_set1_epi32(static_cast<int>(0x80000000))), Words) : Words;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256i hash_accumulate(__m256i Acc, __m256i Words, __m256i Key)
+	{
+		__m256i const Keyed = _mm256_xor_si256(Words, Key);
+		__m256i const Product = _mm256_mul_epu32(Keyed, _mm256_srli_epi64(Keyed, 32));
+		__m256i const Swapped = _mm256_shuffle_epi32(Words, _MM_SHUFFLE(2, 3, 0, 1));
+		return _mm256_add_epi64(Acc, _mm256_add_epi64(Swapped, Product));
+	}
+
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256i hash_mul64(__m256i a, __m256i b)
+	{
+		__m256i const Low = _mm256_mul_epu32(a, b);
+		__m256i const Cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+		return _mm256_add_epi64(Low, _mm256_slli_epi64(Cross, 32));
+	}
+
+	GLM_FUNC_QUALIFIER GLM_TARGET_AVX2 __m256i hash_avalanche(__m256i Hash)
+	{
+		Hash = _mm256_xor_si256(Hash, _mm256_srli_epi64(Hash, 33));
+		Hash = hash_mul64(Hash, _mm256_set1_epi64x(static_cast<long long>(0xff51afd7ed558ccdULL)));
+		Hash = _mm256_xor_si256(Hash, _mm256_srli_epi64(Hash, 33));
+		Hash = hash_mul64(Hash, _mm256_set1_epi64x(static_cast<long long>(0xc4ceb9fe1a85ec53ULL)));
+		Hash = _mm256_xor_si256(Hash, _mm256_srli_epi64(Hash, 33));
+		return Hash;
+	}
+#	endif//(GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+
+	// Values with 32 bits components are hashed in parallel, one value per 64 bits lane.
+	// Canonicalizing each 32 bits half of a word matches the per component scalar canonicalization.
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void hash_block_array_sse2(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed)
+	{
+		bool const Float = std::numeric_limits<typename genType::value_type>::is_iec559;
+		size_t const Words = (sizeof(genType) + 7) / 8;
+		long long const Length = static_cast<long long>(Seed + sizeof(genType) * 0x9e3779b185ebca87ULL);
+
+		size_t i = 0;
+		for(; i + 2 <= Count; i += 2)
+		{
+			__m128i Acc = _mm_set1_epi64x(Length);
+			for(size_t w = 0; w < Words; ++w)
+			{
+				__m128i const Word = _mm_set_epi64x(static_cast<long long>(hash_load_word(Values[i + 1], w)), static_cast<long long>(hash_load_word(Values[i + 0], w)));
+				Acc = hash_accumulate(Acc, hash_canonicalize(Word, Float), _mm_set1_epi64x(static_cast<long long>(hash_secret[w] + Seed)));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Hashes + i), hash_avalanche(Acc));
+		}
+		for(; i < Count; ++i)
+			Hashes[i] = hash_block(Values[i], Seed);
+	}
+
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+	// Not force inlined: with runtime dispatch, it is called through a function pointer from SSE2 code
+	template <typename genType>
+	GLM_TARGET_AVX2 void hash_block_array_avx2(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed)
+	{
+		bool const Float = std::numeric_limits<typename genType::value_type>::is_iec559;
+		size_t const Words = (sizeof(genType) + 7) / 8;
+		long long const Length = static_cast<long long>(Seed + sizeof(genType) * 0x9e3779b185ebca87ULL);
+
+		size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			__m256i Acc = _mm256_set1_epi64x(Length);
+			for(size_t w = 0; w < Words; ++w)
+			{
+				__m256i const Word = _mm256_set_epi64x(
+					static_cast<long long>(hash_load_word(Values[i + 3], w)), static_cast<long long>(hash_load_word(Values[i + 2], w)),
+					static_cast<long long>(hash_load_word(Values[i + 1], w)), static_cast<long long>(hash_load_word(Values[i + 0], w)));
+				Acc = hash_accumulate(Acc, hash_canonicalize(Word, Float), _mm256_set1_epi64x(static_cast<long long>(hash_secret[w] + Seed)));
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Hashes + i), hash_avalanche(Acc));
+		}
+		hash_block_array_sse2(Values + i, Count - i, Hashes + i, Seed);
+	}
+#	endif//(GLM_ARCH & GLM_ARCH_AVX2_BIT) || GLM_HAS_RUNTIME_DISPATCH
+
+	template <typename genType>
+	struct compute_hashBlockArray<genType, true>
+	{
+		typedef void (*kernel)(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed);
+
+		GLM_FUNC_QUALIFIER static void call(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed)
+		{
+#			if GLM_HAS_RUNTIME_DISPATCH
+				static kernel const Kernel = glm_cpu_arch() & GLM_ARCH_AVX2_BIT ? &hash_block_array_avx2<genType> : &hash_block_array_sse2<genType>;
+				Kernel(Values, Count, Hashes, Seed);
+#			elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+				hash_block_array_avx2(Values, Count, Hashes, Seed);
+#			else
+				hash_block_array_sse2(Values, Count, Hashes, Seed);
+#			endif
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER uint64 hashBlock(genType const & Value, uint64 Seed)
+	{
+		typedef typename detail::hash_packed<genType>::type packed_type;
+		return detail::hash_block(packed_type(Value), Seed);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void hashBlock(genType const * Values, size_t Count, uint64 * Hashes, uint64 Seed)
+	{
+		typedef typename detail::hash_packed<genType>::type packed_type;
+		detail::compute_hashBlockArray<genType, (GLM_ARCH & GLM_ARCH_SSE2_BIT) != 0 && sizeof(typename genType::value_type) == 4 && sizeof(genType) == sizeof(packed_type)>::call(Values, Count, Hashes, Seed);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void hashBlock(tstrided_view<genType> const & Values, uint64 * Hashes, uint64 Seed)
+	{
+		typedef typename std::remove_const<genType>::type value_type;
+
+		if(Values.contiguous())
+		{
+			glm::hashBlock<value_type>(Values.data(), Values.size(), Hashes, Seed);
+			return;
+		}
+
+		size_t const BlockSize = 64;
+		value_type Block[BlockSize];
+		for(size_t First = 0; First < Values.size(); First += BlockSize)
+		{
+			size_t const Count = glm::min(BlockSize, Values.size() - First);
+			for(size_t i = 0; i < Count; ++i)
+				Block[i] = Values[First + i];
+			glm::hashBlock<value_type>(Block, Count, Hashes + First, Seed);
+		}
+	}
+}//namespace glm
 
 namespace std
 {
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec1<T, P>>::operator()(glm::tvec1<T, P> const & v) const
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return static_cast<size_t>(glm::hashBlock(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec2<T, P>>::operator()(glm::tvec2<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec3<T, P>>::operator()(glm::tvec3<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tvec4<T, P>>::operator()(glm::tvec4<T, P> const & v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(v));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tquat<T, P>>::operator()(glm::tquat<T,P> const & q) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(q));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tdualquat<T, P>>::operator()(glm::tdualquat<T, P> const & q) const
 	{
-		size_t seed = 0;
-		hash<glm::tquat<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(q.real));
-		glm::detail::hash_combine(seed, hasher(q.dual));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(q));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x2<T, P>>::operator()(glm::tmat2x2<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x3<T, P>>::operator()(glm::tmat2x3<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat2x4<T, P>>::operator()(glm::tmat2x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x2<T, P>>::operator()(glm::tmat3x2<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x3<T, P>>::operator()(glm::tmat3x3<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat3x4<T, P>>::operator()(glm::tmat3x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x2<T,P>>::operator()(glm::tmat4x2<T,P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec2<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x3<T,P>>::operator()(glm::tmat4x3<T,P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec3<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 
 	template <typename T, glm::precision P>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tmat4x4<T,P>>::operator()(glm::tmat4x4<T, P> const & m) const
 	{
-		size_t seed = 0;
-		hash<glm::tvec4<T, P>> hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashBlock(m));
 	}
 }
@@ -0,0 +1,79 @@
+/// @ref gtx_profiling
+/// @file glm/gtx/profiling.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_profiling GLM_GTX_profiling
+/// @ingroup gtx
+///
+/// @brief Report which vector and matrix functions ran through their generic implementation rather than a SIMD one.
+///
+/// When GLM_ENABLE_PROFILING is defined before including GLM, every call to the generic or SIMD implementation
+/// of a vector or matrix function increments a counter of its template instantiation. The report reveals aligned
+/// types falling back to the generic implementation and hot functions lacking a SIMD path.
+/// GLM_ENABLE_PROFILING must be defined consistently in all the translation units of a program.
+/// With GLM_FORCE_DEBUG_FAST, the vector arithmetic operators are written component wise and are counted as calls of
+/// the generic implementation, e.g. "compute_vec4_add", including for the aligned types.
+/// Without it, the counters don't exist and the reports are empty.
+///
+/// <glm/gtx/profiling.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstdio>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_profiling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_profiling
+	/// @{
+
+	/// Calls of one template instantiation of a generic or SIMD implementation.
+	/// @see gtx_profiling
+	struct profile_record
+	{
+		/// Name of the implementation, shared by its instantiations, e.g. "compute_vec4_add".
+		char const * Function;
+		/// Signature of the instantiation, including its template arguments when the compiler provides them.
+		char const * Signature;
+		/// Whether the instantiation is a SIMD implementation.
+		bool Simd;
+		/// Number of calls since the program started or since the last profileReset.
+		uint64 Calls;
+	};
+
+	/// Function called with the name and signature of every instrumented implementation called.
+	/// @see gtx_profiling
+	typedef void (*profile_callback)(char const * Function, char const * Signature, bool Simd);
+
+	/// Set the function called on each call of an instrumented implementation, null to stop calling it.
+	/// The callback may be called concurrently by the threads using GLM.
+	/// @see gtx_profiling
+	GLM_FUNC_DECL void profileCallback(profile_callback Callback);
+
+	/// Copy up to Count records of the instantiations called at least once, ordered by function, generic first.
+	/// @return The number of records available, which may be greater than Count.
+	/// @see gtx_profiling
+	GLM_FUNC_DECL std::size_t profileRecords(profile_record * Records, std::size_t Count);
+
+	/// Number of calls of the generic and SIMD implementations of Function, all instantiations summed.
+	/// @see gtx_profiling
+	GLM_FUNC_DECL uint64 profileCalls(char const * Function, bool Simd);
+
+	/// Set all the counters to 0.
+	/// @see gtx_profiling
+	GLM_FUNC_DECL void profileReset();
+
+	/// Print the records to File, one instantiation per line, followed by the totals of generic and SIMD calls.
+	/// @see gtx_profiling
+	GLM_FUNC_DECL void profileDump(std::FILE * File);
+
+	/// @}
+}//namespace glm
+
+#include "profiling.inl"
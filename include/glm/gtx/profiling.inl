@@ -0,0 +1,121 @@
+/// @ref gtx_profiling
+/// @file glm/gtx/profiling.inl
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+#	if GLM_PROFILING
+		GLM_FUNC_QUALIFIER profile_counter * profile_first()
+		{
+#			if GLM_HAS_CXX11_STL
+				return profile_counters().load(std::memory_order_acquire);
+#			else
+				return profile_counters();
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER uint64 profile_calls(profile_counter const & Counter)
+		{
+#			if GLM_HAS_CXX11_STL
+				return Counter.Calls.load(std::memory_order_relaxed);
+#			else
+				return Counter.Calls;
+#			endif
+		}
+#	endif//GLM_PROFILING
+
+	struct profile_record_less
+	{
+		GLM_FUNC_QUALIFIER bool operator()(profile_record const & a, profile_record const & b) const
+		{
+			int const Function = std::strcmp(a.Function, b.Function);
+			if(Function != 0)
+				return Function < 0;
+			if(a.Simd != b.Simd)
+				return b.Simd;
+			return std::strcmp(a.Signature, b.Signature) < 0;
+		}
+	};
+
+	GLM_FUNC_QUALIFIER std::vector<profile_record> profile_collect()
+	{
+		std::vector<profile_record> Records;
+
+#		if GLM_PROFILING
+			for(profile_counter * Counter = profile_first(); Counter; Counter = Counter->Next)
+			{
+				profile_record const Record = {Counter->Function, Counter->Signature, Counter->Simd, profile_calls(*Counter)};
+				if(Record.Calls > 0)
+					Records.push_back(Record);
+			}
+#		endif//GLM_PROFILING
+
+		std::sort(Records.begin(), Records.end(), profile_record_less());
+		return Records;
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void profileCallback(profile_callback Callback)
+	{
+#		if GLM_PROFILING
+#			if GLM_HAS_CXX11_STL
+				detail::profile_callback_storage().store(Callback, std::memory_order_relaxed);
+#			else
+				detail::profile_callback_storage() = Callback;
+#			endif
+#		else
+			static_cast<void>(Callback);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t profileRecords(profile_record * Records, std::size_t Count)
+	{
+		std::vector<profile_record> const Collected = detail::profile_collect();
+		std::copy(Collected.begin(), Collected.begin() + std::min(Count, Collected.size()), Records);
+		return Collected.size();
+	}
+
+	GLM_FUNC_QUALIFIER uint64 profileCalls(char const * Function, bool Simd)
+	{
+		uint64 Calls = 0;
+
+#		if GLM_PROFILING
+			for(detail::profile_counter * Counter = detail::profile_first(); Counter; Counter = Counter->Next)
+				if(Counter->Simd == Simd && std::strcmp(Counter->Function, Function) == 0)
+					Calls += detail::profile_calls(*Counter);
+#		else
+			static_cast<void>(Function);
+			static_cast<void>(Simd);
+#		endif
+
+		return Calls;
+	}
+
+	GLM_FUNC_QUALIFIER void profileReset()
+	{
+#		if GLM_PROFILING
+			for(detail::profile_counter * Counter = detail::profile_first(); Counter; Counter = Counter->Next)
+				Counter->Calls = 0;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void profileDump(std::FILE * File)
+	{
+		std::vector<profile_record> const Records = detail::profile_collect();
+
+		uint64 GenericCalls = 0;
+		uint64 SimdCalls = 0;
+		for(std::size_t i = 0; i < Records.size(); ++i)
+		{
+			std::fprintf(File, "%-28s %-7s %12llu  %s\n", Records[i].Function, Records[i].Simd ? "SIMD" : "generic", static_cast<unsigned long long>(Records[i].Calls), Records[i].Signature);
+			(Records[i].Simd ? SimdCalls : GenericCalls) += Records[i].Calls;
+		}
+
+		std::fprintf(File, "%-28s %-7s %12llu\n", "total", "generic", static_cast<unsigned long long>(GenericCalls));
+		std::fprintf(File, "%-28s %-7s %12llu\n", "total", "SIMD", static_cast<unsigned long long>(SimdCalls));
+	}
+}//namespace glm
@@ -0,0 +1,98 @@
+/// @ref gtx_radix_sort
+/// @file glm/gtx/radix_sort.hpp
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+///
+/// @defgroup gtx_radix_sort GLM_GTX_radix_sort
+/// @ingroup gtx
+///
+/// @brief Sort key and index pairs with a least significant digit radix sort and build the Z-order of point sets.
+///
+/// Keys are typically Morton codes produced by bitfieldInterleave.
+/// Keys are sorted one byte per pass, all the byte histograms being built by a single read of the keys.
+/// Passes where every key shares the same byte are skipped, so 30 bits Morton keys take at most 4 passes.
+/// When OpenMP is enabled, the histograms of large arrays are built in parallel.
+///
+/// <glm/gtx/radix_sort.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtc/type_ptr.hpp"
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_radix_sort extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_radix_sort
+	/// @{
+
+	/// Sort Keys in ascending order, moving Indices along with them.
+	/// The sort is stable: pairs with equal keys keep their relative order.
+	///
+	/// @tparam genUType uint32 or uint64.
+	/// @param Keys Array of Count keys, sorted in place.
+	/// @param Indices Array of Count values permuted like Keys, for example the indices of the sorted objects.
+	/// @param Count Number of pairs.
+	/// @param KeysScratch Temporary storage of Count keys.
+	/// @param IndicesScratch Temporary storage of Count indices.
+	/// @see gtx_radix_sort
+	template <typename genUType>
+	GLM_FUNC_DECL void radixSort(genUType * Keys, uint32 * Indices, size_t Count, genUType * KeysScratch, uint32 * IndicesScratch);
+
+	/// Sort Keys in ascending order, moving Indices along with them.
+	/// The sort is stable and allocates its temporary storage.
+	///
+	/// @tparam genUType uint32 or uint64.
+	/// @see gtx_radix_sort
+	template <typename genUType>
+	GLM_FUNC_DECL void radixSort(genUType * Keys, uint32 * Indices, size_t Count);
+
+	/// Compute the Z-order of an array of positions.
+	/// Positions are quantized to 10 bits per axis inside the [Min, Max] box, positions outside the box being clamped,
+	/// then interleaved into 30 bits Morton keys and radix sorted.
+	///
+	/// @param Positions Array of positions.
+	/// @param Count Number of positions.
+	/// @param Min Minimum corner of the quantization box.
+	/// @param Max Maximum corner of the quantization box.
+	/// @param Permutation Output array receiving the indices of the positions sorted along the Z-order curve.
+	/// @see gtx_radix_sort
+	template <typename T, precision P>
+	GLM_FUNC_DECL void mortonOrder(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation);
+
+	/// Compute the Z-order of an array of positions.
+	/// Positions are quantized to 21 bits per axis inside the [Min, Max] box, positions outside the box being clamped,
+	/// then interleaved into 63 bits Morton keys and radix sorted.
+	///
+	/// @param Positions Array of positions.
+	/// @param Count Number of positions.
+	/// @param Min Minimum corner of the quantization box.
+	/// @param Max Maximum corner of the quantization box.
+	/// @param Permutation Output array receiving the indices of the positions sorted along the Z-order curve.
+	/// @see gtx_radix_sort
+	template <typename T, precision P>
+	GLM_FUNC_DECL void mortonOrder64(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation);
+
+	/// Compute the Z-order of the positions of a strided view, for example of an interleaved vertex buffer, using 30 bits Morton keys.
+	/// @see gtx_radix_sort
+	/// @see - mortonOrder(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	template <typename genType, typename T, precision P>
+	GLM_FUNC_DECL void mortonOrder(tstrided_view<genType> const & Positions, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation);
+
+	/// Compute the Z-order of the positions of a strided view, for example of an interleaved vertex buffer, using 63 bits Morton keys.
+	/// @see gtx_radix_sort
+	/// @see - mortonOrder64(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	template <typename genType, typename T, precision P>
+	GLM_FUNC_DECL void mortonOrder64(tstrided_view<genType> const & Positions, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation);
+
+	/// @}
+}// namespace glm
+
+#include "radix_sort.inl"
@@ -0,0 +1,176 @@
+/// @ref gtx_radix_sort
+/// @file glm/gtx/radix_sort.inl
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Below this count, spawning threads costs more than building the histograms.
+	static size_t const radix_sort_parallel_count = 1 << 16;
+
+	template <typename genUType>
+	GLM_FUNC_QUALIFIER void radix_sort_histograms(genUType const * Keys, size_t Count, uint32 * Histograms)
+	{
+		for(size_t i = 0; i < Count; ++i)
+		{
+			genUType const Key = Keys[i];
+			for(size_t Digit = 0; Digit < sizeof(genUType); ++Digit)
+				++Histograms[Digit * 256 + ((Key >> (Digit * 8)) & 0xFF)];
+		}
+	}
+
+	template <typename genUType>
+	GLM_FUNC_QUALIFIER void radix_sort(genUType * Keys, uint32 * Indices, size_t Count, genUType * KeysScratch, uint32 * IndicesScratch)
+	{
+		GLM_STATIC_ASSERT(!std::numeric_limits<genUType>::is_signed && std::numeric_limits<genUType>::is_integer, "'radixSort' only accept unsigned integer keys");
+
+		if(Count < 2)
+			return;
+
+		size_t const Digits = sizeof(genUType);
+		uint32 Histograms[Digits * 256] = {0};
+
+#		if GLM_HAS_OPENMP
+		if(Count >= radix_sort_parallel_count)
+		{
+			int const Chunks = 16;
+			std::vector<uint32> Partials(Chunks * Digits * 256, 0);
+
+#			pragma omp parallel for
+			for(int Chunk = 0; Chunk < Chunks; ++Chunk)
+			{
+				size_t const First = Count / Chunks * Chunk;
+				size_t const Last = Chunk == Chunks - 1 ? Count : First + Count / Chunks;
+				radix_sort_histograms(Keys + First, Last - First, &Partials[Chunk * Digits * 256]);
+			}
+
+			for(int Chunk = 0; Chunk < Chunks; ++Chunk)
+			for(size_t i = 0; i < Digits * 256; ++i)
+				Histograms[i] += Partials[Chunk * Digits * 256 + i];
+		}
+		else
+#		endif//GLM_HAS_OPENMP
+			radix_sort_histograms(Keys, Count, Histograms);
+
+		genUType * SrcKeys = Keys;
+		uint32 * SrcIndices = Indices;
+		genUType * DstKeys = KeysScratch;
+		uint32 * DstIndices = IndicesScratch;
+
+		for(size_t Digit = 0; Digit < Digits; ++Digit)
+		{
+			size_t const Shift = Digit * 8;
+			uint32 const * Histogram = Histograms + Digit * 256;
+
+			// All the keys share this byte, the pass would not move anything
+			if(Histogram[(SrcKeys[0] >> Shift) & 0xFF] == Count)
+				continue;
+
+			uint32 Offsets[256];
+			uint32 Sum = 0;
+			for(size_t Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				Offsets[Bucket] = Sum;
+				Sum += Histogram[Bucket];
+			}
+
+			for(size_t i = 0; i < Count; ++i)
+			{
+				genUType const Key = SrcKeys[i];
+				uint32 const Offset = Offsets[(Key >> Shift) & 0xFF]++;
+				DstKeys[Offset] = Key;
+				DstIndices[Offset] = SrcIndices[i];
+			}
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcIndices, DstIndices);
+		}
+
+		if(SrcKeys != Keys)
+		{
+			std::copy(SrcKeys, SrcKeys + Count, Keys);
+			std::copy(SrcIndices, SrcIndices + Count, Indices);
+		}
+	}
+
+	// Positions is an array or a tstrided_view of tvec3
+	template <typename T, precision P, typename genUType, typename positionsType>
+	GLM_FUNC_QUALIFIER void morton_order(positionsType const & Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation, uint32 Bits)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mortonOrder' only accept floating-point positions");
+
+		std::vector<genUType> Keys(Count);
+
+		T const Limit = static_cast<T>((1u << Bits) - 1u);
+		tvec3<T, P> const Extent(Max - Min);
+		tvec3<T, P> const Scale(
+			Extent.x > static_cast<T>(0) ? Limit / Extent.x : static_cast<T>(0),
+			Extent.y > static_cast<T>(0) ? Limit / Extent.y : static_cast<T>(0),
+			Extent.z > static_cast<T>(0) ? Limit / Extent.z : static_cast<T>(0));
+
+		// Quantize by blocks to feed the SIMD bitfieldInterleave kernels from a buffer that stays in L1
+		size_t const BlockSize = 256;
+		tvec3<uint32, defaultp> Block[BlockSize];
+		for(size_t First = 0; First < Count; First += BlockSize)
+		{
+			size_t const Size = Count - First < BlockSize ? Count - First : BlockSize;
+			for(size_t i = 0; i < Size; ++i)
+			{
+				tvec3<T, P> const Cell(clamp((Positions[First + i] - Min) * Scale, static_cast<T>(0), Limit));
+				Block[i] = tvec3<uint32, defaultp>(Cell + static_cast<T>(0.5));
+			}
+			bitfieldInterleave(Block, &Keys[First], Size);
+		}
+
+		for(size_t i = 0; i < Count; ++i)
+			Permutation[i] = static_cast<uint32>(i);
+
+		std::vector<genUType> KeysScratch(Count);
+		std::vector<uint32> IndicesScratch(Count);
+		radix_sort(Count ? &Keys[0] : NULL, Permutation, Count, Count ? &KeysScratch[0] : NULL, Count ? &IndicesScratch[0] : NULL);
+	}
+}//namespace detail
+
+	template <typename genUType>
+	GLM_FUNC_QUALIFIER void radixSort(genUType * Keys, uint32 * Indices, size_t Count, genUType * KeysScratch, uint32 * IndicesScratch)
+	{
+		detail::radix_sort(Keys, Indices, Count, KeysScratch, IndicesScratch);
+	}
+
+	template <typename genUType>
+	GLM_FUNC_QUALIFIER void radixSort(genUType * Keys, uint32 * Indices, size_t Count)
+	{
+		if(Count < 2)
+			return;
+
+		std::vector<genUType> KeysScratch(Count);
+		std::vector<uint32> IndicesScratch(Count);
+		detail::radix_sort(Keys, Indices, Count, &KeysScratch[0], &IndicesScratch[0]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonOrder(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	{
+		detail::morton_order<T, P, uint32>(Positions, Count, Min, Max, Permutation, 10);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonOrder64(tvec3<T, P> const * Positions, size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	{
+		detail::morton_order<T, P, uint64>(Positions, Count, Min, Max, Permutation, 21);
+	}
+
+	template <typename genType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonOrder(tstrided_view<genType> const & Positions, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	{
+		detail::morton_order<T, P, uint32>(Positions, Positions.size(), Min, Max, Permutation, 10);
+	}
+
+	template <typename genType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonOrder64(tstrided_view<genType> const & Positions, tvec3<T, P> const & Min, tvec3<T, P> const & Max, uint32 * Permutation)
+	{
+		detail::morton_order<T, P, uint64>(Positions, Positions.size(), Min, Max, Permutation, 21);
+	}
+}//namespace glm
@@ -0,0 +1,129 @@
+/// @ref gtx_spatial_hash
+/// @file glm/gtx/spatial_hash.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_spatial_hash GLM_GTX_spatial_hash
+/// @ingroup gtx
+///
+/// @brief Uniform grid of points stored in a hash table of cells, for neighbor searches.
+///
+/// A point p belongs to the cell floor(p / cellSize). Only non-empty cells are stored,
+/// in an open addressing table with linear probing. The points are kept sorted by cell
+/// in flat arrays, so that the points of a cell are contiguous in memory.
+///
+/// <glm/gtx/spatial_hash.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_ptr.hpp"
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_spatial_hash extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spatial_hash
+	/// @{
+
+	/// Uniform spatial hash grid of 3 components points.
+	///
+	/// Points are identified by their insertion index.
+	/// @see gtx_spatial_hash
+	template <typename T, precision P = defaultp>
+	class tspatial_hash
+	{
+	public:
+		// -- Implementation detail --
+
+		typedef tvec3<T, P> position_type;
+		typedef tvec3<int, P> cell_type;
+
+		// -- Constructors --
+
+		/// @param CellSize Edge length of the grid cells, typically the search radius.
+		GLM_FUNC_DECL explicit tspatial_hash(T CellSize);
+
+		// -- Accesses --
+
+		/// Edge length of the grid cells.
+		GLM_FUNC_DECL T cellSize() const;
+
+		/// Number of points in the grid.
+		GLM_FUNC_DECL size_t size() const;
+
+		/// Number of non-empty cells.
+		GLM_FUNC_DECL size_t cellCount() const;
+
+		/// Position of the point inserted with the given index.
+		GLM_FUNC_DECL position_type const & position(uint32 Index) const;
+
+		/// Cell containing a position: floor(Position / cellSize()).
+		GLM_FUNC_DECL cell_type cell(position_type const & Position) const;
+
+		// -- Modifiers --
+
+		/// Remove all the points.
+		GLM_FUNC_DECL void clear();
+
+		/// Insert an array of points. The points receive the indices size() to size() + Count - 1.
+		/// The flat layout is rebuilt once per call with a counting sort, in O(size() + Count),
+		/// so points should be inserted in large batches.
+		GLM_FUNC_DECL void insert(position_type const * Positions, size_t Count);
+
+		/// Insert the points of a strided view, for example the positions of an interleaved vertex buffer.
+		template <typename genType>
+		GLM_FUNC_DECL void insert(tstrided_view<genType> const & Positions);
+
+		// -- Queries --
+
+		/// Get the points of a cell.
+		/// @param Cell Cell to look up.
+		/// @param Indices Receive the insertion indices of the points of the cell.
+		/// @param Positions Receive the positions of the points of the cell, stored in the same order as Indices.
+		/// @return Number of points in the cell, 0 if the cell is empty.
+		GLM_FUNC_DECL size_t cellPoints(cell_type const & Cell, uint32 const *& Indices, position_type const *& Positions) const;
+
+		/// Append to Result the indices of the points whose distance to Center is at most Radius.
+		/// @return Number of indices appended.
+		GLM_FUNC_DECL size_t queryRadius(position_type const & Center, T Radius, std::vector<uint32> & Result) const;
+
+		/// Call Visitor(uint32 const * Indices, position_type const * Positions, size_t Count) for each
+		/// non-empty cell among the 27 cells surrounding and including Cell.
+		/// With cellSize() equal to the search radius, these cells hold every neighbor of the points of Cell.
+		template <typename visitorType>
+		GLM_FUNC_DECL void forEachNeighborCell(cell_type const & Cell, visitorType & Visitor) const;
+
+	private:
+		struct slot
+		{
+			cell_type Cell;
+			uint32 First;
+			uint32 Count;
+		};
+
+		GLM_FUNC_DECL uint32 hash(cell_type const & Cell) const;
+		GLM_FUNC_DECL slot const * find(cell_type const & Cell) const;
+		GLM_FUNC_DECL void build();
+
+		T cellSize_;
+		T invCellSize_;
+		uint32 shift_;
+		size_t cellCount_;
+		std::vector<position_type> positions_;			// In insertion order
+		std::vector<slot> slots_;						// Empty slots have a null Count
+		std::vector<uint32> sortedIndices_;				// Grouped by cell
+		std::vector<position_type> sortedPositions_;	// Grouped by cell
+	};
+
+	typedef tspatial_hash<float, defaultp>		spatial_hash;
+	typedef tspatial_hash<double, defaultp>		dspatial_hash;
+
+	/// @}
+}// namespace glm
+
+#include "spatial_hash.inl"
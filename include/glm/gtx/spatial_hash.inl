@@ -0,0 +1,254 @@
+/// @ref gtx_spatial_hash
+/// @file glm/gtx/spatial_hash.inl
+
+#include <limits>
+
+namespace glm
+{
+	// -- Constructors --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tspatial_hash<T, P>::tspatial_hash(T CellSize)
+		: cellSize_(CellSize)
+		, invCellSize_(static_cast<T>(1) / CellSize)
+		, shift_(32)
+		, cellCount_(0)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'tspatial_hash' only accept floating-point positions");
+		assert(CellSize > static_cast<T>(0));
+	}
+
+	// -- Accesses --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T tspatial_hash<T, P>::cellSize() const
+	{
+		return cellSize_;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t tspatial_hash<T, P>::size() const
+	{
+		return positions_.size();
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t tspatial_hash<T, P>::cellCount() const
+	{
+		return cellCount_;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename tspatial_hash<T, P>::position_type const & tspatial_hash<T, P>::position(uint32 Index) const
+	{
+		assert(Index < positions_.size());
+		return positions_[Index];
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename tspatial_hash<T, P>::cell_type tspatial_hash<T, P>::cell(position_type const & Position) const
+	{
+		return cell_type(floor(Position * invCellSize_));
+	}
+
+	// -- Modifiers --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspatial_hash<T, P>::clear()
+	{
+		shift_ = 32;
+		cellCount_ = 0;
+		positions_.clear();
+		slots_.clear();
+		sortedIndices_.clear();
+		sortedPositions_.clear();
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspatial_hash<T, P>::insert(position_type const * Positions, size_t Count)
+	{
+		if(Count == 0)
+			return;
+
+		positions_.insert(positions_.end(), Positions, Positions + Count);
+		this->build();
+	}
+
+	template <typename T, precision P>
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void tspatial_hash<T, P>::insert(tstrided_view<genType> const & Positions)
+	{
+		if(Positions.size() == 0)
+			return;
+
+		positions_.insert(positions_.end(), Positions.begin(), Positions.end());
+		this->build();
+	}
+
+	// -- Queries --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t tspatial_hash<T, P>::cellPoints(cell_type const & Cell, uint32 const *& Indices, position_type const *& Positions) const
+	{
+		slot const * Slot = this->find(Cell);
+		if(!Slot)
+		{
+			Indices = NULL;
+			Positions = NULL;
+			return 0;
+		}
+
+		Indices = &sortedIndices_[Slot->First];
+		Positions = &sortedPositions_[Slot->First];
+		return Slot->Count;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t tspatial_hash<T, P>::queryRadius(position_type const & Center, T Radius, std::vector<uint32> & Result) const
+	{
+		size_t const ResultSize = Result.size();
+		T const Radius2 = Radius * Radius;
+
+		cell_type const Min(this->cell(Center - Radius));
+		cell_type const Max(this->cell(Center + Radius));
+		double const Volume = static_cast<double>(Max.x - Min.x + 1) * static_cast<double>(Max.y - Min.y + 1) * static_cast<double>(Max.z - Min.z + 1);
+
+		// When the sphere covers more cells than the grid holds, walking the table is cheaper than probing each cell
+		if(Volume > static_cast<double>(cellCount_))
+		{
+			for(size_t i = 0; i < slots_.size(); ++i)
+			{
+				slot const & Slot = slots_[i];
+				if(Slot.Count == 0 || any(lessThan(Slot.Cell, Min)) || any(greaterThan(Slot.Cell, Max)))
+					continue;
+
+				for(uint32 j = Slot.First; j < Slot.First + Slot.Count; ++j)
+				{
+					position_type const Offset(sortedPositions_[j] - Center);
+					if(dot(Offset, Offset) <= Radius2)
+						Result.push_back(sortedIndices_[j]);
+				}
+			}
+		}
+		else
+		{
+			for(int z = Min.z; z <= Max.z; ++z)
+			for(int y = Min.y; y <= Max.y; ++y)
+			for(int x = Min.x; x <= Max.x; ++x)
+			{
+				slot const * Slot = this->find(cell_type(x, y, z));
+				if(!Slot)
+					continue;
+
+				for(uint32 j = Slot->First; j < Slot->First + Slot->Count; ++j)
+				{
+					position_type const Offset(sortedPositions_[j] - Center);
+					if(dot(Offset, Offset) <= Radius2)
+						Result.push_back(sortedIndices_[j]);
+				}
+			}
+		}
+
+		return Result.size() - ResultSize;
+	}
+
+	template <typename T, precision P>
+	template <typename visitorType>
+	GLM_FUNC_QUALIFIER void tspatial_hash<T, P>::forEachNeighborCell(cell_type const & Cell, visitorType & Visitor) const
+	{
+		for(int z = -1; z <= 1; ++z)
+		for(int y = -1; y <= 1; ++y)
+		for(int x = -1; x <= 1; ++x)
+		{
+			slot const * Slot = this->find(Cell + cell_type(x, y, z));
+			if(Slot)
+				Visitor(&sortedIndices_[Slot->First], &sortedPositions_[Slot->First], static_cast<size_t>(Slot->Count));
+		}
+	}
+
+	// -- Implementation --
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER uint32 tspatial_hash<T, P>::hash(cell_type const & Cell) const
+	{
+		// Spatial hashing primes from Teschner et al. 2003, followed by a Fibonacci hashing to use the high bits
+		uint32 const Hash =
+			(static_cast<uint32>(Cell.x) * 73856093u) ^
+			(static_cast<uint32>(Cell.y) * 19349663u) ^
+			(static_cast<uint32>(Cell.z) * 83492791u);
+		return (Hash * 2654435769u) >> shift_;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER typename tspatial_hash<T, P>::slot const * tspatial_hash<T, P>::find(cell_type const & Cell) const
+	{
+		if(slots_.empty())
+			return NULL;
+
+		uint32 const Mask = static_cast<uint32>(slots_.size() - 1);
+		for(uint32 i = this->hash(Cell);; i = (i + 1) & Mask)
+		{
+			slot const & Slot = slots_[i];
+			if(Slot.Count == 0)
+				return NULL;
+			if(Slot.Cell == Cell)
+				return &Slot;
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void tspatial_hash<T, P>::build()
+	{
+		size_t const Count = positions_.size();
+
+		// Keep the load factor at most 1/2 so that probe sequences stay short
+		uint32 Capacity = 16;
+		shift_ = 28;
+		while(Capacity < Count * 2)
+		{
+			Capacity <<= 1;
+			--shift_;
+		}
+
+		slot const Empty = {cell_type(0), 0, 0};
+		slots_.assign(Capacity, Empty);
+		cellCount_ = 0;
+
+		uint32 const Mask = Capacity - 1;
+		std::vector<uint32> PointSlots(Count);
+		for(size_t i = 0; i < Count; ++i)
+		{
+			cell_type const Cell(this->cell(positions_[i]));
+
+			uint32 SlotIndex = this->hash(Cell);
+			while(slots_[SlotIndex].Count != 0 && slots_[SlotIndex].Cell != Cell)
+				SlotIndex = (SlotIndex + 1) & Mask;
+
+			slot & Slot = slots_[SlotIndex];
+			if(Slot.Count == 0)
+			{
+				Slot.Cell = Cell;
+				++cellCount_;
+			}
+			++Slot.Count;
+			PointSlots[i] = SlotIndex;
+		}
+
+		// Counting sort: First starts past the end of each cell range and is decremented by the scatter
+		uint32 Sum = 0;
+		for(size_t i = 0; i < slots_.size(); ++i)
+		{
+			Sum += slots_[i].Count;
+			slots_[i].First = Sum;
+		}
+
+		sortedIndices_.resize(Count);
+		sortedPositions_.resize(Count);
+		for(size_t i = Count; i-- > 0;)
+		{
+			uint32 const Offset = --slots_[PointSlots[i]].First;
+			sortedIndices_[Offset] = static_cast<uint32>(i);
+			sortedPositions_[Offset] = positions_[i];
+		}
+	}
+}//namespace glm
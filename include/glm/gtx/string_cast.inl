@@ -7,7 +7,7 @@
 namespace glm{
 namespace detail
 {
-	GLM_FUNC_QUALIFIER std::string format(const char* msg, ...)
+	inline std::string format(const char* msg, ...)
 	{
 		std::size_t const STRING_BUFFER(4096);
 		char text[STRING_BUFFER];
@@ -0,0 +1,101 @@
+/// @ref gtx_vertex_weld
+/// @file glm/gtx/vertex_weld.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_vertex_weld GLM_GTX_vertex_weld
+/// @ingroup gtx
+///
+/// @brief Merge the vertices of a mesh whose positions and attributes are equal within an epsilon.
+///
+/// Vertices are processed in order: a vertex is welded to the first previously kept vertex
+/// whose position components differ by at most Epsilon and whose attribute components differ by at most AttributeEpsilon,
+/// otherwise it is kept. The result only depends on the input order.
+///
+/// Positions are quantized into cells of 8 times the epsilon, stored in an open addressing hash table,
+/// so that each vertex is only compared with the vertices of the at most 8 cells within its epsilon.
+/// When OpenMP is enabled, the quantization runs in parallel.
+///
+/// <glm/gtx/vertex_weld.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_ptr.hpp"
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_vertex_weld extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_vertex_weld
+	/// @{
+
+	/// Weld vertices with equal positions within Epsilon.
+	///
+	/// @param Positions Array of Count positions.
+	/// @param Count Number of vertices.
+	/// @param Epsilon Maximum difference between the components of welded positions. Use 0 for exact matches.
+	/// @param Remap Output array of Count indices, Remap[i] being the index of vertex i in the welded vertex buffer.
+	/// @return Number of welded vertices.
+	/// @see gtx_vertex_weld
+	template <typename T, precision P>
+	GLM_FUNC_DECL size_t weldVertices(tvec3<T, P> const * Positions, size_t Count, T Epsilon, uint32 * Remap);
+
+	/// Weld vertices stored in separate attribute streams.
+	///
+	/// @param Positions Array of Count positions.
+	/// @param Normals Array of Count normals, or NULL.
+	/// @param TexCoords Array of Count texture coordinates, or NULL.
+	/// @param Count Number of vertices.
+	/// @param Epsilon Maximum difference between the components of welded positions.
+	/// @param AttributeEpsilon Maximum difference between the components of welded normals and texture coordinates.
+	/// @param Remap Output array of Count indices, Remap[i] being the index of vertex i in the welded vertex buffer.
+	/// @return Number of welded vertices.
+	/// @see gtx_vertex_weld
+	template <typename T, precision P>
+	GLM_FUNC_DECL size_t weldVertices(tvec3<T, P> const * Positions, tvec3<T, P> const * Normals, tvec2<T, P> const * TexCoords, size_t Count, T Epsilon, T AttributeEpsilon, uint32 * Remap);
+
+	/// Weld interleaved vertices.
+	/// Each vertex starts with its 3 components position, followed by Components - 3 attribute components.
+	///
+	/// @param Vertices Pointer to the first component of the first vertex.
+	/// @param Count Number of vertices.
+	/// @param Stride Distance in bytes between two vertices.
+	/// @param Components Number of components compared per vertex, at least 3.
+	/// @param Epsilon Maximum difference between the components of welded positions.
+	/// @param AttributeEpsilon Maximum difference between the other components of welded vertices.
+	/// @param Remap Output array of Count indices, Remap[i] being the index of vertex i in the welded vertex buffer.
+	/// @return Number of welded vertices.
+	/// @see gtx_vertex_weld
+	template <typename T>
+	GLM_FUNC_DECL size_t weldVertices(T const * Vertices, size_t Count, size_t Stride, size_t Components, T Epsilon, T AttributeEpsilon, uint32 * Remap);
+
+	/// Weld vertices with equal positions within Epsilon, reading the positions through a strided view.
+	///
+	/// @param Positions View of the tvec3 positions, for example inside an interleaved vertex buffer.
+	/// @param Epsilon Maximum difference between the components of welded positions. Use 0 for exact matches.
+	/// @param Remap Output array of Positions.size() indices, Remap[i] being the index of vertex i in the welded vertex buffer.
+	/// @return Number of welded vertices.
+	/// @see gtx_vertex_weld
+	template <typename genType>
+	GLM_FUNC_DECL size_t weldVertices(tstrided_view<genType> const & Positions, typename genType::value_type Epsilon, uint32 * Remap);
+
+	/// Build the welded vertex buffer of an attribute stream, or of interleaved vertices, from the remap table returned by weldVertices.
+	/// Each welded vertex takes the value of the first vertex remapped to it.
+	///
+	/// @param Vertices Array of Count input vertices.
+	/// @param Count Number of input vertices.
+	/// @param Remap Remap table returned by weldVertices.
+	/// @param Welded Output array, large enough for the number of welded vertices returned by weldVertices.
+	/// @see gtx_vertex_weld
+	template <typename genType>
+	GLM_FUNC_DECL void compactVertices(genType const * Vertices, size_t Count, uint32 const * Remap, genType * Welded);
+
+	/// @}
+}// namespace glm
+
+#include "vertex_weld.inl"
@@ -0,0 +1,231 @@
+/// @ref gtx_vertex_weld
+/// @file glm/gtx/vertex_weld.inl
+
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Strided view of Count vertices with Components compared components each
+	template <typename T>
+	struct weld_stream
+	{
+		char const * Data;
+		size_t Stride;
+		size_t Components;
+		T Epsilon;
+
+		GLM_FUNC_QUALIFIER T const * vertex(size_t Index) const
+		{
+			return reinterpret_cast<T const *>(Data + Index * Stride);
+		}
+	};
+
+	struct weld_slot
+	{
+		tvec3<int, highp> Cell;
+		uint32 Head;	// First node of the cell, ~0 for empty slots
+	};
+
+	// Welded vertex of a cell list, with a copy of its position to avoid an indirection per comparison
+	template <typename T>
+	struct weld_node
+	{
+		tvec3<T, highp> Position;
+		uint32 Next;
+	};
+
+	GLM_FUNC_QUALIFIER uint32 weld_hash(tvec3<int, highp> const & Cell, uint32 Shift)
+	{
+		// Cells of a mesh are regularly spaced, a 64 bits multiply and fold mixes them better than the XOR of 32 bits products
+		uint64 Hash =
+			static_cast<uint64>(static_cast<uint32>(Cell.x)) * 0x9e3779b97f4a7c15ULL ^
+			static_cast<uint64>(static_cast<uint32>(Cell.y)) * 0xc2b2ae3d27d4eb4fULL ^
+			static_cast<uint64>(static_cast<uint32>(Cell.z)) * 0x165667b19e3779f9ULL;
+		Hash ^= Hash >> 32;
+		Hash *= 0xd6e8feb86659fd93ULL;
+		return static_cast<uint32>(Hash >> 32) >> Shift;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER int weld_quantize(T Value)
+	{
+		// Far away positions share clamped cells, which only costs extra comparisons
+		T const Limit = static_cast<T>(1 << 30);
+		return static_cast<int>(floor(clamp(Value, -Limit, Limit)));
+	}
+
+	// Compare the attribute streams, the positions of Streams[0] being compared by the caller
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool weld_equal(weld_stream<T> const * Streams, size_t StreamCount, size_t a, size_t b)
+	{
+		for(size_t s = 1; s < StreamCount; ++s)
+		{
+			T const * A = Streams[s].vertex(a);
+			T const * B = Streams[s].vertex(b);
+			for(size_t c = 0; c < Streams[s].Components; ++c)
+				if(abs(A[c] - B[c]) > Streams[s].Epsilon)
+					return false;
+		}
+		return true;
+	}
+
+	// Streams[0] holds the positions, its 3 components are quantized
+	template <typename T>
+	GLM_FUNC_QUALIFIER size_t weld_vertices(weld_stream<T> const * Streams, size_t StreamCount, size_t Count, uint32 * Remap)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'weldVertices' only accept floating-point vertices");
+
+		T const Epsilon = Streams[0].Epsilon;
+		T const InvCellSize = Epsilon > static_cast<T>(0) ? static_cast<T>(1) / (Epsilon * static_cast<T>(8)) : static_cast<T>(1);
+
+		// Cells are 8 times the epsilon wide so that [p - Epsilon, p + Epsilon] crosses a cell boundary for a quarter of the positions per axis.
+		// It covers at most 2 cells per axis:
+		// Low stores the cell of p - Epsilon, Bits the axes where p + Epsilon (bits 0 to 2) and p (bits 3 to 5) are in the next cell.
+		std::vector<tvec3<int, highp> > Low(Count);
+		std::vector<uint8> Bits(Count);
+
+		int const SignedCount = static_cast<int>(Count);
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for if(SignedCount >= (1 << 14))
+#		endif
+		for(int i = 0; i < SignedCount; ++i)
+		{
+			T const * Position = Streams[0].vertex(static_cast<size_t>(i));
+			uint8 Mask = 0;
+			for(int Axis = 0; Axis < 3; ++Axis)
+			{
+				int const Cell = weld_quantize((Position[Axis] - Epsilon) * InvCellSize);
+				Low[i][Axis] = Cell;
+				if(weld_quantize((Position[Axis] + Epsilon) * InvCellSize) != Cell)
+					Mask |= static_cast<uint8>(1 << Axis);
+				if(weld_quantize(Position[Axis] * InvCellSize) != Cell)
+					Mask |= static_cast<uint8>(8 << Axis);
+			}
+			Bits[i] = Mask;
+		}
+
+		// Keep the load factor at most 1/2 so that probe sequences stay short
+		uint32 Capacity = 16;
+		uint32 Shift = 28;
+		while(Capacity < Count * 2)
+		{
+			Capacity <<= 1;
+			--Shift;
+		}
+		uint32 const Mask = Capacity - 1;
+		uint32 const Empty = ~static_cast<uint32>(0);
+
+		weld_slot const EmptySlot = {tvec3<int, highp>(0), Empty};
+		std::vector<weld_slot> Slots(Capacity, EmptySlot);
+		std::vector<uint32> Kept;	// Input index of each welded vertex
+		std::vector<weld_node<T> > Nodes;
+
+		for(size_t i = 0; i < Count; ++i)
+		{
+			T const * Components = Streams[0].vertex(i);
+			tvec3<T, highp> const Position(Components[0], Components[1], Components[2]);
+
+			uint32 Match = Empty;
+			for(uint32 Corner = 0; Corner < 8; ++Corner)
+			{
+				if(Corner & ~static_cast<uint32>(Bits[i] & 7))
+					continue;
+
+				tvec3<int, highp> const Cell(Low[i] + tvec3<int, highp>(Corner & 1, (Corner >> 1) & 1, (Corner >> 2) & 1));
+				uint32 SlotIndex = weld_hash(Cell, Shift);
+				while(Slots[SlotIndex].Head != Empty && Slots[SlotIndex].Cell != Cell)
+					SlotIndex = (SlotIndex + 1) & Mask;
+
+				for(uint32 Welded = Slots[SlotIndex].Head; Welded != Empty; Welded = Nodes[Welded].Next)
+					if(Welded < Match &&
+						all(lessThanEqual(abs(Nodes[Welded].Position - Position), tvec3<T, highp>(Epsilon))) &&
+						weld_equal(Streams, StreamCount, Kept[Welded], i))
+						Match = Welded;
+			}
+
+			if(Match == Empty)
+			{
+				Match = static_cast<uint32>(Kept.size());
+				Kept.push_back(static_cast<uint32>(i));
+
+				tvec3<int, highp> const Cell(Low[i] + tvec3<int, highp>((Bits[i] >> 3) & 1, (Bits[i] >> 4) & 1, (Bits[i] >> 5) & 1));
+				uint32 SlotIndex = weld_hash(Cell, Shift);
+				while(Slots[SlotIndex].Head != Empty && Slots[SlotIndex].Cell != Cell)
+					SlotIndex = (SlotIndex + 1) & Mask;
+
+				weld_node<T> const Node = {Position, Slots[SlotIndex].Head};
+				Nodes.push_back(Node);
+				Slots[SlotIndex].Cell = Cell;
+				Slots[SlotIndex].Head = Match;
+			}
+
+			Remap[i] = Match;
+		}
+
+		return Kept.size();
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t weldVertices(tvec3<T, P> const * Positions, size_t Count, T Epsilon, uint32 * Remap)
+	{
+		detail::weld_stream<T> const Stream = {reinterpret_cast<char const *>(Positions), sizeof(tvec3<T, P>), 3, Epsilon};
+		return detail::weld_vertices(&Stream, 1, Count, Remap);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER size_t weldVertices(tvec3<T, P> const * Positions, tvec3<T, P> const * Normals, tvec2<T, P> const * TexCoords, size_t Count, T Epsilon, T AttributeEpsilon, uint32 * Remap)
+	{
+		detail::weld_stream<T> Streams[3];
+		size_t StreamCount = 0;
+
+		detail::weld_stream<T> const PositionStream = {reinterpret_cast<char const *>(Positions), sizeof(tvec3<T, P>), 3, Epsilon};
+		Streams[StreamCount++] = PositionStream;
+		if(Normals)
+		{
+			detail::weld_stream<T> const NormalStream = {reinterpret_cast<char const *>(Normals), sizeof(tvec3<T, P>), 3, AttributeEpsilon};
+			Streams[StreamCount++] = NormalStream;
+		}
+		if(TexCoords)
+		{
+			detail::weld_stream<T> const TexCoordStream = {reinterpret_cast<char const *>(TexCoords), sizeof(tvec2<T, P>), 2, AttributeEpsilon};
+			Streams[StreamCount++] = TexCoordStream;
+		}
+
+		return detail::weld_vertices(Streams, StreamCount, Count, Remap);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER size_t weldVertices(T const * Vertices, size_t Count, size_t Stride, size_t Components, T Epsilon, T AttributeEpsilon, uint32 * Remap)
+	{
+		assert(Components >= 3);
+
+		char const * Data = reinterpret_cast<char const *>(Vertices);
+		detail::weld_stream<T> const Streams[2] =
+		{
+			{Data, Stride, 3, Epsilon},
+			{Data + 3 * sizeof(T), Stride, Components - 3, AttributeEpsilon}
+		};
+		return detail::weld_vertices(Streams, 2, Count, Remap);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER size_t weldVertices(tstrided_view<genType> const & Positions, typename genType::value_type Epsilon, uint32 * Remap)
+	{
+		typedef typename genType::value_type T;
+
+		detail::weld_stream<T> const Stream = {reinterpret_cast<char const *>(Positions.data()), Positions.stride(), 3, Epsilon};
+		return detail::weld_vertices(&Stream, 1, Positions.size(), Remap);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void compactVertices(genType const * Vertices, size_t Count, uint32 const * Remap, genType * Welded)
+	{
+		// Welded vertices are numbered in the order of their first vertex
+		uint32 Next = 0;
+		for(size_t i = 0; i < Count; ++i)
+			if(Remap[i] == Next)
+				Welded[Next++] = Vertices[i];
+	}
+}//namespace glm
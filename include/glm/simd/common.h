@@ -63,7 +63,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
 
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
-#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	if GLM_HAS_FMA
 		return _mm_fmadd_ss(a, b, c);
 #	else
 		return _mm_add_ss(_mm_mul_ss(a, b), c);
@@ -72,13 +72,31 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
-#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#	if GLM_HAS_FMA
 		return _mm_fmadd_ps(a, b, c);
 #	else
 		return glm_vec4_add(glm_vec4_mul(a, b), c);
 #	endif
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fms(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fmsub_ps(a, b, c);
+#	else
+		return glm_vec4_sub(glm_vec4_mul(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fnma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+#	if GLM_HAS_FMA
+		return _mm_fnmadd_ps(a, b, c);
+#	else
+		return glm_vec4_sub(c, glm_vec4_mul(a, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
 {
 	return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
@@ -196,6 +214,16 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 	return mad0;
 }
 
+// Components of a where the mask components are all 1s, of b where they are all 0s
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
 {
 	glm_vec4 const cmp = _mm_cmple_ps(x, edge);
@@ -237,4 +265,48 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 	return _mm_castsi128_ps(_mm_cmpeq_epi32(t2, _mm_set1_epi32(0xFF000000)));		// exponent is all 1s, fraction is 0
 }
 
+// Components with a magnitude of at least 2^52 are integers and returned unchanged
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_round(glm_dvec2 x)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT);
+#	else
+		glm_dvec2 const sgn0 = _mm_set1_pd(-0.0);
+		glm_dvec2 const big0 = _mm_set1_pd(4503599627370496.0);
+		glm_dvec2 const and0 = _mm_and_pd(sgn0, x);
+		glm_dvec2 const or0 = _mm_or_pd(and0, big0);
+		glm_dvec2 const add0 = _mm_add_pd(x, or0);
+		glm_dvec2 const sub0 = _mm_or_pd(_mm_sub_pd(add0, or0), and0);
+		glm_dvec2 const cmp0 = _mm_cmplt_pd(_mm_andnot_pd(sgn0, x), big0);
+		return _mm_or_pd(_mm_and_pd(cmp0, sub0), _mm_andnot_pd(cmp0, x));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_floor(glm_dvec2 x)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_floor_pd(x);
+#	else
+		glm_dvec2 const rnd0 = glm_dvec2_round(x);
+		glm_dvec2 const cmp0 = _mm_cmplt_pd(x, rnd0);
+		glm_dvec2 const and0 = _mm_and_pd(cmp0, _mm_set1_pd(1.0));
+		glm_dvec2 const sub0 = _mm_sub_pd(rnd0, and0);
+		return sub0;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_ceil(glm_dvec2 x)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_ceil_pd(x);
+#	else
+		glm_dvec2 const rnd0 = glm_dvec2_round(x);
+		glm_dvec2 const cmp0 = _mm_cmpgt_pd(x, rnd0);
+		glm_dvec2 const and0 = _mm_and_pd(cmp0, _mm_set1_pd(1.0));
+		glm_dvec2 const add0 = _mm_add_pd(rnd0, and0);
+		// ceil of ]-1, 0[ is -0
+		return _mm_or_pd(add0, _mm_and_pd(_mm_set1_pd(-0.0), x));
+#	endif
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,97 @@
+/// @ref simd
+/// @file glm/simd/cpu.h
+
+#pragma once
+
+#include "platform.h"
+
+#if GLM_ARCH & GLM_ARCH_X86_BIT
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#	elif GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_LLVM)
+#		include <cpuid.h>
+#	endif
+#endif
+
+// Returns the GLM_ARCH bits supported by the running CPU and operating system.
+// Without a way to query the CPU, returns the instruction sets GLM is compiled for.
+GLM_FUNC_QUALIFIER int glm_cpu_arch_detect()
+{
+#	if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_GCC | GLM_COMPILER_LLVM))
+		unsigned int Leaf1[4] = {0, 0, 0, 0};
+		unsigned int Leaf7[4] = {0, 0, 0, 0};
+		unsigned int XCR0 = 0;
+
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			int Info[4];
+			__cpuid(Info, 0);
+			int const MaxLeaf = Info[0];
+			__cpuid(Info, 1);
+			for(int i = 0; i < 4; ++i)
+				Leaf1[i] = static_cast<unsigned int>(Info[i]);
+			if(MaxLeaf >= 7)
+			{
+				__cpuidex(Info, 7, 0);
+				for(int i = 0; i < 4; ++i)
+					Leaf7[i] = static_cast<unsigned int>(Info[i]);
+			}
+			if(Leaf1[2] & (1u << 27))
+				XCR0 = static_cast<unsigned int>(_xgetbv(0));
+#		else
+			unsigned int const MaxLeaf = __get_cpuid_max(0, 0);
+			if(MaxLeaf >= 1)
+				__cpuid(1, Leaf1[0], Leaf1[1], Leaf1[2], Leaf1[3]);
+			if(MaxLeaf >= 7)
+				__cpuid_count(7, 0, Leaf7[0], Leaf7[1], Leaf7[2], Leaf7[3]);
+			if(Leaf1[2] & (1u << 27))
+			{
+				unsigned int EDX = 0;
+				__asm__ __volatile__("xgetbv" : "=a"(XCR0), "=d"(EDX) : "c"(0));
+			}
+#		endif
+
+		int Arch = GLM_ARCH_X86_BIT;
+		if(!(Leaf1[3] & (1u << 26)))
+			return Arch;
+		Arch |= GLM_ARCH_SSE2_BIT;
+		if(!(Leaf1[2] & (1u << 0)))
+			return Arch;
+		Arch |= GLM_ARCH_SSE3_BIT;
+		if(!(Leaf1[2] & (1u << 9)))
+			return Arch;
+		Arch |= GLM_ARCH_SSSE3_BIT;
+		if(!(Leaf1[2] & (1u << 19)))
+			return Arch;
+		Arch |= GLM_ARCH_SSE41_BIT;
+		if(!(Leaf1[2] & (1u << 20)))
+			return Arch;
+		Arch |= GLM_ARCH_SSE42_BIT;
+
+		// AVX also requires the operating system to save the YMM registers
+		if(!(Leaf1[2] & (1u << 28)) || (XCR0 & 0x6) != 0x6)
+			return Arch;
+		Arch |= GLM_ARCH_AVX_BIT;
+
+		// GLM AVX2 code paths also use FMA
+		if(!(Leaf7[1] & (1u << 5)) || !(Leaf1[2] & (1u << 12)))
+			return Arch;
+		Arch |= GLM_ARCH_AVX2_BIT;
+
+		// Skylake subset: F (bit 16), DQ (17), CD (28), BW (30) and VL (31), with the OS saving the opmask and ZMM registers
+		unsigned int const Avx512 = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+		if((Leaf7[1] & Avx512) != Avx512 || (XCR0 & 0xE6) != 0xE6)
+			return Arch;
+		Arch |= GLM_ARCH_AVX512_BIT;
+
+		return Arch;
+#	else
+		return GLM_ARCH;
+#	endif
+}
+
+// Cached result of glm_cpu_arch_detect, used by the array kernels compiled with GLM_FORCE_RUNTIME_DISPATCH.
+GLM_FUNC_QUALIFIER int glm_cpu_arch()
+{
+	static int const Arch = glm_cpu_arch_detect();
+	return Arch;
+}
@@ -1,20 +1,307 @@
 /// @ref simd
-/// @file glm/simd/experimental.h
+/// @file glm/simd/exponential.h
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// sqrt(x) from rsqrtss, 12 bits of precision. Falls back to sqrtss when x is not a positive normalized value.
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_sqrt_lowp(glm_vec4 x)
 {
+	if(!(_mm_comige_ss(x, _mm_set_ss(1.17549435e-38f)) && _mm_comilt_ss(x, _mm_castsi128_ps(_mm_cvtsi32_si128(0x7F800000)))))
+		return _mm_sqrt_ss(x);
 	return _mm_mul_ss(_mm_rsqrt_ss(x), x);
 }
 
+// sqrt(x) from rsqrtps, 12 bits of precision. Falls back to sqrtps when a component is not a positive normalized value.
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
 {
+	glm_vec4 const in0 = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(1.17549435e-38f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	if(_mm_movemask_ps(in0) != 0xF)
+		return _mm_sqrt_ps(x);
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// 1 / sqrt(x), at most 1 ULP error
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt(glm_vec4 x)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));
+}
+
+// 1 / sqrt(x), 12 bits of precision
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_lowp(glm_vec4 x)
+{
+	return _mm_rsqrt_ps(x);
+}
+
+// 1 / sqrt(x), rsqrtps refined by a Newton-Raphson step to about 22 bits of precision.
+// Denormalized inputs are flushed to zero.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_inversesqrt(glm_vec4 x)
+{
+	glm_vec4 const rsq0 = _mm_rsqrt_ps(x);
+	glm_vec4 const mul0 = glm_vec4_mul(glm_vec4_mul(x, _mm_set1_ps(0.5f)), glm_vec4_mul(rsq0, rsq0));
+	glm_vec4 const mul1 = glm_vec4_mul(rsq0, glm_vec4_sub(_mm_set1_ps(1.5f), mul0));
+
+	// The Newton-Raphson step turns 0 and infinity into NaN
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+	glm_vec4 const zro0 = _mm_cmplt_ps(abs0, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const inf0 = _mm_cmpeq_ps(abs0, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)));
+	return glm_vec4_select(_mm_or_ps(zro0, inf0), rsq0, mul1);
+}
+
+// x * fast_inversesqrt(x). Denormalized inputs are flushed to zero.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_sqrt(glm_vec4 x)
+{
+	glm_vec4 const mul0 = glm_vec4_mul(x, glm_vec4_fast_inversesqrt(x));
+	glm_vec4 const zro0 = _mm_cmplt_ps(glm_vec4_abs(x), _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const inf0 = _mm_cmpeq_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)));
+	glm_vec4 const res0 = glm_vec4_select(zro0, _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x80000000))), mul0);
+	return glm_vec4_select(inf0, x, res0);
+}
+
+// Series of GTX_fast_exponential fastExp, accurate for x in [-1, 1]
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_exp(glm_vec4 x)
+{
+	glm_vec4 const mad0 = glm_vec4_fma(x, _mm_set1_ps(0.008333333333f), _mm_set1_ps(0.041666667f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, x, _mm_set1_ps(0.1666666667f));
+	glm_vec4 const mad2 = glm_vec4_fma(mad1, x, _mm_set1_ps(0.5f));
+	glm_vec4 const mad3 = glm_vec4_fma(mad2, x, _mm_set1_ps(1.0f));
+	return glm_vec4_fma(mad3, x, _mm_set1_ps(1.0f));
+}
+
+// x * 2^n for n in [-150, 129], split in two factors so that the result may be denormalized or overflow to infinity
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ldexp(glm_vec4 x, glm_ivec4 n)
+{
+	glm_ivec4 const n0 = _mm_srai_epi32(n, 1);
+	glm_ivec4 const n1 = _mm_sub_epi32(n, n0);
+	glm_vec4 const pow0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n0, _mm_set1_epi32(127)), 23));
+	glm_vec4 const pow1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+	return glm_vec4_mul(glm_vec4_mul(x, pow0), pow1);
+}
+
+// Cephes exp2f polynomial: 2^x for x in [-0.5, 0.5], evaluated with Estrin's scheme to shorten the dependency chain
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_poly(glm_vec4 x)
+{
+	glm_vec4 const x2 = glm_vec4_mul(x, x);
+	glm_vec4 const p0 = glm_vec4_fma(_mm_set1_ps(6.931472028550421e-1f), x, _mm_set1_ps(1.0f));
+	glm_vec4 const p1 = glm_vec4_fma(_mm_set1_ps(5.550332471162809e-2f), x, _mm_set1_ps(2.402264791363012e-1f));
+	glm_vec4 const p2 = glm_vec4_fma(_mm_set1_ps(1.339887440266574e-3f), x, _mm_set1_ps(9.618437357674640e-3f));
+	glm_vec4 const p3 = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), x2, p2);
+	return glm_vec4_fma(glm_vec4_fma(p3, x2, p1), x2, p0);
+}
+
+// 2^x, at most 2 ULP error. Exact for integers, denormalized results are supported.
+// exp2(+inf) = +inf, exp2(-inf) = 0, exp2(NaN) = NaN.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	// Clamping with x as the second operand of min preserves NaNs
+	glm_vec4 const clp0 = _mm_max_ps(_mm_set1_ps(-152.0f), _mm_min_ps(_mm_set1_ps(129.0f), x));
+	glm_ivec4 const rnd0 = _mm_cvtps_epi32(clp0);
+	glm_vec4 const frc0 = glm_vec4_sub(clp0, _mm_cvtepi32_ps(rnd0));
+	return glm_vec4_ldexp(glm_vec4_exp2_poly(frc0), rnd0);
+}
+
+// Cephes expf: e^x, at most 2 ULP error. Denormalized results are supported.
+// exp(+inf) = +inf, exp(-inf) = 0, exp(NaN) = NaN.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const clp0 = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(89.0f), x));
+	glm_ivec4 const rnd0 = _mm_cvtps_epi32(glm_vec4_mul(clp0, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const rnd1 = _mm_cvtepi32_ps(rnd0);
+
+	// x - n * ln(2), with ln(2) split in a part exactly multiplied by n and a correction
+	glm_vec4 r = glm_vec4_fma(rnd1, _mm_set1_ps(-0.693359375f), clp0);
+	r = glm_vec4_fma(rnd1, _mm_set1_ps(2.12194440e-4f), r);
+
+	glm_vec4 const r2 = glm_vec4_mul(r, r);
+	glm_vec4 const p0 = glm_vec4_fma(_mm_set1_ps(1.6666665459e-1f), r, _mm_set1_ps(5.0000001201e-1f));
+	glm_vec4 const p1 = glm_vec4_fma(_mm_set1_ps(8.3334519073e-3f), r, _mm_set1_ps(4.1665795894e-2f));
+	glm_vec4 const p2 = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	glm_vec4 const p = glm_vec4_fma(glm_vec4_fma(p2, r2, p1), r2, p0);
+	glm_vec4 const y = glm_vec4_add(glm_vec4_fma(p, r2, r), _mm_set1_ps(1.0f));
+
+	return glm_vec4_ldexp(y, rnd0);
+}
+
+// Cephes logf range reduction: x = 2^Exponent * (1 + Mantissa) with 1 + Mantissa in [sqrt(0.5), sqrt(2)),
+// log(1 + Mantissa) ~ Mantissa + Poly, the polynomial being evaluated with Estrin's scheme. Mantissa is exact. Expects finite positive x, denormalized values are supported.
+GLM_FUNC_QUALIFIER void glm_vec4_log_reduce(glm_vec4 x, glm_vec4 * Exponent, glm_vec4 * Mantissa, glm_vec4 * Poly)
+{
+	glm_vec4 const den0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const nrm0 = glm_vec4_select(den0, glm_vec4_mul(x, _mm_set1_ps(8388608.0f)), x);
+
+	// Mantissa in [0.5, 1)
+	glm_ivec4 const bit0 = _mm_castps_si128(nrm0);
+	glm_ivec4 const exp0 = _mm_sub_epi32(_mm_srli_epi32(bit0, 23), _mm_set1_epi32(126));
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+	glm_vec4 const exp1 = glm_vec4_sub(_mm_cvtepi32_ps(exp0), _mm_and_ps(den0, _mm_set1_ps(23.0f)));
+
+	// Mantissa in [sqrt(0.5), sqrt(2))
+	glm_vec4 const sml0 = _mm_cmplt_ps(man0, _mm_set1_ps(0.707106781186547524f));
+	glm_vec4 const e = glm_vec4_sub(exp1, _mm_and_ps(sml0, _mm_set1_ps(1.0f)));
+	glm_vec4 const m = glm_vec4_sub(glm_vec4_add(man0, _mm_and_ps(sml0, man0)), _mm_set1_ps(1.0f));
+
+	glm_vec4 const z = glm_vec4_mul(m, m);
+	glm_vec4 const z2 = glm_vec4_mul(z, z);
+	glm_vec4 const p0 = glm_vec4_fma(_mm_set1_ps(-2.4999993993e-1f), m, _mm_set1_ps(3.3333331174e-1f));
+	glm_vec4 const p1 = glm_vec4_fma(_mm_set1_ps(-1.6668057665e-1f), m, _mm_set1_ps(2.0000714765e-1f));
+	glm_vec4 const p2 = glm_vec4_fma(_mm_set1_ps(-1.2420140846e-1f), m, _mm_set1_ps(1.4249322787e-1f));
+	glm_vec4 const p3 = glm_vec4_fma(_mm_set1_ps(-1.1514610310e-1f), m, _mm_set1_ps(1.1676998740e-1f));
+	glm_vec4 const p4 = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), z, p3);
+	glm_vec4 const p5 = glm_vec4_fma(p1, z, p0);
+	glm_vec4 const p = glm_vec4_fma(glm_vec4_fma(p4, z, p2), z2, p5);
+
+	*Exponent = e;
+	*Mantissa = m;
+	*Poly = glm_vec4_fma(z, _mm_set1_ps(-0.5f), glm_vec4_mul(glm_vec4_mul(p, m), z));
+}
+
+// log(+inf) = +inf, log(+-0) = -inf, log(x < 0) = log(NaN) = NaN
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_special(glm_vec4 x, glm_vec4 Result)
+{
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	glm_vec4 const zro0 = _mm_cmpeq_ps(x, _mm_setzero_ps());
+	glm_vec4 const inf1 = _mm_cmpeq_ps(x, inf0);
+	glm_vec4 const res0 = glm_vec4_select(zro0, _mm_sub_ps(_mm_setzero_ps(), inf0), glm_vec4_select(inf1, inf0, Result));
+	return _mm_or_ps(res0, _mm_cmpnge_ps(x, _mm_setzero_ps()));
+}
+
+// Cephes logf: natural logarithm, at most 2 ULP error
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 e, m, p;
+	glm_vec4_log_reduce(x, &e, &m, &p);
+
+	glm_vec4 const y = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), p);
+	glm_vec4 const r = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), glm_vec4_add(m, y));
+	return glm_vec4_log_special(x, r);
+}
+
+// Cephes log2f: base 2 logarithm, at most 2 ULP error. Exact for powers of two.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	glm_vec4 e, m, p;
+	glm_vec4_log_reduce(x, &e, &m, &p);
+
+	// log2(e) - 1 factor, so that the Mantissa + Poly term is added exactly
+	glm_vec4 const log2ea = _mm_set1_ps(0.44269504088896340736f);
+	glm_vec4 r = glm_vec4_mul(p, log2ea);
+	r = glm_vec4_fma(m, log2ea, r);
+	r = glm_vec4_add(r, p);
+	r = glm_vec4_add(r, m);
+	r = glm_vec4_add(r, e);
+	return glm_vec4_log_special(x, r);
+}
+
+// y * log2(x) evaluated in double precision, for two lanes
+GLM_FUNC_QUALIFIER __m128d glm_dvec2_pow_exponent(glm_vec4 e, glm_vec4 m, glm_vec4 p, glm_vec4 y)
+{
+	__m128d const sum0 = _mm_add_pd(_mm_cvtps_pd(m), _mm_cvtps_pd(p));
+	__m128d const log0 = _mm_add_pd(_mm_mul_pd(sum0, _mm_set1_pd(1.4426950408889634074)), _mm_cvtps_pd(e));
+	return _mm_mul_pd(_mm_cvtps_pd(y), log0);
+}
+
+// x^y computed as 2^(y * log2(x)) with the product in double precision.
+// At most 2 ULP error for results in the normalized range with |y * log2(x)| < 16, and 4 ULP with |y * log2(x)| < 128.
+// Special values follow the C99 pow function: pow(x, 0) = pow(1, y) = 1 even for NaN, pow(-1, +-inf) = 1,
+// negative x requires an integer y, pow(+-0, y) and pow(+-inf, y) are 0 or infinity, signed for odd integer y.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const abs0 = glm_vec4_abs(x);
+	glm_vec4 const absy = glm_vec4_abs(y);
+	glm_vec4 const one0 = _mm_set1_ps(1.0f);
+	glm_vec4 const zro0 = _mm_setzero_ps();
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+
+	glm_vec4 e, m, p;
+	glm_vec4_log_reduce(abs0, &e, &m, &p);
+
+	__m128d const exp0 = glm_dvec2_pow_exponent(e, m, p, y);
+	__m128d const exp1 = glm_dvec2_pow_exponent(_mm_movehl_ps(e, e), _mm_movehl_ps(m, m), _mm_movehl_ps(p, p), _mm_movehl_ps(y, y));
+
+	// Clamped as in glm_vec4_exp2, then split in integer and fractional parts in double precision
+	__m128d const clp0 = _mm_max_pd(_mm_set1_pd(-152.0), _mm_min_pd(_mm_set1_pd(129.0), exp0));
+	__m128d const clp1 = _mm_max_pd(_mm_set1_pd(-152.0), _mm_min_pd(_mm_set1_pd(129.0), exp1));
+	glm_ivec4 const rnd0 = _mm_cvtpd_epi32(clp0);
+	glm_ivec4 const rnd1 = _mm_cvtpd_epi32(clp1);
+	glm_vec4 const frc0 = _mm_cvtpd_ps(_mm_sub_pd(clp0, _mm_cvtepi32_pd(rnd0)));
+	glm_vec4 const frc1 = _mm_cvtpd_ps(_mm_sub_pd(clp1, _mm_cvtepi32_pd(rnd1)));
+	glm_vec4 const res0 = glm_vec4_ldexp(glm_vec4_exp2_poly(_mm_movelh_ps(frc0, frc1)), _mm_unpacklo_epi64(rnd0, rnd1));
+
+	// Positive finite x and finite y, including x = 1 and y = 0, need no special handling
+	glm_vec4 const fin0 = _mm_and_ps(_mm_cmpgt_ps(x, zro0), _mm_cmplt_ps(x, inf0));
+	if(_mm_movemask_ps(_mm_and_ps(fin0, _mm_cmplt_ps(absy, inf0))) == 0xF)
+		return res0;
+
+	// pow(+-0, y) and pow(+-inf, y)
+	glm_vec4 const neg0 = _mm_cmplt_ps(y, zro0);
+	glm_vec4 const res1 = glm_vec4_select(_mm_cmpeq_ps(abs0, zro0), _mm_and_ps(neg0, inf0), res0);
+	glm_vec4 const res2 = glm_vec4_select(_mm_cmpeq_ps(abs0, inf0), _mm_andnot_ps(neg0, inf0), res1);
+
+	// Integer and odd y, |y| >= 2^24 being even
+	glm_ivec4 const int0 = _mm_cvttps_epi32(y);
+	glm_vec4 const big0 = _mm_cmpge_ps(absy, _mm_set1_ps(16777216.0f));
+	glm_vec4 const int1 = _mm_or_ps(big0, _mm_cmpeq_ps(_mm_cvtepi32_ps(int0), y));
+	glm_vec4 const odd0 = _mm_andnot_ps(big0, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(int0, _mm_set1_epi32(1)), _mm_set1_epi32(1))));
+
+	// Negative x: NaN for non integer y, sign of x for odd y
+	glm_vec4 const nan0 = _mm_andnot_ps(int1, _mm_cmplt_ps(x, zro0));
+	glm_vec4 const sgn0 = _mm_and_ps(odd0, _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x80000000))));
+	glm_vec4 const res3 = _mm_or_ps(_mm_xor_ps(res2, sgn0), _mm_or_ps(nan0, _mm_cmpunord_ps(x, y)));
+
+	// pow(x, +-0) = pow(1, y) = pow(-1, +-inf) = 1
+	glm_vec4 const one1 = _mm_or_ps(_mm_cmpeq_ps(y, zro0), _mm_cmpeq_ps(x, one0));
+	glm_vec4 const one2 = _mm_and_ps(_mm_cmpeq_ps(abs0, one0), _mm_cmpeq_ps(absy, inf0));
+	return glm_vec4_select(_mm_or_ps(one1, one2), one0, res3);
+}
+
+// 2^x with the lowp polynomial of detail::compute_exp2_tier, relative error below 2e-3.
+// Falls back to glm_vec4_exp2 when a component is outside [-126, 127].
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_lowp(glm_vec4 x)
+{
+	glm_vec4 const in0 = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(-126.0f)), _mm_cmple_ps(x, _mm_set1_ps(127.0f)));
+	if(_mm_movemask_ps(in0) != 0xF)
+		return glm_vec4_exp2(x);
+
+	glm_ivec4 const rnd0 = _mm_cvtps_epi32(x);
+	glm_vec4 const frc0 = glm_vec4_sub(x, _mm_cvtepi32_ps(rnd0));
+	glm_vec4 const pow0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(rnd0, _mm_set1_epi32(127)), 23));
+	glm_vec4 const mad0 = glm_vec4_fma(frc0, _mm_set1_ps(0.237830418f), _mm_set1_ps(0.703396523f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, frc0, _mm_set1_ps(1.00051370f));
+	return glm_vec4_mul(mad1, pow0);
+}
+
+// log2(x) with the lowp polynomial of detail::compute_log2_tier, absolute error below 1e-3.
+// Falls back to glm_vec4_log2 when a component is not a positive normalized value.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_lowp(glm_vec4 x)
+{
+	glm_vec4 const in0 = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(1.17549435e-38f)), _mm_cmplt_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	if(_mm_movemask_ps(in0) != 0xF)
+		return glm_vec4_log2(x);
+
+	// x = 2^e * m with m in [sqrt(0.5), sqrt(2))
+	glm_ivec4 const bit0 = _mm_castps_si128(x);
+	glm_ivec4 const exp0 = _mm_srai_epi32(_mm_sub_epi32(bit0, _mm_set1_epi32(0x3F3504F3)), 23);
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_sub_epi32(bit0, _mm_slli_epi32(exp0, 23)));
+	glm_vec4 const t = glm_vec4_sub(man0, _mm_set1_ps(1.0f));
+
+	glm_vec4 const mad0 = glm_vec4_fma(t, _mm_set1_ps(0.445070064f), _mm_set1_ps(-0.754081355f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, t, _mm_set1_ps(1.44515208f));
+	return glm_vec4_fma(mad1, t, _mm_cvtepi32_ps(exp0));
+}
+
+// 2^(y * log2(x)) with the lowp kernels. Falls back to glm_vec4_pow when a component of x is not positive and finite,
+// or a component of y is zero or not finite, as y * log2(x) is NaN for pow(1, inf) and pow(inf, 0).
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow_lowp(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	glm_vec4 const in0 = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, inf0));
+	glm_vec4 const in1 = _mm_and_ps(_mm_cmpneq_ps(y, _mm_setzero_ps()), _mm_cmplt_ps(glm_vec4_abs(y), inf0));
+	if(_mm_movemask_ps(_mm_and_ps(in0, in1)) != 0xF)
+		return glm_vec4_pow(x, y);
+	return glm_vec4_exp2_lowp(glm_vec4_mul(y, glm_vec4_log2_lowp(x)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
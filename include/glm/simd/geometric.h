@@ -62,6 +62,22 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
 #	endif
 }
 
+// Dot product of the x, y and z lanes, broadcast to all lanes. The w lanes are ignored.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dot3(glm_vec4 v1, glm_vec4 v2)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		return _mm_dp_ps(v1, v2, 0x7f);
+#	else
+		glm_vec4 const mul0 = _mm_mul_ps(v1, v2);
+		glm_vec4 const and0 = _mm_and_ps(mul0, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+		glm_vec4 const swp0 = _mm_shuffle_ps(and0, and0, _MM_SHUFFLE(2, 3, 0, 1));
+		glm_vec4 const add0 = _mm_add_ps(and0, swp0);
+		glm_vec4 const swp1 = _mm_shuffle_ps(add0, add0, _MM_SHUFFLE(0, 1, 2, 3));
+		glm_vec4 const add1 = _mm_add_ps(add0, swp1);
+		return add1;
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 {
 	glm_vec4 const swp0 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
@@ -77,6 +93,32 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
+	glm_vec4 const div0 = _mm_div_ps(v, sqt0);
+	return div0;
+}
+
+// rsqrtps estimate, about 12 bits of precision
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize_lowp(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
+	glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
+	return mul0;
+}
+
+// Normalize the x, y and z lanes
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize3(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot3(v, v);
+	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
+	glm_vec4 const div0 = _mm_div_ps(v, sqt0);
+	return div0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize3_lowp(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot3(v, v);
 	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
 	glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
 	return mul0;
@@ -121,4 +163,30 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_dot(glm_dvec2 v1, glm_dvec2 v2)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		return _mm_dp_pd(v1, v2, 0x33);
+#	else
+		glm_dvec2 const mul0 = _mm_mul_pd(v1, v2);
+		glm_dvec2 const swp0 = _mm_shuffle_pd(mul0, mul0, _MM_SHUFFLE2(0, 1));
+		glm_dvec2 const add0 = _mm_add_pd(mul0, swp0);
+		return add0;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_length(glm_dvec2 x)
+{
+	glm_dvec2 const dot0 = glm_dvec2_dot(x, x);
+	glm_dvec2 const sqt0 = _mm_sqrt_pd(dot0);
+	return sqt0;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dvec2_normalize(glm_dvec2 v)
+{
+	glm_dvec2 const dot0 = glm_dvec2_dot(v, v);
+	glm_dvec2 const div0 = _mm_div_pd(v, _mm_sqrt_pd(dot0));
+	return div0;
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -112,4 +112,288 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Spreads the 10 lowest bits of each 32 bits lane so that bit i moves to bit 3 * i.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u32vec4_spread3(glm_uvec4 x)
+{
+	glm_uvec4 Reg1 = _mm_and_si128(x, _mm_set1_epi32(0x000003FF));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg1, 16), Reg1), _mm_set1_epi32(0x030000FF));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg1,  8), Reg1), _mm_set1_epi32(0x0300F00F));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg1,  4), Reg1), _mm_set1_epi32(0x030C30C3));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(Reg1,  2), Reg1), _mm_set1_epi32(0x09249249));
+	return Reg1;
+}
+
+// Interleaves the 10 lowest bits of x, y and z in each 32 bits lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u32vec4_interleave3(glm_uvec4 x, glm_uvec4 y, glm_uvec4 z)
+{
+	glm_uvec4 const Reg1 = glm_u32vec4_spread3(x);
+	glm_uvec4 const Reg2 = _mm_slli_epi32(glm_u32vec4_spread3(y), 1);
+	glm_uvec4 const Reg3 = _mm_slli_epi32(glm_u32vec4_spread3(z), 2);
+	return _mm_or_si128(_mm_or_si128(Reg1, Reg2), Reg3);
+}
+
+// Spreads each 64 bits lane so that bit i moves to bit 3 * i, using the same steps as the scalar bitfieldInterleave.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u64vec2_spread3(glm_uvec4 x)
+{
+	glm_uvec4 Reg1 = x;
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg1, 32), Reg1), _mm_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg1, 16), Reg1), _mm_set1_epi64x(static_cast<long long>(0x00FF0000FF0000FFull)));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg1,  8), Reg1), _mm_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg1,  4), Reg1), _mm_set1_epi64x(static_cast<long long>(0x30C30C30C30C30C3ull)));
+	Reg1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(Reg1,  2), Reg1), _mm_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+	return Reg1;
+}
+
+// Interleaves x, y and z in each 64 bits lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u64vec2_interleave3(glm_uvec4 x, glm_uvec4 y, glm_uvec4 z)
+{
+	glm_uvec4 const Reg1 = glm_u64vec2_spread3(x);
+	glm_uvec4 const Reg2 = _mm_slli_epi64(glm_u64vec2_spread3(y), 1);
+	glm_uvec4 const Reg3 = _mm_slli_epi64(glm_u64vec2_spread3(z), 2);
+	return _mm_or_si128(_mm_or_si128(Reg1, Reg2), Reg3);
+}
+
+// Low 32 bits of the products, identical for signed and unsigned components
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_mul(glm_ivec4 a, glm_ivec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_mullo_epi32(a, b);
+#	else
+		glm_ivec4 const mul0 = _mm_mul_epu32(a, b);
+		glm_ivec4 const mul1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		glm_ivec4 const shf0 = _mm_shuffle_epi32(mul0, _MM_SHUFFLE(0, 0, 2, 0));
+		glm_ivec4 const shf1 = _mm_shuffle_epi32(mul1, _MM_SHUFFLE(0, 0, 2, 0));
+		return _mm_unpacklo_epi32(shf0, shf1);
+#	endif
+}
+
+// High 32 bits of the unsigned 64 bits products
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_mulhi(glm_uvec4 a, glm_uvec4 b)
+{
+	glm_uvec4 const mul0 = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+	glm_uvec4 const mul1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	glm_uvec4 const msk0 = _mm_set_epi32(-1, 0, -1, 0);
+	return _mm_or_si128(mul0, _mm_and_si128(mul1, msk0));
+}
+
+// High 32 bits of the signed 64 bits products
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_mulhi(glm_ivec4 a, glm_ivec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_ivec4 const mul0 = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+		glm_ivec4 const mul1 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		glm_ivec4 const msk0 = _mm_set_epi32(-1, 0, -1, 0);
+		return _mm_or_si128(mul0, _mm_and_si128(mul1, msk0));
+#	else
+		// mulhi_s(a, b) = mulhi_u(a, b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+		glm_ivec4 const and0 = _mm_and_si128(_mm_srai_epi32(a, 31), b);
+		glm_ivec4 const and1 = _mm_and_si128(_mm_srai_epi32(b, 31), a);
+		return _mm_sub_epi32(glm_uvec4_mulhi(a, b), _mm_add_epi32(and0, and1));
+#	endif
+}
+
+// Quotients truncated toward zero. Signed 32 bits integers are exactly represented by doubles and the rounding error of
+// the double quotient is smaller than the distance of a fractional quotient to the next integer, so the truncation is exact.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_div(glm_ivec4 a, glm_ivec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		return _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b)));
+#	else
+		glm_dvec2 const div0 = _mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+		glm_dvec2 const div1 = _mm_div_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(a, a)), _mm_cvtepi32_pd(_mm_unpackhi_epi64(b, b)));
+		return _mm_unpacklo_epi64(_mm_cvttpd_epi32(div0), _mm_cvttpd_epi32(div1));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec2 glm_uvec2_to_dvec2(glm_uvec4 x)
+{
+	glm_ivec4 const sgn0 = _mm_set1_epi32(static_cast<int>(0x80000000));
+	return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(x, sgn0)), _mm_set1_pd(2147483648.0));
+}
+
+// Truncation of positive doubles below 2^32, the upper half is offset by 2^31 which is exact in that binade
+GLM_FUNC_QUALIFIER glm_uvec4 glm_dvec2_to_uvec2(glm_dvec2 x)
+{
+	glm_dvec2 const big0 = _mm_set1_pd(2147483648.0);
+	glm_dvec2 const cmp0 = _mm_cmpge_pd(x, big0);
+	glm_uvec4 const cvt0 = _mm_cvttpd_epi32(_mm_sub_pd(x, _mm_and_pd(cmp0, big0)));
+	glm_uvec4 const sgn0 = _mm_shuffle_epi32(_mm_castpd_si128(cmp0), _MM_SHUFFLE(3, 3, 2, 0));
+	return _mm_xor_si128(cvt0, _mm_and_si128(sgn0, _mm_set_epi32(0, 0, static_cast<int>(0x80000000), static_cast<int>(0x80000000))));
+}
+
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_div(glm_uvec4 a, glm_uvec4 b)
+{
+	glm_dvec2 const div0 = _mm_div_pd(glm_uvec2_to_dvec2(a), glm_uvec2_to_dvec2(b));
+	glm_dvec2 const div1 = _mm_div_pd(glm_uvec2_to_dvec2(_mm_unpackhi_epi64(a, a)), glm_uvec2_to_dvec2(_mm_unpackhi_epi64(b, b)));
+	return _mm_unpacklo_epi64(glm_dvec2_to_uvec2(div0), glm_dvec2_to_uvec2(div1));
+}
+
+// Remainders with the sign of the dividend, as the % operator
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_mod(glm_ivec4 a, glm_ivec4 b)
+{
+	return _mm_sub_epi32(a, glm_ivec4_mul(glm_ivec4_div(a, b), b));
+}
+
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_mod(glm_uvec4 a, glm_uvec4 b)
+{
+	return _mm_sub_epi32(a, glm_ivec4_mul(glm_uvec4_div(a, b), b));
+}
+
+// Number of set bits of each 32 bits lane
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_bit_count(glm_uvec4 x)
+{
+#	if GLM_HAS_AVX512_POPCNT
+		return _mm_popcnt_epi32(x);
+#	elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+		// Counts of the low and high nibbles of each byte looked up with pshufb, then summed per lane
+		glm_uvec4 const lut0 = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		glm_uvec4 const msk0 = _mm_set1_epi8(0x0F);
+		glm_uvec4 const low0 = _mm_shuffle_epi8(lut0, _mm_and_si128(x, msk0));
+		glm_uvec4 const hig0 = _mm_shuffle_epi8(lut0, _mm_and_si128(_mm_srli_epi16(x, 4), msk0));
+		glm_uvec4 const add0 = _mm_maddubs_epi16(_mm_add_epi8(low0, hig0), _mm_set1_epi8(1));
+		return _mm_madd_epi16(add0, _mm_set1_epi16(1));
+#	else
+		glm_uvec4 const msk0 = _mm_set1_epi32(0x33333333);
+		glm_uvec4 const sub0 = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), _mm_set1_epi32(0x55555555)));
+		glm_uvec4 const add0 = _mm_add_epi32(_mm_and_si128(sub0, msk0), _mm_and_si128(_mm_srli_epi32(sub0, 2), msk0));
+		glm_uvec4 const add1 = _mm_and_si128(_mm_add_epi32(add0, _mm_srli_epi32(add0, 4)), _mm_set1_epi32(0x0F0F0F0F));
+		glm_uvec4 const add2 = _mm_add_epi32(add1, _mm_srli_epi32(add1, 8));
+		glm_uvec4 const add3 = _mm_add_epi32(add2, _mm_srli_epi32(add2, 16));
+		return _mm_and_si128(add3, _mm_set1_epi32(0x3F));
+#	endif
+}
+
+// Index of the least significant set bit of each lane, -1 for 0
+GLM_FUNC_QUALIFIER glm_ivec4 glm_uvec4_find_lsb(glm_uvec4 x)
+{
+	glm_uvec4 const low0 = _mm_and_si128(x, _mm_sub_epi32(_mm_setzero_si128(), x));
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(low0));
+#	else
+		// A power of two converts exactly, its exponent is the bit index. The sign of 2^31 converted as a signed integer is masked out.
+		glm_ivec4 const exp0 = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(low0)), 23), _mm_set1_epi32(0xFF));
+		glm_ivec4 const sub0 = _mm_sub_epi32(exp0, _mm_set1_epi32(127));
+		return _mm_or_si128(sub0, _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+#	endif
+}
+
+// Index of the most significant set bit of each lane, -1 for 0
+GLM_FUNC_QUALIFIER glm_ivec4 glm_uvec4_find_msb(glm_uvec4 x)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(x));
+#	else
+		// Clearing the bit below the most significant one keeps the rounded conversion below the next power of two,
+		// the exponent is the bit index. Lanes with the bit 31 set convert to negative floats and are selected apart.
+		glm_uvec4 const and0 = _mm_andnot_si128(_mm_srli_epi32(x, 1), x);
+		glm_ivec4 const exp0 = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(and0)), 23);
+		glm_ivec4 const sub0 = _mm_or_si128(_mm_sub_epi32(exp0, _mm_set1_epi32(127)), _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+		glm_ivec4 const sgn0 = _mm_srai_epi32(x, 31);
+		return _mm_or_si128(_mm_andnot_si128(sgn0, sub0), _mm_and_si128(sgn0, _mm_set1_epi32(31)));
+#	endif
+}
+
+// Sums modulo 2^32, Carry receives 1 for the lanes that overflowed and 0 otherwise
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_add_carry(glm_uvec4 x, glm_uvec4 y, glm_uvec4 * Carry)
+{
+	glm_uvec4 const add0 = _mm_add_epi32(x, y);
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		// No overflow when max(x, x + y) == x + y, the all ones mask plus one is 0
+		glm_uvec4 const cmp0 = _mm_cmpeq_epi32(_mm_max_epu32(x, add0), add0);
+		*Carry = _mm_add_epi32(cmp0, _mm_set1_epi32(1));
+#	else
+		glm_uvec4 const sgn0 = _mm_set1_epi32(static_cast<int>(0x80000000));
+		glm_uvec4 const cmp0 = _mm_cmpgt_epi32(_mm_xor_si128(x, sgn0), _mm_xor_si128(add0, sgn0));
+		*Carry = _mm_srli_epi32(cmp0, 31);
+#	endif
+	return add0;
+}
+
+// Differences modulo 2^32, Borrow receives 1 for the lanes where x < y and 0 otherwise
+GLM_FUNC_QUALIFIER glm_uvec4 glm_uvec4_sub_borrow(glm_uvec4 x, glm_uvec4 y, glm_uvec4 * Borrow)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_uvec4 const cmp0 = _mm_cmpeq_epi32(_mm_max_epu32(x, y), x);
+		*Borrow = _mm_add_epi32(cmp0, _mm_set1_epi32(1));
+#	else
+		glm_uvec4 const sgn0 = _mm_set1_epi32(static_cast<int>(0x80000000));
+		glm_uvec4 const cmp0 = _mm_cmpgt_epi32(_mm_xor_si128(y, sgn0), _mm_xor_si128(x, sgn0));
+		*Borrow = _mm_srli_epi32(cmp0, 31);
+#	endif
+	return _mm_sub_epi32(x, y);
+}
+
+// Full unsigned 64 bits products, even and odd lanes are multiplied apart and interleaved back into lsb and msb
+GLM_FUNC_QUALIFIER void glm_uvec4_mul_extended(glm_uvec4 x, glm_uvec4 y, glm_uvec4 * msb, glm_uvec4 * lsb)
+{
+	glm_uvec4 const mul0 = _mm_mul_epu32(x, y);
+	glm_uvec4 const mul1 = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+	glm_uvec4 const unp0 = _mm_unpacklo_epi32(mul0, mul1);
+	glm_uvec4 const unp1 = _mm_unpackhi_epi32(mul0, mul1);
+	*lsb = _mm_unpacklo_epi64(unp0, unp1);
+	*msb = _mm_unpackhi_epi64(unp0, unp1);
+}
+
+// Full signed 64 bits products
+GLM_FUNC_QUALIFIER void glm_ivec4_mul_extended(glm_ivec4 x, glm_ivec4 y, glm_ivec4 * msb, glm_ivec4 * lsb)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_ivec4 const mul0 = _mm_mul_epi32(x, y);
+		glm_ivec4 const mul1 = _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+		glm_ivec4 const unp0 = _mm_unpacklo_epi32(mul0, mul1);
+		glm_ivec4 const unp1 = _mm_unpackhi_epi32(mul0, mul1);
+		*lsb = _mm_unpacklo_epi64(unp0, unp1);
+		*msb = _mm_unpackhi_epi64(unp0, unp1);
+#	else
+		// The low halves are sign agnostic, the high halves are corrected as in glm_ivec4_mulhi
+		glm_ivec4 msb0;
+		glm_uvec4_mul_extended(x, y, &msb0, lsb);
+		glm_ivec4 const and0 = _mm_and_si128(_mm_srai_epi32(x, 31), y);
+		glm_ivec4 const and1 = _mm_and_si128(_mm_srai_epi32(y, 31), x);
+		*msb = _mm_sub_epi32(msb0, _mm_add_epi32(and0, and1));
+#	endif
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER __m256i glm_u32vec8_spread3(__m256i x)
+{
+	__m256i Reg1 = _mm256_and_si256(x, _mm256_set1_epi32(0x000003FF));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg1, 16), Reg1), _mm256_set1_epi32(0x030000FF));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg1,  8), Reg1), _mm256_set1_epi32(0x0300F00F));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg1,  4), Reg1), _mm256_set1_epi32(0x030C30C3));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi32(Reg1,  2), Reg1), _mm256_set1_epi32(0x09249249));
+	return Reg1;
+}
+
+GLM_FUNC_QUALIFIER __m256i glm_u32vec8_interleave3(__m256i x, __m256i y, __m256i z)
+{
+	__m256i const Reg1 = glm_u32vec8_spread3(x);
+	__m256i const Reg2 = _mm256_slli_epi32(glm_u32vec8_spread3(y), 1);
+	__m256i const Reg3 = _mm256_slli_epi32(glm_u32vec8_spread3(z), 2);
+	return _mm256_or_si256(_mm256_or_si256(Reg1, Reg2), Reg3);
+}
+
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_u64vec4_spread3(glm_u64vec4 x)
+{
+	glm_u64vec4 Reg1 = x;
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg1, 32), Reg1), _mm256_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull)));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg1, 16), Reg1), _mm256_set1_epi64x(static_cast<long long>(0x00FF0000FF0000FFull)));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg1,  8), Reg1), _mm256_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full)));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg1,  4), Reg1), _mm256_set1_epi64x(static_cast<long long>(0x30C30C30C30C30C3ull)));
+	Reg1 = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(Reg1,  2), Reg1), _mm256_set1_epi64x(static_cast<long long>(0x9249249249249249ull)));
+	return Reg1;
+}
+
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_u64vec4_interleave3(glm_u64vec4 x, glm_u64vec4 y, glm_u64vec4 z)
+{
+	glm_u64vec4 const Reg1 = glm_u64vec4_spread3(x);
+	glm_u64vec4 const Reg2 = _mm256_slli_epi64(glm_u64vec4_spread3(y), 1);
+	glm_u64vec4 const Reg3 = _mm256_slli_epi64(glm_u64vec4_spread3(z), 2);
+	return _mm256_or_si256(_mm256_or_si256(Reg1, Reg2), Reg3);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
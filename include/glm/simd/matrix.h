@@ -1025,4 +1025,42 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+GLM_FUNC_QUALIFIER glm_dvec2 glm_dmat2_mul_dvec2(glm_dvec2 const m[2], glm_dvec2 v)
+{
+	glm_dvec2 const v0 = _mm_unpacklo_pd(v, v);
+	glm_dvec2 const v1 = _mm_unpackhi_pd(v, v);
+
+	glm_dvec2 const m0 = _mm_mul_pd(m[0], v0);
+#	if GLM_HAS_FMA
+		return _mm_fmadd_pd(m[1], v1, m0);
+#	else
+		return _mm_add_pd(m0, _mm_mul_pd(m[1], v1));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat2_mul(glm_dvec2 const in1[2], glm_dvec2 const in2[2], glm_dvec2 out[2])
+{
+	glm_dvec2 const c0 = glm_dmat2_mul_dvec2(in1, in2[0]);
+	glm_dvec2 const c1 = glm_dmat2_mul_dvec2(in1, in2[1]);
+
+	out[0] = c0;
+	out[1] = c1;
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat2_inverse(glm_dvec2 const in[2], glm_dvec2 out[2])
+{
+	// m[0][0] * m[1][1] - m[1][0] * m[0][1] in both components
+	glm_dvec2 const swp0 = _mm_shuffle_pd(in[1], in[1], _MM_SHUFFLE2(0, 1));
+	glm_dvec2 const mul0 = _mm_mul_pd(in[0], swp0);
+	glm_dvec2 const det0 = _mm_sub_pd(_mm_unpacklo_pd(mul0, mul0), _mm_unpackhi_pd(mul0, mul0));
+	glm_dvec2 const rcp0 = _mm_div_pd(_mm_set1_pd(1.0), det0);
+
+	// (m[1][1], -m[0][1]) and (-m[1][0], m[0][0])
+	glm_dvec2 const col0 = _mm_xor_pd(_mm_unpackhi_pd(in[1], in[0]), _mm_set_pd(-0.0, 0.0));
+	glm_dvec2 const col1 = _mm_xor_pd(_mm_unpacklo_pd(in[1], in[0]), _mm_set_pd(0.0, -0.0));
+
+	out[0] = _mm_mul_pd(col0, rcp0);
+	out[1] = _mm_mul_pd(col1, rcp0);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
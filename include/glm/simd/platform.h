@@ -266,7 +266,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Instruction sets
 
-// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX2
+// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX512 GLM_FORCE_RUNTIME_DISPATCH
 
 #define GLM_ARCH_X86_BIT		0x00000001
 #define GLM_ARCH_SSE2_BIT		0x00000002
@@ -276,7 +276,7 @@
 #define GLM_ARCH_SSE42_BIT		0x00000020
 #define GLM_ARCH_AVX_BIT		0x00000040
 #define GLM_ARCH_AVX2_BIT		0x00000080
-#define GLM_ARCH_AVX512_BIT		0x00000100 // Skylake subset
+#define GLM_ARCH_AVX512_BIT		0x00000400 // Skylake subset: AVX-512 F, CD, BW, DQ and VL
 #define GLM_ARCH_ARM_BIT		0x00000100
 #define GLM_ARCH_NEON_BIT		0x00000200
 #define GLM_ARCH_MIPS_BIT		0x00010000
@@ -399,10 +399,87 @@
 #	include <emmintrin.h>
 #endif//GLM_ARCH
 
+// Runtime dispatch: define GLM_FORCE_RUNTIME_DISPATCH to also compile the AVX2 and AVX-512 variants of the array kernels
+// when GLM_ARCH doesn't include them. Each kernel selects its variant at first use from glm_cpu_arch, declared in simd/cpu.h.
+// Requires GCC 4.9, Clang 3.8 or Visual C++, whose intrinsics headers expose every instruction set.
+// AVX-512 variants additionally require GCC 5 or Clang 3.8.
+#if defined(GLM_FORCE_RUNTIME_DISPATCH) && (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !(GLM_ARCH & GLM_ARCH_AVX512_BIT) && ( \
+	(GLM_COMPILER & GLM_COMPILER_VC) || \
+	((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC49)) || \
+	((GLM_COMPILER & GLM_COMPILER_LLVM) && (GLM_COMPILER >= GLM_COMPILER_LLVM38)))
+#	define GLM_HAS_RUNTIME_DISPATCH 1
+#	include <immintrin.h>
+#else
+#	define GLM_HAS_RUNTIME_DISPATCH 0
+#endif
+
+#if GLM_HAS_RUNTIME_DISPATCH && ( \
+	((GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC50)) || \
+	(GLM_COMPILER & GLM_COMPILER_LLVM))
+#	define GLM_HAS_RUNTIME_DISPATCH_AVX512 1
+#else
+#	define GLM_HAS_RUNTIME_DISPATCH_AVX512 0
+#endif
+
+// Qualifiers of the functions using AVX2 and FMA, or AVX-512, instructions when GLM_ARCH doesn't include them
+#if GLM_HAS_RUNTIME_DISPATCH && !(GLM_ARCH & GLM_ARCH_AVX2_BIT) && !(GLM_COMPILER & GLM_COMPILER_VC)
+#	define GLM_TARGET_AVX2 __attribute__((__target__("avx2,fma")))
+#else
+#	define GLM_TARGET_AVX2
+#endif
+
+#if GLM_HAS_RUNTIME_DISPATCH_AVX512
+#	define GLM_TARGET_AVX512 __attribute__((__target__("avx512f,avx512cd,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#else
+#	define GLM_TARGET_AVX512
+#endif
+
+// BMI2 (pdep, pext) is not part of a GLM_ARCH level but ships with every AVX2 CPU.
+// Define GLM_FORCE_NO_BMI2 to avoid it on CPUs where pdep and pext are microcoded (AMD Zen and Zen 2).
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !defined(GLM_FORCE_NO_BMI2) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
+// FMA3 ships with every AVX2 CPU but GCC and Clang only enable it with -mfma or a -march including it, not with -mavx2.
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_FMA 1
+#else
+#	define GLM_HAS_FMA 0
+#endif
+
+// popcnt ships with every SSE4.2 CPU, lzcnt (ABM) and tzcnt (BMI1) with every AVX2 CPU.
+#if (GLM_ARCH & GLM_ARCH_SSE42_BIT) && (defined(__POPCNT__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_POPCNT 1
+#else
+#	define GLM_HAS_POPCNT 0
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__LZCNT__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_LZCNT 1
+#else
+#	define GLM_HAS_LZCNT 0
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__BMI__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_TZCNT 1
+#else
+#	define GLM_HAS_TZCNT 0
+#endif
+
+// VPOPCNTD is not part of the Skylake subset of GLM_ARCH_AVX512, it ships with Ice Lake CPUs.
+#if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && defined(__AVX512VPOPCNTDQ__)
+#	define GLM_HAS_AVX512_POPCNT 1
+#else
+#	define GLM_HAS_AVX512_POPCNT 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 	typedef __m128		glm_vec4;
 	typedef __m128i		glm_ivec4;
 	typedef __m128i		glm_uvec4;
+	typedef __m128d		glm_dvec2;
 #endif
 
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
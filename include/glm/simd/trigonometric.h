@@ -3,7 +3,149 @@
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Minimax approximation of cos(x) for x in [0, pi/2], about 5.2 correct digits
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_52s(glm_vec4 x)
+{
+	glm_vec4 const xx0 = glm_vec4_mul(x, x);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(-0.0012712095f), _mm_set1_ps(0.0414877472f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(-0.4999124376f));
+	glm_vec4 const mad2 = glm_vec4_fma(mad1, xx0, _mm_set1_ps(0.9999932946f));
+	return mad2;
+}
+
+// Branchless GTX_fast_trigonometry fastCos: the angle is wrapped to [0, 2pi) and folded to [0, pi/2] by symmetries of cos
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_cos(glm_vec4 x)
+{
+	glm_vec4 const pi0 = _mm_set1_ps(3.14159265358979323846f);
+	glm_vec4 const hpi0 = _mm_set1_ps(1.57079632679489661923f);
+	glm_vec4 const tpi0 = _mm_set1_ps(6.28318530717958647692f);
+
+	glm_vec4 const ang0 = glm_vec4_abs(glm_vec4_mod(x, tpi0));
+	glm_vec4 const ang1 = glm_vec4_select(_mm_cmpge_ps(ang0, pi0), glm_vec4_sub(tpi0, ang0), ang0);
+	glm_vec4 const neg0 = _mm_cmpge_ps(ang1, hpi0);
+	glm_vec4 const ang2 = glm_vec4_select(neg0, glm_vec4_sub(pi0, ang1), ang1);
+	glm_vec4 const sgn0 = _mm_and_ps(neg0, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+	return _mm_xor_ps(glm_vec4_cos_52s(ang2), sgn0);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_sin(glm_vec4 x)
+{
+	return glm_vec4_fast_cos(glm_vec4_sub(_mm_set1_ps(1.57079632679489661923f), x));
+}
+
+// Series of GTX_fast_trigonometry fastTan, accurate for small angles
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_tan(glm_vec4 x)
+{
+	glm_vec4 const xx0 = glm_vec4_mul(x, x);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(0.0539682539f), _mm_set1_ps(0.1333333333333f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(0.3333333333f));
+	return glm_vec4_fma(glm_vec4_mul(mad1, xx0), x, x);
+}
+
+// Series of GTX_fast_trigonometry fastAsin, accurate for |x| < 0.5
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_asin(glm_vec4 x)
+{
+	glm_vec4 const xx0 = glm_vec4_mul(x, x);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(0.0303819444f), _mm_set1_ps(0.0446428571f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(0.075f));
+	glm_vec4 const mad2 = glm_vec4_fma(mad1, xx0, _mm_set1_ps(0.166666667f));
+	return glm_vec4_fma(glm_vec4_mul(mad2, xx0), x, x);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_acos(glm_vec4 x)
+{
+	return glm_vec4_sub(_mm_set1_ps(1.57079632679489661923f), glm_vec4_fast_asin(x));
+}
+
+// Series of GTX_fast_trigonometry fastAtan, accurate for |x| < 0.5
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_atan(glm_vec4 x)
+{
+	glm_vec4 const xx0 = glm_vec4_mul(x, x);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(-0.0909090909f), _mm_set1_ps(0.111111111111f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(-0.1428571429f));
+	glm_vec4 const mad2 = glm_vec4_fma(mad1, xx0, _mm_set1_ps(0.2f));
+	glm_vec4 const mad3 = glm_vec4_fma(mad2, xx0, _mm_set1_ps(-0.333333333333f));
+	return glm_vec4_fma(glm_vec4_mul(mad3, xx0), x, x);
+}
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fast_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const sgn0 = glm_vec4_mul(glm_vec4_sign(y), glm_vec4_sign(x));
+	glm_vec4 const atn0 = glm_vec4_abs(glm_vec4_fast_atan(glm_vec4_div(y, x)));
+	return glm_vec4_mul(atn0, sgn0);
+}
+
+// Reduces x - Phase to [0, pi/2] as detail::cos_reduce, for |x| < 65536. Returns the sign bit of cos(x - Phase).
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_reduce(glm_vec4 x, glm_vec4 Phase, glm_vec4 * Angle)
+{
+	glm_vec4 const pi0 = _mm_set1_ps(3.14159265358979323846f);
+	glm_vec4 const tpi0 = _mm_set1_ps(6.28318530717958647692f);
+
+	glm_vec4 const trn0 = _mm_cvtepi32_ps(_mm_cvttps_epi32(glm_vec4_mul(x, _mm_set1_ps(0.159154943091895335769f))));
+	glm_vec4 const sub0 = glm_vec4_sub(x, glm_vec4_mul(trn0, _mm_set1_ps(6.28125f)));
+	glm_vec4 const sub1 = glm_vec4_sub(sub0, glm_vec4_mul(trn0, _mm_set1_ps(1.93530717958647692e-3f)));
+	glm_vec4 const abs0 = glm_vec4_abs(glm_vec4_sub(sub1, Phase));
+	glm_vec4 const ang0 = glm_vec4_select(_mm_cmpgt_ps(abs0, tpi0), glm_vec4_sub(abs0, tpi0), abs0);
+	glm_vec4 const ang1 = glm_vec4_select(_mm_cmpgt_ps(ang0, pi0), glm_vec4_sub(tpi0, ang0), ang0);
+	glm_vec4 const neg0 = _mm_cmpgt_ps(ang1, _mm_set1_ps(1.57079632679489661923f));
+	*Angle = glm_vec4_select(neg0, glm_vec4_sub(pi0, ang1), ang1);
+	return _mm_and_ps(neg0, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+}
+
+// cos(x - Phase) with the mediump polynomial of detail::cos_mediump, for |x| < 65536
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_mediump(glm_vec4 x, glm_vec4 Phase)
+{
+	glm_vec4 ang0;
+	glm_vec4 const sgn0 = glm_vec4_cos_reduce(x, Phase, &ang0);
+	return _mm_xor_ps(glm_vec4_cos_52s(ang0), sgn0);
+}
+
+// cos(x - Phase) with the lowp polynomial of detail::cos_lowp, for |x| < 65536
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos_lowp(glm_vec4 x, glm_vec4 Phase)
+{
+	glm_vec4 ang0;
+	glm_vec4 const sgn0 = glm_vec4_cos_reduce(x, Phase, &ang0);
+	glm_vec4 const xx0 = glm_vec4_mul(ang0, ang0);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(0.03679168f), _mm_set1_ps(-0.49558072f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(0.99940307f));
+	return _mm_xor_ps(mad1, sgn0);
+}
+
+// Reduces x to [-pi/2, pi/2] as detail::sin_reduce, for |x| < 65536. Returns the sign bit of sin(x).
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_reduce(glm_vec4 x, glm_vec4 * Angle)
+{
+	glm_ivec4 const rnd0 = _mm_cvtps_epi32(glm_vec4_mul(x, _mm_set1_ps(0.318309886183790671538f)));
+	glm_vec4 const rnd1 = _mm_cvtepi32_ps(rnd0);
+	glm_vec4 const sub0 = glm_vec4_sub(x, glm_vec4_mul(rnd1, _mm_set1_ps(3.140625f)));
+	*Angle = glm_vec4_sub(sub0, glm_vec4_mul(rnd1, _mm_set1_ps(9.67653589793e-4f)));
+	return _mm_castsi128_ps(_mm_slli_epi32(rnd0, 31));
+}
+
+// sin(x) with the mediump odd polynomial of detail::sin_mediump, for |x| < 65536
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_mediump(glm_vec4 x)
+{
+	glm_vec4 ang0;
+	glm_vec4 const sgn0 = glm_vec4_sin_reduce(x, &ang0);
+	glm_vec4 const xx0 = glm_vec4_mul(ang0, ang0);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(-0.0001848814f), _mm_set1_ps(0.0083118998f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(-0.1666555409f));
+	glm_vec4 const mad2 = glm_vec4_fma(mad1, xx0, _mm_set1_ps(0.9999990609f));
+	return _mm_xor_ps(glm_vec4_mul(mad2, ang0), sgn0);
+}
+
+// sin(x) with the lowp odd polynomial of detail::sin_lowp, for |x| < 65536
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin_lowp(glm_vec4 x)
+{
+	glm_vec4 ang0;
+	glm_vec4 const sgn0 = glm_vec4_sin_reduce(x, &ang0);
+	glm_vec4 const xx0 = glm_vec4_mul(ang0, ang0);
+	glm_vec4 const mad0 = glm_vec4_fma(xx0, _mm_set1_ps(0.0076029033f), _mm_set1_ps(-0.1659601165f));
+	glm_vec4 const mad1 = glm_vec4_fma(mad0, xx0, _mm_set1_ps(0.9998918213f));
+	return _mm_xor_ps(glm_vec4_mul(mad1, ang0), sgn0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -2,6 +2,13 @@
 #include <glm/exponential.hpp>
 #include <glm/gtc/ulp.hpp>
 #include <glm/gtc/vec1.hpp>
+#include <glm/vector_relational.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <vector>
 
 int test_pow()
 {
@@ -111,6 +118,314 @@ int test_inversesqrt()
 	return Error;
 }
 
+// Kernels of simd/exponential.h, used by aligned vec4
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+namespace simd
+{
+	typedef glm::tvec4<float, glm::aligned_highp> vec4;
+
+	// Distance in representable floats, through the ordering of their bits
+	static int ulp(float a, float b)
+	{
+		if(a == b || (a != a && b != b))
+			return 0;
+		if(a != a || b != b)
+			return 1 << 30;
+		glm::int32 ia, ib;
+		std::memcpy(&ia, &a, sizeof(ia));
+		std::memcpy(&ib, &b, sizeof(ib));
+		glm::int64 const oa = ia < 0 ? glm::int64(glm::int32(0x80000000)) - ia : ia;
+		glm::int64 const ob = ib < 0 ? glm::int64(glm::int32(0x80000000)) - ib : ib;
+		glm::int64 const d = oa < ob ? ob - oa : oa - ob;
+		return d > (1 << 30) ? 1 << 30 : static_cast<int>(d);
+	}
+
+	// Maximum error of Func on vec4 compared to Ref in double precision, for x in [Min, Max] with geometric or linear steps
+	template <typename funcType, typename refType>
+	static int max_ulp(funcType Func, refType Ref, float Min, float Max, bool Geometric)
+	{
+		int Result = 0;
+		int const Steps = 100000;
+		for(int i = 0; i < Steps; i += 4)
+		{
+			vec4 x;
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				double const t = static_cast<double>(i + j) / static_cast<double>(Steps - 1);
+				x[j] = static_cast<float>(Geometric ? Min * std::pow(static_cast<double>(Max) / Min, t) : Min + (Max - Min) * t);
+			}
+			vec4 const y = Func(x);
+			for(glm::length_t j = 0; j < 4; ++j)
+				Result = glm::max(Result, ulp(y[j], static_cast<float>(Ref(static_cast<double>(x[j])))));
+		}
+		return Result;
+	}
+
+	static vec4 exp(vec4 const & x){return glm::exp(x);}
+	static vec4 exp2(vec4 const & x){return glm::exp2(x);}
+	static vec4 log(vec4 const & x){return glm::log(x);}
+	static vec4 log2(vec4 const & x){return glm::log2(x);}
+	static vec4 inversesqrt(vec4 const & x){return glm::inversesqrt(x);}
+	static double ref_exp(double x){return std::exp(x);}
+	static double ref_exp2(double x){return std::pow(2.0, x);}
+	static double ref_log(double x){return std::log(x);}
+	static double ref_log2(double x){return std::log(x) / std::log(2.0);}
+	static double ref_inversesqrt(double x){return 1.0 / std::sqrt(x);}
+
+	static int test_accuracy()
+	{
+		int Error = 0;
+
+		int const Exp = glm::max(max_ulp(exp, ref_exp, -103.0f, 88.7f, false), max_ulp(exp, ref_exp, -1.0f, 1.0f, false));
+		int const Exp2 = glm::max(max_ulp(exp2, ref_exp2, -149.0f, 127.9f, false), max_ulp(exp2, ref_exp2, -1.0f, 1.0f, false));
+		int const Log = glm::max(max_ulp(log, ref_log, 1e-44f, 3e38f, true), max_ulp(log, ref_log, 0.5f, 2.0f, false));
+		int const Log2 = glm::max(max_ulp(log2, ref_log2, 1e-44f, 3e38f, true), max_ulp(log2, ref_log2, 0.5f, 2.0f, false));
+		int const InverseSqrt = max_ulp(inversesqrt, ref_inversesqrt, 1e-37f, 3e38f, true);
+
+		// pow on a grid of bases and exponents
+		int Pow16 = 0, Pow128 = 0;
+		for(int i = 0; i < 1000; ++i)
+		for(int j = 0; j < 256; j += 4)
+		{
+			float const Base = static_cast<float>(std::pow(10.0, -6.0 + 12.0 * i / 999.0));
+			vec4 Exponent;
+			for(glm::length_t k = 0; k < 4; ++k)
+				Exponent[k] = -8.0f + 16.0f * static_cast<float>(j + k) / 255.0f;
+			vec4 const Result = glm::pow(vec4(Base), Exponent);
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				double const Log2 = static_cast<double>(Exponent[k]) * std::log(static_cast<double>(Base)) / std::log(2.0);
+				double const Ref = std::pow(static_cast<double>(Base), static_cast<double>(Exponent[k]));
+				if(Ref < static_cast<double>(std::numeric_limits<float>::min()) || Ref > static_cast<double>(std::numeric_limits<float>::max()))
+					continue;
+				int const Distance = ulp(Result[k], static_cast<float>(Ref));
+				if(glm::abs(Log2) < 16.0)
+					Pow16 = glm::max(Pow16, Distance);
+				else
+					Pow128 = glm::max(Pow128, Distance);
+			}
+		}
+
+		std::printf("Max ULP error: exp %d, exp2 %d, log %d, log2 %d, inversesqrt %d, pow %d (|y log2(x)| < 16), %d (< 128)\n",
+			Exp, Exp2, Log, Log2, InverseSqrt, Pow16, Pow128);
+
+		Error += Exp <= 2 ? 0 : 1;
+		Error += Exp2 <= 2 ? 0 : 1;
+		Error += Log <= 2 ? 0 : 1;
+		Error += Log2 <= 2 ? 0 : 1;
+		Error += InverseSqrt <= 1 ? 0 : 1;
+		Error += Pow16 <= 2 ? 0 : 1;
+		Error += Pow128 <= 4 ? 0 : 1;
+
+		// Exact cases
+		Error += glm::all(glm::equal(glm::exp2(vec4(-3, 0, 10, 127)), vec4(0.125f, 1, 1024, std::pow(2.0f, 127.0f)))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::log2(vec4(0.125f, 1, 1024, std::pow(2.0f, -140.0f))), vec4(-3, 0, 10, -140))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::pow(vec4(2, 3, 10, 0.5f), vec4(10, 2, 3, 2)), vec4(1024, 9, 1000, 0.25f))) ? 0 : 1;
+
+		return Error;
+	}
+
+	static bool negative(float x)
+	{
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		return (Bits & 0x80000000) != 0;
+	}
+
+	// Equal values, including the sign of zeros, or both NaN
+	static bool same(vec4 const & a, vec4 const & b)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			if(a[i] != a[i] || b[i] != b[i])
+			{
+				if(a[i] == a[i] || b[i] == b[i])
+					return false;
+			}
+			else if(a[i] != b[i] || negative(a[i]) != negative(b[i]))
+				return false;
+		}
+		return true;
+	}
+
+	static int test_special()
+	{
+		int Error = 0;
+
+		float const Inf = std::numeric_limits<float>::infinity();
+		float const NaN = std::numeric_limits<float>::quiet_NaN();
+		float const Den = std::numeric_limits<float>::denorm_min();
+
+		Error += same(glm::exp(vec4(Inf, -Inf, NaN, 100)), vec4(Inf, 0, NaN, Inf)) ? 0 : 1;
+		Error += same(glm::exp(vec4(-103, -88, 0, -0.0f)), vec4(static_cast<float>(std::exp(-103.0)), static_cast<float>(std::exp(-88.0)), 1, 1)) ? 0 : 1;
+		Error += same(glm::exp2(vec4(Inf, -Inf, NaN, -149)), vec4(Inf, 0, NaN, Den)) ? 0 : 1;
+		Error += same(glm::exp2(vec4(128, -150, -1000, 1000)), vec4(Inf, 0, 0, Inf)) ? 0 : 1;
+		Error += same(glm::log(vec4(Inf, 0, -0.0f, -1)), vec4(Inf, -Inf, -Inf, NaN)) ? 0 : 1;
+		Error += same(glm::log(vec4(NaN, -Inf, 1, Den)), vec4(NaN, NaN, 0, static_cast<float>(std::log(static_cast<double>(Den))))) ? 0 : 1;
+		Error += same(glm::log2(vec4(Inf, 0, -1, Den)), vec4(Inf, -Inf, NaN, -149)) ? 0 : 1;
+		Error += same(glm::inversesqrt(vec4(Inf, 0, 4, -1)), vec4(0, Inf, 0.5f, NaN)) ? 0 : 1;
+
+		Error += same(glm::pow(vec4(NaN, 1, Inf, -1), vec4(0, NaN, 0, Inf)), vec4(1, 1, 1, 1)) ? 0 : 1;
+		Error += same(glm::pow(vec4(-2, -2, -2, -8), vec4(3, 2, 0.5f, -1)), vec4(-8, 4, NaN, -0.125f)) ? 0 : 1;
+		Error += same(glm::pow(vec4(0, -0.0f, -0.0f, 0), vec4(2, 3, -3, -0.5f)), vec4(0, -0.0f, -Inf, Inf)) ? 0 : 1;
+		Error += same(glm::pow(vec4(Inf, Inf, -Inf, -Inf), vec4(2, -2, 3, -3)), vec4(Inf, 0, -Inf, -0.0f)) ? 0 : 1;
+		Error += same(glm::pow(vec4(2, 0.5f, -2, 2), vec4(Inf, Inf, -Inf, NaN)), vec4(Inf, 0, 0, NaN)) ? 0 : 1;
+		Error += same(glm::pow(vec4(2, 2, 10, -3), vec4(128, -150, -50, 33554432.0f)), vec4(Inf, 0, 0, Inf)) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int perf()
+	{
+		int const Count = 1 << 16;
+		std::vector<vec4> In(Count), Out(Count);
+		for(int i = 0; i < Count; ++i)
+			In[i] = vec4(static_cast<float>(i) / Count + 0.1f);
+
+		std::clock_t const StartScalar = std::clock();
+		for(int j = 0; j < 20; ++j)
+		for(int i = 0; i < Count; ++i)
+		for(glm::length_t k = 0; k < 4; ++k)
+			Out[i][k] = std::pow(In[i][k], 2.4f);
+		std::clock_t const StartSimd = std::clock();
+		for(int j = 0; j < 20; ++j)
+		for(int i = 0; i < Count; ++i)
+			Out[i] = glm::pow(In[i], vec4(2.4f));
+		std::clock_t const End = std::clock();
+
+		std::printf("pow: std::pow %d clocks, vec4 %d clocks\n", static_cast<int>(StartSimd - StartScalar), static_cast<int>(End - StartSimd));
+
+		return Out[0].x > 0.0f ? 0 : 1;
+	}
+}//namespace simd
+#endif
+
+// Approximations selected by mediump and lowp float vectors, see core_func_exponential
+namespace precision_tier
+{
+	struct bounds
+	{
+		double Exp, Log, Pow, InverseSqrt, Sqrt;
+	};
+
+	template <glm::precision P>
+	static int test(bounds const & Bounds)
+	{
+		typedef glm::tvec4<float, P> vec4;
+
+		double Exp = 0, Log = 0, Pow = 0, InverseSqrt = 0, Sqrt = 0;
+		for(int i = 0; i < 4096; ++i)
+		{
+			float const x = -32.0f + 64.0f * static_cast<float>(i) / 4096.0f;
+			float const y = 0.001f + 1000.0f * static_cast<float>(i) / 4096.0f;
+			vec4 const X(x, x * 0.5f, -x, x * 0.25f);
+
+			vec4 const Exp2Result = glm::exp2(X);
+			vec4 const ExpResult = glm::exp(X);
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Exp = glm::max(Exp, std::fabs(Exp2Result[j] / std::pow(2.0, static_cast<double>(X[j])) - 1.0));
+				Exp = glm::max(Exp, std::fabs(ExpResult[j] / std::exp(static_cast<double>(X[j])) - 1.0));
+			}
+
+			vec4 const Log2Result = glm::log2(vec4(y));
+			vec4 const LogResult = glm::log(vec4(y));
+			Log = glm::max(Log, std::fabs(Log2Result.x - std::log(static_cast<double>(y)) / std::log(2.0)));
+			Log = glm::max(Log, std::fabs(LogResult.x - std::log(static_cast<double>(y))));
+
+			// pow bound relative to 1 + |exponent|
+			vec4 const PowResult = glm::pow(vec4(y), vec4(2.2f));
+			Pow = glm::max(Pow, std::fabs(PowResult.x / std::pow(static_cast<double>(y), 2.2) - 1.0) / 3.2);
+
+			vec4 const InverseSqrtResult = glm::inversesqrt(vec4(y));
+			vec4 const SqrtResult = glm::sqrt(vec4(y));
+			InverseSqrt = glm::max(InverseSqrt, std::fabs(InverseSqrtResult.x * std::sqrt(static_cast<double>(y)) - 1.0));
+			Sqrt = glm::max(Sqrt, std::fabs(SqrtResult.x / std::sqrt(static_cast<double>(y)) - 1.0));
+		}
+
+		int Error = 0;
+
+		Error += Exp < Bounds.Exp ? 0 : 1;
+		Error += Log < Bounds.Log ? 0 : 1;
+		Error += Pow < Bounds.Pow ? 0 : 1;
+		Error += InverseSqrt < Bounds.InverseSqrt ? 0 : 1;
+		Error += Sqrt < Bounds.Sqrt ? 0 : 1;
+
+		// Special values use the highp functions
+		float const Inf = std::numeric_limits<float>::infinity();
+		Error += glm::exp2(vec4(-Inf)).x == 0.0f ? 0 : 1;
+		Error += glm::exp(vec4(Inf)).x == Inf ? 0 : 1;
+		Error += glm::log(vec4(0.0f)).x == -Inf ? 0 : 1;
+		Error += glm::log2(vec4(Inf)).x == Inf ? 0 : 1;
+		Error += glm::pow(vec4(-2.0f), vec4(3.0f)).x == -8.0f ? 0 : 1;
+		Error += glm::pow(vec4(0.0f), vec4(2.0f)).x == 0.0f ? 0 : 1;
+		Error += glm::pow(vec4(1.0f), vec4(Inf)).x == 1.0f ? 0 : 1;
+		Error += glm::pow(vec4(Inf), vec4(0.0f)).x == 1.0f ? 0 : 1;
+		Error += glm::pow(vec4(Inf), vec4(2.0f)).x == Inf ? 0 : 1;
+		Error += glm::pow(vec4(0.5f), vec4(-Inf)).x == Inf ? 0 : 1;
+		Error += glm::sqrt(vec4(0.0f)).x == 0.0f ? 0 : 1;
+		Error += glm::sqrt(vec4(Inf)).x == Inf ? 0 : 1;
+		Error += glm::sqrt(vec4(1e-40f)).x == std::sqrt(1e-40f) ? 0 : 1;
+		Error += glm::length(glm::tvec3<float, P>(3e38f, 3e38f, 0.0f)) == Inf ? 0 : 1;
+		Error += glm::length(glm::tvec4<float, P>(0.0f)) == 0.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		bounds const Highp = {2e-6, 2e-6, 1e-6, 1e-6, 1e-6};
+		bounds const Mediump = {5e-6, 3e-6, 3e-6, 5e-6, 1e-6};
+		bounds const Lowp = {2e-3, 1e-3, 2e-3, 2e-3, 2e-3};
+
+		int Error = 0;
+
+		Error += test<glm::highp>(Highp);
+		Error += test<glm::mediump>(Mediump);
+		Error += test<glm::lowp>(Lowp);
+		Error += test<glm::aligned_highp>(Highp);
+		Error += test<glm::aligned_mediump>(Mediump);
+		Error += test<glm::aligned_lowp>(Lowp);
+
+		return Error;
+	}
+
+	template <glm::precision P>
+	static int perf(char const * Name)
+	{
+		typedef glm::tvec4<float, P> vec4;
+
+		std::vector<vec4> Data(4096);
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Data[i] = vec4(static_cast<float>(i) / static_cast<float>(Data.size()) + 0.5f);
+
+		vec4 Sum(0);
+		std::clock_t const Time0 = std::clock();
+		for(int j = 0; j < 100; ++j)
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Sum += glm::exp(Data[i]) + glm::log(Data[i]);
+		std::clock_t const Time1 = std::clock();
+
+		std::printf("%s exp + log: %d clocks\n", Name, static_cast<int>(Time1 - Time0));
+
+		return Sum.x > 0.0f ? 0 : 1;
+	}
+
+	static int perf()
+	{
+		int Error = 0;
+
+		Error += perf<glm::highp>("highp");
+		Error += perf<glm::mediump>("mediump");
+		Error += perf<glm::lowp>("lowp");
+		Error += perf<glm::aligned_highp>("aligned_highp");
+		Error += perf<glm::aligned_mediump>("aligned_mediump");
+		Error += perf<glm::aligned_lowp>("aligned_lowp");
+
+		return Error;
+	}
+}//namespace precision_tier
+
 int main()
 {
 	int Error(0);
@@ -122,6 +437,13 @@ int main()
 	Error += test_log2();
 	Error += test_sqrt();
 	Error += test_inversesqrt();
+	Error += precision_tier::test();
+	Error += precision_tier::perf();
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+		Error += simd::test_accuracy();
+		Error += simd::test_special();
+		Error += simd::perf();
+#	endif
 
 	return Error;
 }
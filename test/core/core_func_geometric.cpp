@@ -3,6 +3,7 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/vec1.hpp>
 #include <limits>
+#include <cmath>
 
 namespace length
 {
@@ -168,6 +169,59 @@ namespace refract
 	}
 }//namespace refract
 
+namespace precision_tier
+{
+	template <glm::precision P>
+	static int test(float Epsilon)
+	{
+		typedef glm::tvec4<float, P> vec4;
+		typedef glm::tvec3<float, P> vec3;
+
+		int Error = 0;
+
+		for(int i = 1; i < 1024; ++i)
+		{
+			float const x = static_cast<float>(i) * 0.37f;
+			vec4 const V(x, -1.0f, x * 0.01f, 3.0f);
+			vec3 const W(x, -1.0f, x * 0.01f);
+
+			// Lengths of the normalized vectors in highp, to only measure the error of normalize
+			Error += glm::abs(glm::length(glm::vec4(glm::normalize(V))) - 1.0f) < Epsilon ? 0 : 1;
+			Error += glm::abs(glm::length(glm::vec3(glm::normalize(W))) - 1.0f) < Epsilon ? 0 : 1;
+
+			float const Length = std::sqrt(x * x + 1.0f + x * x * 0.0001f + 9.0f);
+			Error += glm::abs(glm::length(V) / Length - 1.0f) < Epsilon ? 0 : 1;
+			Error += glm::abs(glm::distance(V, vec4(0)) / Length - 1.0f) < Epsilon ? 0 : 1;
+
+			float const Length3 = std::sqrt(x * x + 1.0f + x * x * 0.0001f);
+			Error += glm::abs(glm::length(W) / Length3 - 1.0f) < Epsilon ? 0 : 1;
+			Error += glm::abs(glm::distance(W, vec3(0)) / Length3 - 1.0f) < Epsilon ? 0 : 1;
+			Error += glm::abs(glm::dot(W, W) / (Length3 * Length3) - 1.0f) < 1e-6f ? 0 : 1;
+
+			vec3 const Cross = glm::cross(W, vec3(0, 0, 1));
+			Error += glm::all(glm::epsilonEqual(glm::vec3(Cross), glm::vec3(-1.0f, -x, 0.0f), 1e-5f * (1.0f + x))) ? 0 : 1;
+		}
+
+		Error += glm::length(vec4(0)) == 0.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test<glm::highp>(1e-6f);
+		Error += test<glm::mediump>(1e-5f);
+		Error += test<glm::lowp>(2e-3f);
+		Error += test<glm::aligned_highp>(1e-6f);
+		Error += test<glm::aligned_mediump>(1e-5f);
+		Error += test<glm::aligned_lowp>(2e-3f);
+
+		return Error;
+	}
+}//namespace precision_tier
+
 int main()
 {
 	int Error(0);
@@ -180,6 +234,7 @@ int main()
 	Error += faceforward::test();
 	Error += reflect::test();
 	Error += refract::test();
+	Error += precision_tier::test();
 
 	return Error;
 }
@@ -1,6 +1,7 @@
 #include <glm/integer.hpp>
 #include <glm/vector_relational.hpp>
 #include <glm/gtc/vec1.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <vector>
 #include <ctime>
 #include <cstdio>
@@ -1182,7 +1183,7 @@ namespace usubBorrow
 			glm::uint Result = glm::usubBorrow(x, y, Borrow);
 
 			Error += Borrow == 1 ? 0 : 1;
-			Error += Result == 1 ? 0 : 1;
+			Error += Result == 0xFFFFFFFFu ? 0 : 1;
 		}
 
 		{
@@ -1192,7 +1193,7 @@ namespace usubBorrow
 			glm::uvec1 Result(glm::usubBorrow(x, y, Borrow));
 
 			Error += glm::all(glm::equal(Borrow, glm::uvec1(1))) ? 0 : 1;
-			Error += glm::all(glm::equal(Result, glm::uvec1(1))) ? 0 : 1;
+			Error += glm::all(glm::equal(Result, glm::uvec1(0xFFFFFFFFu))) ? 0 : 1;
 		}
 
 		{
@@ -1202,7 +1203,7 @@ namespace usubBorrow
 			glm::uvec2 Result(glm::usubBorrow(x, y, Borrow));
 
 			Error += glm::all(glm::equal(Borrow, glm::uvec2(1))) ? 0 : 1;
-			Error += glm::all(glm::equal(Result, glm::uvec2(1))) ? 0 : 1;
+			Error += glm::all(glm::equal(Result, glm::uvec2(0xFFFFFFFFu))) ? 0 : 1;
 		}
 
 		{
@@ -1212,7 +1213,7 @@ namespace usubBorrow
 			glm::uvec3 Result(glm::usubBorrow(x, y, Borrow));
 
 			Error += glm::all(glm::equal(Borrow, glm::uvec3(1))) ? 0 : 1;
-			Error += glm::all(glm::equal(Result, glm::uvec3(1))) ? 0 : 1;
+			Error += glm::all(glm::equal(Result, glm::uvec3(0xFFFFFFFFu))) ? 0 : 1;
 		}
 
 		{
@@ -1222,7 +1223,7 @@ namespace usubBorrow
 			glm::uvec4 Result(glm::usubBorrow(x, y, Borrow));
 
 			Error += glm::all(glm::equal(Borrow, glm::uvec4(1))) ? 0 : 1;
-			Error += glm::all(glm::equal(Result, glm::uvec4(1))) ? 0 : 1;
+			Error += glm::all(glm::equal(Result, glm::uvec4(0xFFFFFFFFu))) ? 0 : 1;
 		}
 
 		return Error;
@@ -1527,6 +1528,158 @@ namespace bitCount
 	}
 }//bitCount
 
+namespace aligned
+{
+	// Reference bit scans, matching the unsigned interpretation of signed values
+	static int bitCount_ref(glm::uint v)
+	{
+		int Count(0);
+		for(; v; v >>= 1)
+			Count += static_cast<int>(v & 1u);
+		return Count;
+	}
+
+	static int findLSB_ref(glm::uint v)
+	{
+		for(int i = 0; i < 32; ++i)
+			if(v & (1u << i))
+				return i;
+		return -1;
+	}
+
+	static int findMSB_ref(glm::uint v)
+	{
+		for(int i = 31; i >= 0; --i)
+			if(v & (1u << i))
+				return i;
+		return -1;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		glm::uint Seed(1);
+		for(std::size_t i = 0; i < 100000; ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			glm::uint const Value = Seed >> (i % 32);
+
+			glm::uvec4 const Data(Value, ~Value, Value & (0u - Value), i < 4 ? (i == 0 ? 0u : 1u << (28 + i)) : Value << (i % 32));
+			glm::aligned_uvec4 const DataU(Data);
+			glm::ivec4 const DataSigned(Data);
+			glm::aligned_ivec4 const DataI(DataSigned);
+
+			glm::ivec4 const CountU(glm::bitCount(DataU));
+			glm::ivec4 const CountI(glm::bitCount(DataI));
+			glm::ivec4 const LSBU(glm::findLSB(DataU));
+			glm::ivec4 const LSBI(glm::findLSB(DataI));
+			glm::ivec4 const MSBU(glm::findMSB(DataU));
+			glm::ivec4 const MSBI(glm::findMSB(DataI));
+			glm::uvec4 const Reverse(glm::bitfieldReverse(DataU));
+
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Error += CountU[j] == bitCount_ref(Data[j]) ? 0 : 1;
+				Error += CountI[j] == bitCount_ref(Data[j]) ? 0 : 1;
+				Error += LSBU[j] == findLSB_ref(Data[j]) ? 0 : 1;
+				Error += LSBI[j] == findLSB_ref(Data[j]) ? 0 : 1;
+				Error += MSBU[j] == findMSB_ref(Data[j]) ? 0 : 1;
+				Error += MSBI[j] == findMSB_ref(Data[j]) ? 0 : 1;
+				Error += Reverse[j] == glm::bitfieldReverse(Data[j]) ? 0 : 1;
+			}
+
+			Error += glm::bitCount(Value) == bitCount_ref(Value) ? 0 : 1;
+			Error += glm::findLSB(Value) == findLSB_ref(Value) ? 0 : 1;
+			Error += glm::findMSB(Value) == findMSB_ref(Value) ? 0 : 1;
+			Error += glm::findMSB(static_cast<int>(Value)) == findMSB_ref(Value) ? 0 : 1;
+		}
+
+		glm::uint64 const Value64 = 0x8000000100000000ull;
+		Error += glm::bitCount(Value64) == 2 ? 0 : 1;
+		Error += glm::findLSB(Value64) == 32 ? 0 : 1;
+		Error += glm::findMSB(Value64) == 63 ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_extended()
+	{
+		int Error(0);
+
+		glm::uint Seed(1);
+		for(std::size_t i = 0; i < 100000; ++i)
+		{
+			glm::uvec4 x, y;
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				Seed = Seed * 1664525u + 1013904223u;
+				x[j] = Seed ^ (Seed >> 15);
+				Seed = Seed * 1664525u + 1013904223u;
+				y[j] = i < 4 ? x[j] + static_cast<glm::uint>(i) - 2u : Seed ^ (Seed >> 15);
+			}
+
+			glm::aligned_uvec4 const xU(x), yU(y);
+			glm::ivec4 const xSigned(x), ySigned(y);
+			glm::aligned_ivec4 const xI(xSigned), yI(ySigned);
+
+			glm::aligned_uvec4 Carry, Borrow, msbU, lsbU;
+			glm::aligned_ivec4 msbI, lsbI;
+			glm::uvec4 const Sum(glm::uaddCarry(xU, yU, Carry));
+			glm::uvec4 const Diff(glm::usubBorrow(xU, yU, Borrow));
+			glm::umulExtended(xU, yU, msbU, lsbU);
+			glm::imulExtended(xI, yI, msbI, lsbI);
+
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				glm::uint64 const SumRef = static_cast<glm::uint64>(x[j]) + y[j];
+				glm::uint64 const ProductU = static_cast<glm::uint64>(x[j]) * y[j];
+				glm::int64 const ProductI = static_cast<glm::int64>(xSigned[j]) * ySigned[j];
+
+				Error += Sum[j] == static_cast<glm::uint>(SumRef) && Carry[j] == static_cast<glm::uint>(SumRef >> 32) ? 0 : 1;
+				Error += Diff[j] == x[j] - y[j] && Borrow[j] == (x[j] < y[j] ? 1u : 0u) ? 0 : 1;
+				Error += msbU[j] == static_cast<glm::uint>(ProductU >> 32) && lsbU[j] == static_cast<glm::uint>(ProductU) ? 0 : 1;
+				Error += msbI[j] == static_cast<int>(ProductI >> 32) && lsbI[j] == static_cast<int>(ProductI) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Size)
+	{
+		int Error(0);
+
+		std::vector<glm::ivec4> Data(Size);
+		for(std::size_t i = 0; i < Size; ++i)
+			Data[i] = glm::ivec4(static_cast<int>(i), static_cast<int>(i * 3), static_cast<int>(i << 7), ~static_cast<int>(i));
+
+		std::vector<glm::aligned_ivec4> DataAligned(Data.begin(), Data.end());
+		std::vector<glm::ivec4> Results(Size);
+		std::vector<glm::aligned_ivec4> ResultsAligned(Size);
+
+		std::clock_t Timestamp0 = std::clock();
+
+		for(std::size_t i = 0; i < Size; ++i)
+			Results[i] = glm::bitCount(Data[i]) + glm::findLSB(Data[i]) + glm::findMSB(Data[i]);
+
+		std::clock_t Timestamp1 = std::clock();
+
+		for(std::size_t i = 0; i < Size; ++i)
+			ResultsAligned[i] = glm::bitCount(DataAligned[i]) + glm::findLSB(DataAligned[i]) + glm::findMSB(DataAligned[i]);
+
+		std::clock_t Timestamp2 = std::clock();
+
+		for(std::size_t i = 0; i < Size; ++i)
+			Error += glm::all(glm::equal(Results[i], glm::ivec4(ResultsAligned[i]))) ? 0 : 1;
+
+		std::printf("bitCount, findLSB, findMSB - ivec4: %d clocks\n", static_cast<int>(Timestamp1 - Timestamp0));
+		std::printf("bitCount, findLSB, findMSB - aligned_ivec4: %d clocks\n", static_cast<int>(Timestamp2 - Timestamp1));
+
+		return Error;
+	}
+}//namespace aligned
+
 int main()
 {
 	int Error = 0;
@@ -1541,6 +1694,8 @@ int main()
 	Error += ::usubBorrow::test();
 	Error += ::bitfieldInsert::test();
 	Error += ::bitfieldExtract::test();
+	Error += ::aligned::test();
+	Error += ::aligned::test_extended();
 
 #	ifdef NDEBUG
 		std::size_t const Samples = 1000;
@@ -1548,6 +1703,7 @@ int main()
 		::bitfieldReverse::perf(Samples);
 		::findMSB::perf(Samples);
 		::findLSB::perf(Samples);
+		Error += ::aligned::perf(1 << 20);
 #	endif
 
 	return Error;
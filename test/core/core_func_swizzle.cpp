@@ -1,6 +1,10 @@
 #define GLM_MESSAGES
 #define GLM_SWIZZLE
 #include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
 
 int test_ivec2_swizzle()
 {
@@ -61,6 +65,133 @@ int test_vec4_swizzle()
 	return Error;
 }
 
+#if GLM_HAS_UNRESTRICTED_UNIONS
+template <typename T, glm::precision P>
+static int test_swizzle_read()
+{
+	int Error = 0;
+
+	glm::tvec4<T, P> const A(1, 2, 3, 4);
+	glm::tvec3<T, P> const B(5, 6, 7);
+	glm::tvec2<T, P> const C(8, 9);
+
+	Error += glm::tvec4<T, P>(A.wzyx) == glm::tvec4<T, P>(4, 3, 2, 1) ? 0 : 1;
+	Error += glm::tvec4<T, P>(A.xxyy) == glm::tvec4<T, P>(1, 1, 2, 2) ? 0 : 1;
+	Error += glm::tvec4<T, P>(A.zwzx) == glm::tvec4<T, P>(3, 4, 3, 1) ? 0 : 1;
+	Error += glm::tvec3<T, P>(A.wyx) == glm::tvec3<T, P>(4, 2, 1) ? 0 : 1;
+	Error += glm::tvec2<T, P>(A.wz) == glm::tvec2<T, P>(4, 3) ? 0 : 1;
+	Error += glm::tvec2<T, P>(A.yx) == glm::tvec2<T, P>(2, 1) ? 0 : 1;
+
+	Error += glm::tvec4<T, P>(B.zyxz) == glm::tvec4<T, P>(7, 6, 5, 7) ? 0 : 1;
+	Error += glm::tvec3<T, P>(B.zxy) == glm::tvec3<T, P>(7, 5, 6) ? 0 : 1;
+	Error += glm::tvec2<T, P>(B.zx) == glm::tvec2<T, P>(7, 5) ? 0 : 1;
+
+	Error += glm::tvec4<T, P>(C.yxyx) == glm::tvec4<T, P>(9, 8, 9, 8) ? 0 : 1;
+	Error += glm::tvec3<T, P>(C.yyx) == glm::tvec3<T, P>(9, 9, 8) ? 0 : 1;
+	Error += glm::tvec2<T, P>(C.yx) == glm::tvec2<T, P>(9, 8) ? 0 : 1;
+
+	// The fourth lane of aligned tvec3 is not filled by the swizzle
+	glm::tvec3<T, P> const D(A.wzy);
+	Error += glm::tvec3<T, P>(D * D) == glm::tvec3<T, P>(16, 9, 4) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::precision P>
+static int test_swizzle_write()
+{
+	int Error = 0;
+
+	glm::tvec4<T, P> A(1, 2, 3, 4);
+	A.wzyx = glm::tvec4<T, P>(5, 6, 7, 8);
+	Error += A == glm::tvec4<T, P>(8, 7, 6, 5) ? 0 : 1;
+	A.zxw = glm::tvec3<T, P>(1, 2, 3);
+	Error += A == glm::tvec4<T, P>(2, 7, 1, 3) ? 0 : 1;
+	A.yx = glm::tvec2<T, P>(4, 5);
+	Error += A == glm::tvec4<T, P>(5, 4, 1, 3) ? 0 : 1;
+	A.wy = glm::tvec2<T, P>(6, 7);
+	Error += A == glm::tvec4<T, P>(5, 7, 1, 6) ? 0 : 1;
+	A.xyzw = A.wzyx;
+	Error += A == glm::tvec4<T, P>(6, 1, 7, 5) ? 0 : 1;
+	A.zyx += glm::tvec3<T, P>(1, 2, 3);
+	Error += A == glm::tvec4<T, P>(9, 3, 8, 5) ? 0 : 1;
+	A.wz *= glm::tvec2<T, P>(2, 3);
+	Error += A == glm::tvec4<T, P>(9, 3, 24, 10) ? 0 : 1;
+
+	glm::tvec3<T, P> B(1, 2, 3);
+	B.zxy = glm::tvec3<T, P>(4, 5, 6);
+	Error += B == glm::tvec3<T, P>(5, 6, 4) ? 0 : 1;
+	B.zx = glm::tvec2<T, P>(7, 8);
+	Error += B == glm::tvec3<T, P>(8, 6, 7) ? 0 : 1;
+	B.yx -= glm::tvec2<T, P>(1, 2);
+	Error += B == glm::tvec3<T, P>(6, 5, 7) ? 0 : 1;
+
+	glm::tvec2<T, P> C(1, 2);
+	C.yx = glm::tvec2<T, P>(3, 4);
+	Error += C == glm::tvec2<T, P>(4, 3) ? 0 : 1;
+
+	return Error;
+}
+
+// Swizzles of vectors of different lengths share the same type, they must not read past the end of the smaller vectors
+static int test_swizzle_bounds()
+{
+	int Error = 0;
+
+	struct vec2_pair
+	{
+		float Pad;
+		glm::aligned_vec2 Vector;
+	};
+
+	std::vector<vec2_pair> Pairs(8);
+	for(std::size_t i = 0; i < Pairs.size(); ++i)
+	{
+		Pairs[i].Pad = 0.0f;
+		Pairs[i].Vector = glm::aligned_vec2(static_cast<float>(i), 1.0f);
+	}
+
+	for(std::size_t i = 0; i < Pairs.size(); ++i)
+	{
+		glm::aligned_vec4 const Read(Pairs[i].Vector.yxyx);
+		Error += Read == glm::aligned_vec4(1.0f, static_cast<float>(i), 1.0f, static_cast<float>(i)) ? 0 : 1;
+		Pairs[i].Vector.yx = glm::aligned_vec2(2.0f, 3.0f);
+		Error += Pairs[i].Vector == glm::aligned_vec2(3.0f, 2.0f) && Pairs[i].Pad == 0.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int perf_swizzle(std::size_t Count)
+{
+	std::vector<glm::vec4> A(Count, glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+	std::vector<glm::aligned_vec4> B(Count, glm::aligned_vec4(1.0f, 2.0f, 3.0f, 4.0f));
+	glm::vec4 SumA(0.0f);
+	glm::aligned_vec4 SumB(0.0f);
+
+	std::clock_t const StartPacked = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i].zyx = glm::vec3(A[i].wzx) + glm::vec3(A[i].yyw);
+		SumA += glm::vec4(A[i].wzyx);
+	}
+	std::clock_t const EndPacked = std::clock();
+
+	std::clock_t const StartAligned = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		B[i].zyx = glm::aligned_vec3(B[i].wzx) + glm::aligned_vec3(B[i].yyw);
+		SumB += glm::aligned_vec4(B[i].wzyx);
+	}
+	std::clock_t const EndAligned = std::clock();
+
+	std::printf("swizzle packed: %d clocks\n", static_cast<int>(EndPacked - StartPacked));
+	std::printf("swizzle aligned: %d clocks\n", static_cast<int>(EndAligned - StartAligned));
+
+	return glm::all(glm::equal(SumA, glm::vec4(SumB))) ? 0 : 1;
+}
+#endif//GLM_HAS_UNRESTRICTED_UNIONS
+
 int main()
 {
 	int Error = 0;
@@ -71,6 +202,23 @@ int main()
 
 	Error += test_vec4_swizzle();
 
+#	if GLM_HAS_UNRESTRICTED_UNIONS
+		Error += test_swizzle_read<float, glm::highp>();
+		Error += test_swizzle_read<float, glm::aligned_highp>();
+		Error += test_swizzle_read<int, glm::aligned_highp>();
+		Error += test_swizzle_read<double, glm::aligned_highp>();
+		Error += test_swizzle_write<float, glm::highp>();
+		Error += test_swizzle_write<float, glm::aligned_highp>();
+		Error += test_swizzle_write<int, glm::aligned_highp>();
+		Error += test_swizzle_write<glm::uint, glm::aligned_highp>();
+		Error += test_swizzle_write<double, glm::aligned_highp>();
+		Error += test_swizzle_bounds();
+
+#		ifdef NDEBUG
+			Error += perf_swizzle(1 << 20);
+#		endif//NDEBUG
+#	endif//GLM_HAS_UNRESTRICTED_UNIONS
+
 	return Error;
 }
 
@@ -1,10 +1,118 @@
 #include <glm/trigonometric.hpp>
+#include <glm/common.hpp>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+// Approximations selected by mediump and lowp float vectors, see core_func_trigonometric
+namespace precision_tier
+{
+	template <glm::precision P>
+	static int test(double Bound, double SinRelativeBound)
+	{
+		typedef glm::tvec4<float, P> vec4;
+
+		double SinCos = 0, Tan = 0, SinRelative = 0;
+		for(int i = 0; i < 8192; ++i)
+		{
+			float const x = -1000.0f + 2000.0f * static_cast<float>(i) / 8192.0f;
+			vec4 const X(x, x * 0.01f, -x * 0.001f, x * 10.0f);
+
+			vec4 const Sin = glm::sin(X);
+			vec4 const Cos = glm::cos(X);
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				SinCos = glm::max(SinCos, std::fabs(Sin[j] - std::sin(static_cast<double>(X[j]))));
+				SinCos = glm::max(SinCos, std::fabs(Cos[j] - std::cos(static_cast<double>(X[j]))));
+			}
+
+			// tan is the ratio of the approximations, away from its poles
+			vec4 const TanResult = glm::tan(vec4(x * 0.001f));
+			Tan = glm::max(Tan, std::fabs(TanResult.x - std::tan(static_cast<double>(x * 0.001f))));
+		}
+
+		// sin is approximated with a relative error in [-pi/2, pi/2], down to the smallest arguments
+		for(int i = -4096; i <= 4096; ++i)
+		{
+			float const x = 1.57079632f * static_cast<float>(i) / 4096.0f;
+			vec4 const X(x, x * 1e-3f, x * 1e-20f, x * 1e-35f);
+			vec4 const Sin = glm::sin(X);
+			for(glm::length_t j = 0; j < 4; ++j)
+				if(X[j] != 0.0f)
+					SinRelative = glm::max(SinRelative, std::fabs(Sin[j] / std::sin(static_cast<double>(X[j])) - 1.0));
+		}
+
+		int Error = 0;
+
+		Error += SinCos < Bound ? 0 : 1;
+		Error += Tan < Bound * 4.0 ? 0 : 1;
+		Error += SinRelative < SinRelativeBound ? 0 : 1;
+		Error += glm::sin(vec4(0.0f)).x == 0.0f ? 0 : 1;
+		Error += glm::tan(vec4(0.0f)).x == 0.0f ? 0 : 1;
+
+		// Arguments outside of the range of the reduction use the highp functions
+		Error += std::fabs(glm::cos(vec4(1e6f)).x - std::cos(1e6f)) < 1e-6f ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test<glm::highp>(1e-6, 1e-6);
+		Error += test<glm::mediump>(1e-5, 2e-6);
+		Error += test<glm::lowp>(1e-3, 2e-4);
+		Error += test<glm::aligned_highp>(1e-6, 1e-6);
+		Error += test<glm::aligned_mediump>(1e-5, 2e-6);
+		Error += test<glm::aligned_lowp>(1e-3, 2e-4);
+
+		return Error;
+	}
+
+	template <glm::precision P>
+	static int perf(char const * Name)
+	{
+		typedef glm::tvec4<float, P> vec4;
+
+		std::vector<vec4> Data(4096);
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Data[i] = vec4(static_cast<float>(i) * 0.01f);
+
+		vec4 Sum(0);
+		std::clock_t const Time0 = std::clock();
+		for(int j = 0; j < 100; ++j)
+		for(std::size_t i = 0; i < Data.size(); ++i)
+			Sum += glm::sin(Data[i]) + glm::cos(Data[i]);
+		std::clock_t const Time1 = std::clock();
+
+		std::printf("%s sin + cos: %d clocks\n", Name, static_cast<int>(Time1 - Time0));
+
+		return Sum.x == Sum.x ? 0 : 1;
+	}
+
+	static int perf()
+	{
+		int Error = 0;
+
+		Error += perf<glm::highp>("highp");
+		Error += perf<glm::mediump>("mediump");
+		Error += perf<glm::lowp>("lowp");
+		Error += perf<glm::aligned_highp>("aligned_highp");
+		Error += perf<glm::aligned_mediump>("aligned_mediump");
+		Error += perf<glm::aligned_lowp>("aligned_lowp");
+
+		return Error;
+	}
+}//namespace precision_tier
 
 int main()
 {
 	int Error = 0;
 
+	Error += precision_tier::test();
+	Error += precision_tier::perf();
 
 	return Error;
 }
-
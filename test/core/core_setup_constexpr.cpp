@@ -0,0 +1,195 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/type_aligned.hpp>
+
+#if GLM_HAS_RELAXED_CONSTEXPR && !GLM_PROFILING
+
+static int test_arithmetic()
+{
+	int Error = 0;
+
+	constexpr glm::vec4 A(1, 2, 3, 4);
+	constexpr glm::vec4 B = A * 2.0f + glm::vec4(1) - A / 2.0f;
+	GLM_STATIC_ASSERT(B.x == 2.5f && B.w == 7.0f, "GLM: constexpr vec4 arithmetic failed");
+
+	constexpr glm::ivec3 C = (glm::ivec3(1, 2, 3) << 2) % 5;
+	GLM_STATIC_ASSERT(C.x == 4 && C.y == 3 && C.z == 2, "GLM: constexpr ivec3 arithmetic failed");
+
+	constexpr glm::mat4 M = glm::mat4(2.0f) * glm::mat4(1.0f);
+	constexpr glm::vec4 D = M * A;
+	GLM_STATIC_ASSERT(D == glm::vec4(2, 4, 6, 8), "GLM: constexpr mat4 product failed");
+
+	constexpr glm::mat3 N = glm::transpose(glm::mat3(glm::vec3(1, 2, 3), glm::vec3(4, 5, 6), glm::vec3(7, 8, 9)));
+	GLM_STATIC_ASSERT(N[0].y == 4.0f && N[2].x == 3.0f, "GLM: constexpr mat3 transpose failed");
+
+	constexpr glm::dmat3 Inverse = glm::inverse(glm::dmat3(glm::dvec3(2, 0, 0), glm::dvec3(0, 4, 0), glm::dvec3(1, 0, 1)));
+	GLM_STATIC_ASSERT(Inverse[0].x == 0.5 && Inverse[1].y == 0.25 && Inverse[2].x == -0.5, "GLM: constexpr dmat3 inverse failed");
+	GLM_STATIC_ASSERT(glm::determinant(glm::dmat3(2.0)) == 8.0, "GLM: constexpr dmat3 determinant failed");
+
+	constexpr glm::vec3 Cross = glm::cross(glm::vec3(1, 0, 0), glm::vec3(0, 1, 0));
+	GLM_STATIC_ASSERT(Cross == glm::vec3(0, 0, 1), "GLM: constexpr cross failed");
+
+	constexpr float Dot = glm::dot(glm::vec3(1), glm::vec3(2));
+	GLM_STATIC_ASSERT(Dot == 6.0f, "GLM: constexpr dot failed");
+
+	constexpr glm::mat4 Translate = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3));
+	constexpr glm::mat4 Scale = glm::scale(glm::mat4(1.0f), glm::vec3(2));
+	constexpr glm::mat4 Ortho = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+	GLM_STATIC_ASSERT(Translate[3] == glm::vec4(1, 2, 3, 1), "GLM: constexpr translate failed");
+	GLM_STATIC_ASSERT(Scale[1].y == 2.0f, "GLM: constexpr scale failed");
+
+	Error += Translate == glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)) ? 0 : 1;
+	Error += Ortho == glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f) ? 0 : 1;
+
+	return Error;
+}
+
+#if GLM_CONSTANT_EVALUATION
+
+template <std::size_t Size>
+struct sin_table
+{
+	constexpr sin_table() :
+		Data()
+	{
+		for(std::size_t i = 0; i < Size; ++i)
+			Data[i] = glm::sin(glm::vec2(static_cast<float>(i) / static_cast<float>(Size) * glm::two_pi<float>(), static_cast<float>(i)));
+	}
+
+	glm::vec2 Data[Size];
+};
+
+static int test_transcendental()
+{
+	int Error = 0;
+
+	constexpr double Sqrt = glm::detail::sqrt_constexpr(2.0);
+	GLM_STATIC_ASSERT(Sqrt == 1.4142135623730951, "GLM: constexpr sqrt is not correctly rounded");
+
+	constexpr sin_table<256> Table;
+	for(std::size_t i = 0; i < 256; ++i)
+	{
+		glm::vec2 const Angle(static_cast<float>(i) / 256.0f * glm::two_pi<float>(), static_cast<float>(i));
+		Error += glm::all(glm::epsilonEqual(Table.Data[i], glm::sin(Angle), 0.000001f)) ? 0 : 1;
+	}
+
+	for(int i = -200; i <= 200; ++i)
+	{
+		double const x = static_cast<double>(i) * 0.5;
+		Error += glm::epsilonEqual(glm::detail::cos_constexpr(x), glm::cos(x), 0.0000000001) ? 0 : 1;
+	}
+
+	constexpr glm::vec3 Sqrt3 = glm::sqrt(glm::vec3(1, 4, 9));
+	GLM_STATIC_ASSERT(Sqrt3 == glm::vec3(1, 2, 3), "GLM: constexpr vec3 sqrt failed");
+
+	constexpr glm::vec3 Normalize = glm::normalize(glm::vec3(3, 0, 4));
+	Error += glm::all(glm::epsilonEqual(Normalize, glm::vec3(0.6f, 0.0f, 0.8f), 0.000001f)) ? 0 : 1;
+
+	constexpr float Length = glm::length(glm::vec4(1)) + glm::distance(glm::vec2(0), glm::vec2(3, 4));
+	GLM_STATIC_ASSERT(Length == 7.0f, "GLM: constexpr length failed");
+
+	return Error;
+}
+
+// The float mat4 functions and the aligned vec4 operators have SIMD specializations, evaluated with the generic code in constant expressions
+static int test_simd()
+{
+	int Error = 0;
+
+	constexpr glm::mat4 M(
+		glm::vec4(2, 0, 0, 0),
+		glm::vec4(0, 4, 0, 0),
+		glm::vec4(0, 0, 1, 0),
+		glm::vec4(1, 2, 3, 1));
+
+	constexpr glm::mat4 Transpose = glm::transpose(M);
+	GLM_STATIC_ASSERT(Transpose[0] == glm::vec4(2, 0, 0, 1) && Transpose[3] == glm::vec4(0, 0, 0, 1), "GLM: constexpr mat4 transpose failed");
+
+	constexpr float Determinant = glm::determinant(M);
+	GLM_STATIC_ASSERT(Determinant == 8.0f, "GLM: constexpr mat4 determinant failed");
+
+	constexpr glm::mat4 Inverse = glm::inverse(M);
+	GLM_STATIC_ASSERT(Inverse[0].x == 0.5f && Inverse[1].y == 0.25f && Inverse[3] == glm::vec4(-0.5f, -0.5f, -3.0f, 1.0f), "GLM: constexpr mat4 inverse failed");
+
+	glm::mat4 const MRuntime(M);
+	Error += Transpose == glm::transpose(MRuntime) ? 0 : 1;
+	Error += glm::epsilonEqual(Determinant, glm::determinant(MRuntime), 0.00001f) ? 0 : 1;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(Inverse[i], glm::inverse(MRuntime)[i], 0.00001f)) ? 0 : 1;
+
+	// The aligned vec4 constructors from components are SIMD specializations, converting from vec4 uses the generic code
+	constexpr glm::aligned_vec4 A(glm::vec4(1, 2, 3, 4));
+	constexpr glm::aligned_vec4 B = (A + A) * A - A / glm::aligned_vec4(glm::vec4(2));
+	GLM_STATIC_ASSERT(B == glm::aligned_vec4(glm::vec4(1.5f, 7.0f, 16.5f, 30.0f)), "GLM: constexpr aligned_vec4 arithmetic failed");
+	GLM_STATIC_ASSERT(B != A, "GLM: constexpr aligned_vec4 comparison failed");
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	glm::vec3 const Eye(1, 2, 3);
+	glm::vec3 const Center(0, 0, 0);
+	glm::vec3 const Up(0, 1, 0);
+
+	constexpr glm::mat4 Projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+	constexpr glm::mat4 View = glm::lookAt(glm::vec3(1, 2, 3), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	constexpr glm::mat4 Rotate = glm::rotate(glm::mat4(1.0f), 0.5f, glm::vec3(1, 1, 0));
+
+	glm::mat4 const ProjectionRuntime = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+	glm::mat4 const ViewRuntime = glm::lookAt(Eye, Center, Up);
+	glm::mat4 const RotateRuntime = glm::rotate(glm::mat4(1.0f), 0.5f, glm::vec3(1, 1, 0));
+
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		Error += glm::all(glm::epsilonEqual(Projection[i], ProjectionRuntime[i], 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(View[i], ViewRuntime[i], 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Rotate[i], RotateRuntime[i], 0.00001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_quat()
+{
+	int Error = 0;
+
+	constexpr glm::quat Q = glm::normalize(glm::angleAxis(1.0f, glm::vec3(0, 0, 1)) * glm::angleAxis(0.5f, glm::vec3(1, 0, 0)));
+	constexpr glm::mat4 M = glm::mat4_cast(Q);
+	constexpr glm::quat R = glm::quat_cast(M);
+
+	glm::quat const QRuntime = glm::normalize(glm::angleAxis(1.0f, glm::vec3(0, 0, 1)) * glm::angleAxis(0.5f, glm::vec3(1, 0, 0)));
+	glm::mat4 const MRuntime = glm::mat4_cast(QRuntime);
+
+	Error += glm::all(glm::epsilonEqual(Q, QRuntime, 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(R, QRuntime, 0.00001f)) ? 0 : 1;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(M[i], MRuntime[i], 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+#endif//GLM_CONSTANT_EVALUATION
+#endif//GLM_HAS_RELAXED_CONSTEXPR && !GLM_PROFILING
+
+int main()
+{
+	int Error = 0;
+
+#	if GLM_HAS_RELAXED_CONSTEXPR && !GLM_PROFILING
+		Error += test_arithmetic();
+#		if GLM_CONSTANT_EVALUATION
+			Error += test_transcendental();
+			Error += test_simd();
+			Error += test_transform();
+			Error += test_quat();
+#		endif//GLM_CONSTANT_EVALUATION
+#	endif//GLM_HAS_RELAXED_CONSTEXPR && !GLM_PROFILING
+
+	return Error;
+}
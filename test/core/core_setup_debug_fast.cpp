@@ -0,0 +1,116 @@
+// The test-core_setup_debug_fast tests are compiled at -O0 with and without GLM_FORCE_DEBUG_FAST,
+// they print the clocks of the same workload as a debug build throughput benchmark.
+#ifndef GLM_TEST_REFERENCE
+#	define GLM_FORCE_DEBUG_FAST
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+template <typename vecType>
+static int test_operators()
+{
+	int Error = 0;
+
+	typedef typename vecType::value_type T;
+
+	vecType const a(T(6));
+	vecType const b(T(2));
+
+	Error += a + b == vecType(T(8)) ? 0 : 1;
+	Error += a - b == vecType(T(4)) ? 0 : 1;
+	Error += a * b == vecType(T(12)) ? 0 : 1;
+	Error += a / b == vecType(T(3)) ? 0 : 1;
+	Error += a + T(1) == vecType(T(7)) && T(1) + a == vecType(T(7)) ? 0 : 1;
+	Error += a - T(1) == vecType(T(5)) && T(1) - a == vecType(T(-5)) ? 0 : 1;
+	Error += a * T(3) == vecType(T(18)) && T(3) * a == vecType(T(18)) ? 0 : 1;
+	Error += a / T(3) == vecType(T(2)) && T(12) / a == vecType(T(2)) ? 0 : 1;
+	Error += -a == vecType(T(-6)) ? 0 : 1;
+
+	vecType c(a);
+	c += b;
+	Error += c == vecType(T(8)) ? 0 : 1;
+	c -= T(2);
+	Error += c == vecType(T(6)) ? 0 : 1;
+	c *= b;
+	Error += c == vecType(T(12)) ? 0 : 1;
+	c /= T(4);
+	Error += c == vecType(T(3)) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::precision P>
+static int test_mat4()
+{
+	int Error = 0;
+
+	glm::tmat4x4<T, P> const m(
+		glm::tvec4<T, P>(1, 2, 3, 4),
+		glm::tvec4<T, P>(5, 6, 7, 8),
+		glm::tvec4<T, P>(9, 10, 11, 12),
+		glm::tvec4<T, P>(13, 14, 15, 16));
+	glm::tvec4<T, P> const v(1, 0, 2, 1);
+
+	Error += m * v == glm::tvec4<T, P>(32, 36, 40, 44) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename vec4, typename mat4>
+static int perf_debug(char const * Name, std::size_t Count, std::size_t Loops)
+{
+	std::vector<vec4> a(Count, vec4(1.0f, 2.0f, 3.0f, 4.0f));
+	std::vector<vec4> b(Count, vec4(0.5f));
+	mat4 const m(2.0f);
+	vec4 Sum(0.0f);
+	float Length = 0.0f;
+
+	std::clock_t const StartArithmetic = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Sum += a[i] * 0.5f + b[i] * 2.0f - a[i];
+	std::clock_t const EndArithmetic = std::clock();
+
+	std::clock_t const StartMatrix = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Sum += m * a[i];
+	std::clock_t const EndMatrix = std::clock();
+
+	std::clock_t const StartGeometric = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Length += glm::dot(glm::normalize(a[i]), b[i]) + glm::length(glm::vec3(a[i]) - glm::vec3(b[i]));
+	std::clock_t const EndGeometric = std::clock();
+
+	std::printf("%s arithmetic: %d clocks, matrix: %d clocks, geometric: %d clocks\n", Name,
+		static_cast<int>(EndArithmetic - StartArithmetic),
+		static_cast<int>(EndMatrix - StartMatrix),
+		static_cast<int>(EndGeometric - StartGeometric));
+
+	return Sum.x > 0.0f && Length > 0.0f ? 0 : 1;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_operators<glm::vec2>();
+	Error += test_operators<glm::vec3>();
+	Error += test_operators<glm::vec4>();
+	Error += test_operators<glm::ivec2>();
+	Error += test_operators<glm::ivec3>();
+	Error += test_operators<glm::ivec4>();
+	Error += test_operators<glm::aligned_vec4>();
+	Error += test_mat4<float, glm::highp>();
+	Error += test_mat4<int, glm::highp>();
+	Error += test_mat4<float, glm::aligned_highp>();
+
+	Error += perf_debug<glm::vec4, glm::mat4>("vec4", 1 << 12, 1 << 5);
+	Error += perf_debug<glm::aligned_vec4, glm::tmat4x4<float, glm::aligned_highp> >("aligned_vec4", 1 << 12, 1 << 5);
+
+	return Error;
+}
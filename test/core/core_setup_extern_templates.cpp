@@ -0,0 +1,86 @@
+// The build-core_setup_extern_templates tests compile this file with and without extern templates,
+// ctest reports their durations as a build time benchmark.
+#ifndef GLM_TEST_HEADER_ONLY
+#	define GLM_FORCE_EXTERN_TEMPLATES
+#endif
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/constants.hpp>
+
+template <typename T>
+static int test_vec()
+{
+	int Error = 0;
+
+	glm::tvec2<T> const a2(1, 2), b2(3, 4);
+	glm::tvec3<T> const a3(1, 2, 3), b3(4, 5, 6);
+	glm::tvec4<T> const a4(1, 2, 3, 4), b4(5, 6, 9, 8);
+
+	Error += a2 + b2 == glm::tvec2<T>(4, 6) ? 0 : 1;
+	Error += b3 - a3 == glm::tvec3<T>(3) ? 0 : 1;
+	Error += a4 * b4 == glm::tvec4<T>(5, 12, 27, 32) ? 0 : 1;
+	Error += b4 / a4 == glm::tvec4<T>(5, 3, 3, 2) ? 0 : 1;
+	Error += -a3 * T(2) == glm::tvec3<T>(-2, -4, -6) ? 0 : 1;
+	Error += T(2) * a2 - T(1) != a2 ? 0 : 1;
+	Error += glm::abs(-a4) == a4 ? 0 : 1;
+	Error += glm::min(a3, b3) == a3 && glm::max(a3, b3) == b3 ? 0 : 1;
+	Error += glm::clamp(b4, a4, a4 + T(1)) == a4 + T(1) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+static int test_float()
+{
+	int Error = 0;
+
+	glm::tvec3<T> const x(1, 0, 0), y(0, 1, 0), z(0, 0, 1);
+
+	Error += glm::cross(x, y) == z ? 0 : 1;
+	Error += glm::epsilonEqual(glm::dot(x + y, y + z), T(1), glm::epsilon<T>()) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::length(glm::tvec4<T>(1, 1, 1, 1)), T(2), glm::epsilon<T>()) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::distance(glm::tvec2<T>(0), glm::tvec2<T>(3, 4)), T(5), glm::epsilon<T>()) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(glm::normalize(x * T(3)), x, glm::epsilon<T>())) ? 0 : 1;
+	Error += glm::mix(x, y, T(0.5)) == glm::tvec3<T>(0.5, 0.5, 0) ? 0 : 1;
+	Error += glm::floor(glm::tvec2<T>(1.5, -1.5)) == glm::tvec2<T>(1, -2) ? 0 : 1;
+
+	glm::tmat4x4<T> const Model = glm::scale(glm::rotate(glm::translate(glm::tmat4x4<T>(1), z), glm::half_pi<T>(), z), glm::tvec3<T>(2));
+	glm::tvec4<T> const Point = Model * glm::tvec4<T>(x, 1);
+	Error += glm::all(glm::epsilonEqual(Point, glm::tvec4<T>(0, 2, 1, 1), static_cast<T>(0.0001))) ? 0 : 1;
+
+	glm::tmat4x4<T> const Identity = glm::inverse(Model) * Model;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(Identity[i], glm::tmat4x4<T>(1)[i], static_cast<T>(0.0001))) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::determinant(Model), T(8), static_cast<T>(0.0001)) ? 0 : 1;
+	Error += glm::transpose(glm::transpose(Model)) == Model ? 0 : 1;
+
+	glm::tmat3x3<T> const M3(Model);
+	Error += glm::all(glm::epsilonEqual(M3 * glm::inverse(M3) * x, x, static_cast<T>(0.0001))) ? 0 : 1;
+	glm::tmat2x2<T> const M2(2, 1, 1, 1);
+	Error += glm::inverse(M2) * M2 == glm::tmat2x2<T>(1) ? 0 : 1;
+
+	glm::tquat<T> const Rotation = glm::angleAxis(glm::half_pi<T>(), z);
+	Error += glm::all(glm::epsilonEqual(Rotation * x, y, static_cast<T>(0.0001))) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(glm::mat4_cast(Rotation) * glm::tvec4<T>(x, 0), glm::tvec4<T>(y, 0), static_cast<T>(0.0001))) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(glm::inverse(Rotation) * y, x, static_cast<T>(0.0001))) ? 0 : 1;
+
+	glm::tmat4x4<T> const Projection = glm::perspective(glm::half_pi<T>(), T(1), T(1), T(100)) * glm::lookAt(z, glm::tvec3<T>(0), y);
+	Error += glm::epsilonEqual(Projection[3][3], T(1), static_cast<T>(0.0001)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_vec<float>();
+	Error += test_vec<double>();
+	Error += test_vec<int>();
+	Error += test_float<float>();
+	Error += test_float<double>();
+
+	return Error;
+}
@@ -46,6 +46,30 @@ static int test_dvec()
 	return Error;
 }
 
+static int test_qualifier()
+{
+	int Error = 0;
+
+	Error += glm::aligned_highp != glm::mediump ? 0 : 1;
+	Error += glm::aligned_mediump != glm::lowp ? 0 : 1;
+	Error += glm::aligned_lowp != glm::highp ? 0 : 1;
+
+	Error += !glm::detail::is_aligned<glm::mediump>::value ? 0 : 1;
+	Error += !glm::detail::is_aligned<glm::lowp>::value ? 0 : 1;
+	Error += glm::detail::is_aligned<glm::aligned_highp>::value ? 0 : 1;
+	Error += glm::detail::is_aligned<glm::aligned_mediump>::value ? 0 : 1;
+	Error += glm::detail::is_aligned<glm::aligned_lowp>::value ? 0 : 1;
+
+	Error += glm::detail::precision_tier<glm::highp>::value == glm::highp ? 0 : 1;
+	Error += glm::detail::precision_tier<glm::aligned_highp>::value == glm::highp ? 0 : 1;
+	Error += glm::detail::precision_tier<glm::mediump>::value == glm::mediump ? 0 : 1;
+	Error += glm::detail::precision_tier<glm::aligned_mediump>::value == glm::mediump ? 0 : 1;
+	Error += glm::detail::precision_tier<glm::lowp>::value == glm::lowp ? 0 : 1;
+	Error += glm::detail::precision_tier<glm::aligned_lowp>::value == glm::lowp ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -53,6 +77,7 @@ int main()
 	Error += test_mat();
 	Error += test_vec();
 	Error += test_dvec();
+	Error += test_qualifier();
 	
 	return Error;
 }
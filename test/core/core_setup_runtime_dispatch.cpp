@@ -0,0 +1,140 @@
+#define GLM_FORCE_RUNTIME_DISPATCH
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/frustum.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#if GLM_HAS_CXX11_STL
+#	include <glm/gtx/hash.hpp>
+#endif
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+static int test_cpu_arch()
+{
+	int Error = 0;
+
+	// The running CPU supports at least the instruction sets GLM is compiled for
+	int const Arch = glm_cpu_arch();
+	Error += (Arch & GLM_ARCH) == GLM_ARCH ? 0 : 1;
+	Error += Arch == glm_cpu_arch_detect() ? 0 : 1;
+
+	// Levels are cumulative
+	if(Arch & GLM_ARCH_AVX512_BIT)
+		Error += (Arch & GLM_ARCH_AVX512) == GLM_ARCH_AVX512 ? 0 : 1;
+	if(Arch & GLM_ARCH_AVX2_BIT)
+		Error += (Arch & GLM_ARCH_AVX2) == GLM_ARCH_AVX2 ? 0 : 1;
+	if(Arch & GLM_ARCH_AVX_BIT)
+		Error += (Arch & GLM_ARCH_AVX) == GLM_ARCH_AVX ? 0 : 1;
+
+	return Error;
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+static int test_frustum()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(glm::perspective(1.0f, 1.5f, 0.1f, 50.0f) * glm::lookAt(glm::vec3(3, 2, 10), glm::vec3(0), glm::vec3(0, 1, 0)), Planes);
+
+	std::size_t const Count = 1003;
+	std::vector<glm::vec4> Spheres(Count);
+	std::vector<glm::vec3> Min(Count), Max(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-60), glm::vec3(60));
+		glm::vec3 const Extent = glm::linearRand(glm::vec3(0), glm::vec3(5));
+		Spheres[i] = glm::vec4(Center, glm::length(Extent));
+		Min[i] = Center - Extent;
+		Max[i] = Center + Extent;
+	}
+
+	std::size_t const Words = (Count + 31) / 32;
+	std::vector<glm::uint32> Dispatched(Words), Expected(Words);
+
+	glm::frustumCullSpheres(Planes, &Spheres[0], Count, &Dispatched[0]);
+	glm::detail::frustum_cull_spheres_sse(Planes, &Spheres[0], Count, &Expected[0]);
+	Error += Dispatched == Expected ? 0 : 1;
+
+	glm::frustumCullAABBs(Planes, &Min[0], &Max[0], Count, &Dispatched[0]);
+	glm::detail::frustum_cull_aabbs_sse(Planes, &Min[0], &Max[0], Count, &Expected[0]);
+	Error += Dispatched == Expected ? 0 : 1;
+
+#	if GLM_HAS_RUNTIME_DISPATCH
+		if(glm_cpu_arch() & GLM_ARCH_AVX2_BIT)
+		{
+			// Called through a pointer like the dispatcher, the AVX2 kernel may not be inlined in SSE2 code
+			glm::detail::compute_frustumCullSpheres<float, glm::defaultp>::kernel const Kernel = &glm::detail::frustum_cull_spheres_avx<glm::defaultp>;
+			std::vector<glm::uint32> Avx(Words);
+			Kernel(Planes, &Spheres[0], Count, &Avx[0]);
+			glm::frustumCullSpheres(Planes, &Spheres[0], Count, &Expected[0]);
+			Error += Avx == Expected ? 0 : 1;
+		}
+#	endif
+
+	return Error;
+}
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_HAS_CXX11_STL
+static int test_hash()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1001;
+	std::vector<glm::vec3> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = glm::linearRand(glm::vec3(-1), glm::vec3(1));
+
+	std::vector<glm::uint64> Hashes(Count);
+	glm::hashBlock(&Values[0], Count, &Hashes[0], 7);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Hashes[i] == glm::hashBlock(Values[i], 7) ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_CXX11_STL
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+static int perf()
+{
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(glm::perspective(1.0f, 1.5f, 0.1f, 50.0f), Planes);
+
+	std::size_t const Count = 1 << 16;
+	std::vector<glm::vec4> Spheres(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Spheres[i] = glm::vec4(glm::linearRand(glm::vec3(-60), glm::vec3(60)), 1.0f);
+	std::vector<glm::uint32> Visibility((Count + 31) / 32);
+
+	std::clock_t const StartSse = std::clock();
+	for(int i = 0; i < 100; ++i)
+		glm::detail::frustum_cull_spheres_sse(Planes, &Spheres[0], Count, &Visibility[0]);
+	std::clock_t const EndSse = std::clock();
+	for(int i = 0; i < 100; ++i)
+		glm::frustumCullSpheres(Planes, &Spheres[0], Count, &Visibility[0]);
+	std::clock_t const EndDispatch = std::clock();
+
+	std::printf("frustumCullSpheres: SSE %d clocks, dispatched %d clocks, CPU arch 0x%x\n",
+		static_cast<int>(EndSse - StartSse), static_cast<int>(EndDispatch - EndSse), glm_cpu_arch());
+
+	return 0;
+}
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_cpu_arch();
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		Error += test_frustum();
+		Error += perf();
+#	endif
+#	if GLM_HAS_CXX11_STL
+		Error += test_hash();
+#	endif
+
+	return Error;
+}
@@ -1,4 +1,5 @@
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <glm/matrix.hpp>
 #include <glm/vector_relational.hpp>
 #include <glm/mat2x2.hpp>
@@ -132,6 +133,33 @@ namespace cast
 	}
 }//namespace cast
 
+static int test_aligned()
+{
+	typedef glm::tvec2<double, glm::aligned_highp> dvec2a;
+	typedef glm::tmat2x2<double, glm::aligned_highp> dmat2a;
+
+	int Error(0);
+
+	glm::dmat2 const M(0.6, 0.2, 0.3, 0.7);
+	glm::dmat2 const N(1.5, -2.0, 0.25, 3.0);
+	glm::dvec2 const V(1.0, -2.0);
+
+	dmat2a const A = dmat2a(M) * dmat2a(N);
+	dvec2a const B = dmat2a(M) * dvec2a(V);
+	dmat2a const C = glm::inverse(dmat2a(M));
+	dmat2a const D = dmat2a(M) * C;
+
+	glm::dmat2 const P = M * N;
+	for(glm::length_t i = 0; i < 2; ++i)
+	{
+		Error += glm::all(glm::epsilonEqual(glm::dvec2(A[i]), P[i], 1e-12)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::dvec2(D[i]), glm::dmat2(1.0)[i], 1e-12)) ? 0 : 1;
+	}
+	Error += glm::all(glm::epsilonEqual(glm::dvec2(B), M * V, 1e-12)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
@@ -140,6 +168,7 @@ int main()
 	Error += test_ctr();
 	Error += test_operators();
 	Error += test_inverse();
+	Error += test_aligned();
 
 	return Error;
 }
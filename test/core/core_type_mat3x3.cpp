@@ -1,4 +1,5 @@
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <glm/matrix.hpp>
 #include <glm/vector_relational.hpp>
 #include <glm/mat2x2.hpp>
@@ -56,6 +57,25 @@ static int test_operators()
 	return (S && !R) ? 0 : 1;
 }
 
+static int test_mul_vec3_aligned()
+{
+	typedef glm::tvec3<float, glm::aligned_highp> vec3a;
+	typedef glm::tmat3x3<float, glm::aligned_highp> mat3a;
+
+	int Error(0);
+
+	glm::mat3 const M(
+		glm::vec3(0.6f, 0.2f, 0.3f),
+		glm::vec3(0.2f, 0.7f, 0.5f),
+		glm::vec3(0.3f, 0.5f, 0.7f));
+	glm::vec3 const V(1.0f, -2.0f, 3.0f);
+
+	vec3a const A = mat3a(M) * vec3a(V);
+	Error += glm::all(glm::epsilonEqual(glm::vec3(A), M * V, 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int test_inverse()
 {
 	int Error(0);
@@ -177,6 +197,7 @@ int main()
 	Error += test_ctr();
 	Error += test_mat3x3();
 	Error += test_operators();
+	Error += test_mul_vec3_aligned();
 	Error += test_inverse();
 
 	return Error;
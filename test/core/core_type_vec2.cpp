@@ -1,6 +1,10 @@
 #define GLM_SWIZZLE
 #include <glm/vector_relational.hpp>
 #include <glm/vec2.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <vector>
 #if GLM_HAS_TRIVIAL_QUERIES
 #	include <type_traits>
@@ -252,6 +256,19 @@ int test_vec2_ctor()
 		glm::vec2 F(glm::ivec2(2));
 	}
 
+#	if GLM_HAS_CONSTEXPR
+	{
+		// The packed constructors stay constexpr when the aligned double vec2 uses SIMD
+		constexpr glm::dvec2 A(1, 2);
+		constexpr glm::dvec2 B(1);
+		constexpr glm::vec2 C(1, 2);
+
+		static_assert(A.y == 2.0, "GLM: dvec2 constexpr component constructor");
+		static_assert(B.x == 1.0, "GLM: dvec2 constexpr scalar constructor");
+		static_assert(C.y == 2.0f, "GLM: vec2 constexpr component constructor");
+	}
+#	endif//GLM_HAS_CONSTEXPR
+
 	return Error;
 }
 
@@ -296,6 +313,44 @@ int test_operator_increment()
 	return Error;
 }
 
+int test_vec2_aligned()
+{
+	int Error = 0;
+
+	typedef glm::tvec2<double, glm::aligned_highp> dvec2a;
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+		Error += sizeof(dvec2a) == 16 ? 0 : 1;
+#	endif
+
+	dvec2a const A(1.5, -2.25);
+	dvec2a const B(0.5, 4.0);
+
+	Error += glm::all(glm::equal(glm::dvec2(A + B), glm::dvec2(2.0, 1.75))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(A - B), glm::dvec2(1.0, -6.25))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(A * B), glm::dvec2(0.75, -9.0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(A / B), glm::dvec2(3.0, -0.5625))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(1.0 - A), glm::dvec2(-0.5, 3.25))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(-A), glm::dvec2(-1.5, 2.25))) ? 0 : 1;
+
+	Error += glm::dot(A, B) == -8.25 ? 0 : 1;
+	Error += glm::length(dvec2a(3.0, -4.0)) == 5.0 ? 0 : 1;
+	Error += glm::distance(dvec2a(1.0, 1.0), dvec2a(4.0, 5.0)) == 5.0 ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(glm::dvec2(glm::normalize(dvec2a(3.0, -4.0))), glm::dvec2(0.6, -0.8), 1e-15)) ? 0 : 1;
+
+	Error += glm::all(glm::equal(glm::dvec2(glm::min(A, B)), glm::dvec2(0.5, -2.25))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::max(A, B)), glm::dvec2(1.5, 4.0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::clamp(A, dvec2a(-1.0), dvec2a(1.0))), glm::dvec2(1.0, -1.0))) ? 0 : 1;
+
+	// Halfway cases and values beyond 2^52 which have no fractional part
+	Error += glm::all(glm::equal(glm::dvec2(glm::floor(A)), glm::dvec2(1.0, -3.0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::ceil(A)), glm::dvec2(2.0, -2.0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::floor(dvec2a(-0.5, 4503599627370497.0))), glm::dvec2(-1.0, 4503599627370497.0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dvec2(glm::ceil(dvec2a(-0.5, -4503599627370497.0))), glm::dvec2(0.0, -4503599627370497.0))) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -307,6 +362,7 @@ int main()
 	Error += test_vec2_ctor();
 	Error += test_vec2_operators();
 	Error += test_operator_increment();
+	Error += test_vec2_aligned();
 
 	return Error;
 }
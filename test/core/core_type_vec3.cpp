@@ -1,6 +1,8 @@
 #define GLM_SWIZZLE
 #include <glm/vector_relational.hpp>
 #include <glm/geometric.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
@@ -67,6 +69,19 @@ int test_vec3_ctor()
 		
 		Error += A == B ? 0 : 1;
 	}
+
+#	if GLM_HAS_CONSTEXPR
+	{
+		// The packed constructors stay constexpr when the aligned float vec3 uses SIMD
+		constexpr glm::vec3 A(1, 2, 3);
+		constexpr glm::vec3 B(1);
+		constexpr glm::ivec3 C(1, 2, 3);
+
+		static_assert(A.z == 3.0f, "GLM: vec3 constexpr component constructor");
+		static_assert(B.y == 1.0f, "GLM: vec3 constexpr scalar constructor");
+		static_assert(C.x == 1, "GLM: ivec3 constexpr component constructor");
+	}
+#	endif//GLM_HAS_CONSTEXPR
 	
 	{
 		std::vector<glm::vec3> Tests;
@@ -465,6 +480,39 @@ int test_operator_increment()
 	return Error;
 }
 
+int test_vec3_aligned()
+{
+	int Error(0);
+
+	typedef glm::tvec3<float, glm::aligned_highp> vec3a;
+	typedef glm::tvec3<float, glm::aligned_lowp> vec3l;
+
+#	if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && GLM_HAS_UNRESTRICTED_UNIONS
+		Error += sizeof(vec3a) == 16 ? 0 : 1;
+#	endif
+
+	vec3a const A(1.0f, 2.0f, 4.0f);
+	vec3a const B(2.0f, 4.0f, 8.0f);
+
+	Error += glm::all(glm::equal(glm::vec3(A + B), glm::vec3(3, 6, 12))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(B - A), glm::vec3(1, 2, 4))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(A * B), glm::vec3(2, 8, 32))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(B / A), glm::vec3(2))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(2.0f - A), glm::vec3(1, 0, -2))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(8.0f / A), glm::vec3(8, 4, 2))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec3(-A), glm::vec3(-1, -2, -4))) ? 0 : 1;
+
+	// The padding lane of the divisor is zero
+	vec3a C(3.0f, 6.0f, 12.0f);
+	C /= A;
+	Error += glm::all(glm::equal(glm::vec3(C), glm::vec3(3))) ? 0 : 1;
+
+	vec3l const L = vec3l(1.0f, 3.0f, 7.0f) / vec3l(2.0f);
+	Error += glm::all(glm::epsilonEqual(glm::vec3(L), glm::vec3(0.5f, 1.5f, 3.5f), 0.002f)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -481,6 +529,7 @@ int main()
 	Error += test_vec3_swizzle_operators();
 	Error += test_vec3_swizzle_functions();
 	Error += test_operator_increment();
+	Error += test_vec3_aligned();
 
 	return Error;
 }
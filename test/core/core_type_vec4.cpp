@@ -4,6 +4,7 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
+#include <glm/gtc/type_aligned.hpp>
 #include <cstdio>
 #include <ctime>
 #include <vector>
@@ -490,6 +491,54 @@ int test_vec4_simd()
 	return Error;
 }
 
+int test_ivec4_aligned()
+{
+	int Error = 0;
+
+	int const Values[] = {0, 1, -1, 7, -7, 13, -100, 65535, -65536, 2147483647, -2147483647};
+	std::size_t const Count = sizeof(Values) / sizeof(Values[0]);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	for(std::size_t j = 0; j < Count; ++j)
+	{
+		glm::ivec4 const A(Values[i], Values[j], Values[i] / 3, 5);
+		glm::ivec4 const B(Values[j] == 0 ? 3 : Values[j], Values[i] == 0 ? -2 : Values[i], 17, Values[i] == 0 ? 1 : Values[i]);
+
+		glm::aligned_ivec4 const AlignedA(A);
+		glm::aligned_ivec4 const AlignedB(B);
+
+		glm::ivec4 const Mul(AlignedA * AlignedB);
+		glm::ivec4 const Div(AlignedA / AlignedB);
+		glm::ivec4 const Mod(AlignedA % AlignedB);
+
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			Error += Mul[k] == static_cast<int>(static_cast<glm::uint>(A[k]) * static_cast<glm::uint>(B[k])) ? 0 : 1;
+			Error += Div[k] == A[k] / B[k] ? 0 : 1;
+			Error += Mod[k] == A[k] % B[k] ? 0 : 1;
+		}
+
+		glm::uvec4 const C(A);
+		glm::uvec4 const D(B);
+
+		glm::aligned_uvec4 const AlignedC(C);
+		glm::aligned_uvec4 const AlignedD(D);
+
+		glm::uvec4 const UMul(AlignedC * AlignedD);
+		glm::uvec4 const UDiv(AlignedC / AlignedD);
+		glm::uvec4 const UMod(AlignedC % AlignedD);
+
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			Error += UMul[k] == C[k] * D[k] ? 0 : 1;
+			Error += UDiv[k] == C[k] / D[k] ? 0 : 1;
+			Error += UMod[k] == C[k] % D[k] ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
@@ -551,6 +600,7 @@ int main()
 	Error += test_vec4_equal();
 	Error += test_vec4_swizzle_partial();
 	Error += test_vec4_simd();
+	Error += test_ivec4_aligned();
 	Error += test_operator_increment();
 	Error += heap::test();
 
@@ -623,6 +623,144 @@ namespace bitfieldInterleave
 	}
 }//namespace bitfieldInterleave
 
+namespace bitfieldDeinterleave
+{
+	inline glm::uint64 random64()
+	{
+		static glm::uint64 State = 0x853c49e6748fea9bull;
+		State = State * 6364136223846793005ull + 1442695040888963407ull;
+		return State ^ (State >> 29);
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		for(int i = 0; i < 10000; ++i)
+		{
+			glm::uint64 const Rand = random64();
+
+			{
+				glm::uint8 x, y;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint8(Rand), glm::uint8(Rand >> 8)), x, y);
+				Error += x == glm::uint8(Rand) && y == glm::uint8(Rand >> 8) ? 0 : 1;
+			}
+			{
+				glm::int16 x, y;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::int16(Rand), glm::int16(Rand >> 16)), x, y);
+				Error += x == glm::int16(Rand) && y == glm::int16(Rand >> 16) ? 0 : 1;
+			}
+			{
+				glm::uint32 x, y;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint32(Rand), glm::uint32(Rand >> 32)), x, y);
+				Error += x == glm::uint32(Rand) && y == glm::uint32(Rand >> 32) ? 0 : 1;
+			}
+			{
+				glm::int8 x, y, z;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::int8(Rand), glm::int8(Rand >> 8), glm::int8(Rand >> 16)), x, y, z);
+				Error += x == glm::int8(Rand) && y == glm::int8(Rand >> 8) && z == glm::int8(Rand >> 16) ? 0 : 1;
+			}
+			{
+				glm::uint16 x, y, z;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint16(Rand), glm::uint16(Rand >> 16), glm::uint16(Rand >> 32)), x, y, z);
+				Error += x == glm::uint16(Rand) && y == glm::uint16(Rand >> 16) && z == glm::uint16(Rand >> 32) ? 0 : 1;
+			}
+			{
+				// 22 bits of x and 21 bits of y and z fit in 64 bits
+				glm::uint32 const a = glm::uint32(Rand) & 0x3FFFFF;
+				glm::uint32 const b = glm::uint32(Rand >> 22) & 0x1FFFFF;
+				glm::uint32 const c = glm::uint32(Rand >> 43) & 0x1FFFFF;
+				glm::uint32 x, y, z;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(a, b, c), x, y, z);
+				Error += x == a && y == b && z == c ? 0 : 1;
+			}
+			{
+				glm::uint8 x, y, z, w;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint8(Rand), glm::uint8(Rand >> 8), glm::uint8(Rand >> 16), glm::uint8(Rand >> 24)), x, y, z, w);
+				Error += x == glm::uint8(Rand) && y == glm::uint8(Rand >> 8) && z == glm::uint8(Rand >> 16) && w == glm::uint8(Rand >> 24) ? 0 : 1;
+			}
+			{
+				glm::int16 x, y, z, w;
+				glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::int16(Rand), glm::int16(Rand >> 16), glm::int16(Rand >> 32), glm::int16(Rand >> 48)), x, y, z, w);
+				Error += x == glm::int16(Rand) && y == glm::int16(Rand >> 16) && z == glm::int16(Rand >> 32) && w == glm::int16(Rand >> 48) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+}//namespace bitfieldDeinterleave
+
+namespace bitfieldInterleaveArray
+{
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1003;
+
+		std::vector<glm::u8vec3> In8(Count);
+		std::vector<glm::u16vec3> In16(Count);
+		std::vector<glm::u32vec3> In32(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint64 const Rand = bitfieldDeinterleave::random64();
+			In8[i] = glm::u8vec3(Rand, Rand >> 8, Rand >> 16);
+			In16[i] = glm::u16vec3(Rand, Rand >> 16, Rand >> 32);
+			In32[i] = glm::u32vec3(Rand, Rand >> 21, Rand >> 42);
+		}
+
+		std::vector<glm::uint32> Key32(Count);
+		std::vector<glm::uint64> Key64(Count);
+
+		glm::bitfieldInterleave(&In8[0], &Key32[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Key32[i] == glm::bitfieldInterleave(In8[i].x, In8[i].y, In8[i].z) ? 0 : 1;
+
+		glm::bitfieldInterleave(&In32[0], &Key32[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint64 const Ref = glm::bitfieldInterleave(In32[i].x & 0x3FFu, In32[i].y & 0x3FFu, In32[i].z & 0x3FFu);
+			Error += Key32[i] == Ref ? 0 : 1;
+		}
+
+		glm::bitfieldInterleave(&In16[0], &Key64[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Key64[i] == glm::bitfieldInterleave(In16[i].x, In16[i].y, In16[i].z) ? 0 : 1;
+
+		glm::bitfieldInterleave(&In32[0], &Key64[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Key64[i] == glm::bitfieldInterleave(In32[i].x, In32[i].y, In32[i].z) ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf()
+	{
+		std::size_t const Count = 1 << 22;
+
+		std::vector<glm::u16vec3> In(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint64 const Rand = bitfieldDeinterleave::random64();
+			In[i] = glm::u16vec3(Rand, Rand >> 16, Rand >> 32);
+		}
+
+		std::vector<glm::uint64> Key(Count);
+
+		std::clock_t const Timestamp0 = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Key[i] = glm::bitfieldInterleave(In[i].x, In[i].y, In[i].z);
+		std::clock_t const Timestamp1 = std::clock();
+		glm::bitfieldInterleave(&In[0], &Key[0], Count);
+		std::clock_t const Timestamp2 = std::clock();
+
+		std::printf("bitfieldInterleave loop Time %d clocks\n", static_cast<unsigned int>(Timestamp1 - Timestamp0));
+		std::printf("bitfieldInterleave array Time %d clocks\n", static_cast<unsigned int>(Timestamp2 - Timestamp1));
+
+		return 0;
+	}
+}//namespace bitfieldInterleaveArray
+
 int main()
 {
 	int Error(0);
@@ -631,11 +769,14 @@ int main()
 	Error += ::bitfieldInterleave3::test();
 	Error += ::bitfieldInterleave4::test();
 	Error += ::bitfieldInterleave::test();
+	Error += ::bitfieldDeinterleave::test();
+	Error += ::bitfieldInterleaveArray::test();
 	//Error += ::bitRevert::test();
 
 #	ifdef NDEBUG
 		Error += ::mask::perf();
 		Error += ::bitfieldInterleave::perf();
+		Error += ::bitfieldInterleaveArray::perf();
 #	endif//NDEBUG
 
 	return Error;
@@ -1,6 +1,10 @@
 #include <glm/gtc/color_space.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <vector>
 
 namespace srgb
 {
@@ -40,11 +44,184 @@ namespace srgb
 	}
 }//namespace srgb
 
+namespace srgb_array
+{
+	int test_rgb()
+	{
+		int Error(0);
+
+		// Not a multiple of 4 components, to run the tails of the SIMD paths
+		std::size_t const Count = 1027;
+		std::vector<glm::vec3> Linear(Count), SRGB(Count), RoundTrip(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = static_cast<float>(i) / static_cast<float>(Count - 1);
+			Linear[i] = glm::vec3(x, x * x, 1.0f - x);
+		}
+
+		glm::convertLinearToSRGB(&Linear[0], &SRGB[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(SRGB[i], glm::convertLinearToSRGB(Linear[i]), 0.00002f)) ? 0 : 1;
+
+		glm::convertSRGBToLinear(&SRGB[0], &RoundTrip[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec3 const Reference = glm::convertSRGBToLinear(SRGB[i]);
+			Error += glm::all(glm::lessThanEqual(glm::abs(RoundTrip[i] - Reference), Reference * 0.00003f + 0.000001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(RoundTrip[i], Linear[i], 0.0001f)) ? 0 : 1;
+		}
+
+		// In place, out of range components are clamped
+		std::vector<glm::vec3> Colors(3);
+		Colors[0] = glm::vec3(-1.0f, 0.0f, 2.0f);
+		Colors[1] = glm::vec3(1.0f, 0.5f, 0.001f);
+		Colors[2] = glm::vec3(0.25f, 100.0f, -0.0f);
+		glm::convertLinearToSRGB(&Colors[0], &Colors[0], Colors.size());
+		Error += glm::all(glm::epsilonEqual(Colors[0], glm::vec3(0.0f, 0.0f, 1.0f), 0.00002f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Colors[1], glm::convertLinearToSRGB(glm::vec3(1.0f, 0.5f, 0.001f)), 0.00002f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Colors[2], glm::convertLinearToSRGB(glm::vec3(0.25f, 1.0f, 0.0f)), 0.00002f)) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Exact sRGB transfer functions
+	double encode(double Linear)
+	{
+		return Linear <= 0.0031308 ? Linear * 12.92 : 1.055 * std::pow(Linear, 1.0 / 2.4) - 0.055;
+	}
+
+	double decode(double SRGB)
+	{
+		return SRGB <= 0.04045 ? SRGB / 12.92 : std::pow((SRGB + 0.055) / 1.055, 2.4);
+	}
+
+	// The documented bounds: absolute error below 2e-5 to encode, relative error below 3e-5 to decode
+	int test_accuracy()
+	{
+		int Error(0);
+
+		std::size_t const Count = 1 << 16;
+		std::vector<glm::vec3> Values(Count), Encoded(Count), Decoded(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = static_cast<float>(i) / static_cast<float>(Count - 1);
+			Values[i] = glm::vec3(x, x * x, x * x * x);
+		}
+
+		glm::convertLinearToSRGB(&Values[0], &Encoded[0], Count);
+		glm::convertSRGBToLinear(&Values[0], &Decoded[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t j = 0; j < 3; ++j)
+		{
+			double const Reference = encode(Values[i][j]);
+			Error += std::abs(Encoded[i][j] - Reference) < 2e-5 ? 0 : 1;
+
+			double const ReferenceLinear = decode(Values[i][j]);
+			Error += std::abs(Decoded[i][j] - ReferenceLinear) <= ReferenceLinear * 3e-5 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_rgba8()
+	{
+		int Error(0);
+
+		std::size_t const Count = 259;
+		std::vector<glm::u8vec4> SRGB(Count), RoundTrip(Count);
+		std::vector<glm::vec4> Linear(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			SRGB[i] = glm::u8vec4(i % 256, 255 - i % 256, (i * 7) % 256, (i * 3) % 256);
+
+		glm::convertSRGBToLinear(&SRGB[0], &Linear[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec4 const Reference(glm::convertSRGBToLinear(glm::vec3(SRGB[i]) / 255.0f), static_cast<float>(SRGB[i].a) / 255.0f);
+			Error += glm::all(glm::epsilonEqual(Linear[i], Reference, 0.00001f)) ? 0 : 1;
+		}
+
+		// Every 8 bits value survives the round trip
+		glm::convertLinearToSRGB(&Linear[0], &RoundTrip[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += RoundTrip[i] == SRGB[i] ? 0 : 1;
+
+		std::vector<glm::vec4> Colors(5);
+		Colors[0] = glm::vec4(-1.0f, 0.0f, 1.0f, 2.0f);
+		Colors[1] = glm::vec4(0.5f, 0.2f, 0.001f, 0.5f);
+		Colors[2] = glm::vec4(0.0f);
+		Colors[3] = glm::vec4(1.0f);
+		Colors[4] = glm::vec4(0.5f, 0.2f, 0.001f, 0.5f);
+		std::vector<glm::u8vec4> Quantized(Colors.size());
+		glm::convertLinearToSRGB(&Colors[0], &Quantized[0], Colors.size());
+		Error += Quantized[0] == glm::u8vec4(0, 0, 255, 255) ? 0 : 1;
+		Error += Quantized[2] == glm::u8vec4(0) && Quantized[3] == glm::u8vec4(255) ? 0 : 1;
+		Error += Quantized[1] == Quantized[4] ? 0 : 1;
+		for(glm::length_t i = 0; i < 3; ++i)
+			Error += glm::abs(static_cast<float>(Quantized[1][i]) - glm::convertLinearToSRGB(glm::vec3(Colors[1]))[i] * 255.0f) <= 0.5f ? 0 : 1;
+		Error += Quantized[1].a == 128 ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf(std::size_t Count, std::size_t Loops)
+	{
+		int Error(0);
+
+		std::vector<glm::vec4> Linear(Count), LinearScalar(Count);
+		std::vector<glm::u8vec4> SRGB(Count), SRGBScalar(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Linear[i] = glm::vec4(static_cast<float>(i % 1024) / 1023.0f, 0.5f, static_cast<float>(i % 37) / 36.0f, 1.0f);
+
+		std::clock_t const StartScalar = std::clock();
+		for(std::size_t j = 0; j < Loops; ++j)
+		for(std::size_t i = 0; i < Count; ++i)
+			SRGBScalar[i] = glm::u8vec4(glm::convertLinearToSRGB(Linear[i]) * 255.0f + 0.5f);
+		std::clock_t const EndScalar = std::clock();
+
+		std::clock_t const StartArray = std::clock();
+		for(std::size_t j = 0; j < Loops; ++j)
+			glm::convertLinearToSRGB(&Linear[0], &SRGB[0], Count);
+		std::clock_t const EndArray = std::clock();
+
+		std::clock_t const StartScalarLinear = std::clock();
+		for(std::size_t j = 0; j < Loops; ++j)
+		for(std::size_t i = 0; i < Count; ++i)
+			LinearScalar[i] = glm::convertSRGBToLinear(glm::vec4(SRGB[i]) / 255.0f);
+		std::clock_t const EndScalarLinear = std::clock();
+
+		std::clock_t const StartArrayLinear = std::clock();
+		for(std::size_t j = 0; j < Loops; ++j)
+			glm::convertSRGBToLinear(&SRGB[0], &Linear[0], Count);
+		std::clock_t const EndArrayLinear = std::clock();
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::lessThanEqual(glm::abs(glm::ivec4(SRGB[i]) - glm::ivec4(SRGBScalar[i])), glm::ivec4(1))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Linear[i], LinearScalar[i], 0.0001f)) ? 0 : 1;
+		}
+
+		std::printf("linear to sRGB8, per color: %d clocks\n", static_cast<int>(EndScalar - StartScalar));
+		std::printf("linear to sRGB8, array: %d clocks\n", static_cast<int>(EndArray - StartArray));
+		std::printf("sRGB8 to linear, per color: %d clocks\n", static_cast<int>(EndScalarLinear - StartScalarLinear));
+		std::printf("sRGB8 to linear, array: %d clocks\n", static_cast<int>(EndArrayLinear - StartArrayLinear));
+
+		return Error;
+	}
+}//namespace srgb_array
+
 int main()
 {
 	int Error(0);
 
 	Error += srgb::test();
+	Error += srgb_array::test_rgb();
+	Error += srgb_array::test_accuracy();
+	Error += srgb_array::test_rgba8();
+
+#	ifdef NDEBUG
+		Error += srgb_array::perf(1 << 20, 1 << 3);
+#	endif//NDEBUG
 
 	return Error;
 }
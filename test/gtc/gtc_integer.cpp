@@ -215,6 +215,24 @@ namespace uround
 	}
 }//namespace uround
 
+namespace mod_
+{
+	int test()
+	{
+		int Error = 0;
+
+		Error += glm::mod(7, 3) == 1 ? 0 : 1;
+		Error += glm::mod(-7, 3) == -1 ? 0 : 1;
+		Error += glm::mod(7u, 3u) == 1u ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mod(glm::ivec4(7, -7, 9, 1), glm::ivec4(3, 3, 3, -2)), glm::ivec4(1, -1, 0, 1))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mod(glm::ivec4(7, -7, 9, 1), 3), glm::ivec4(1, -1, 0, 1))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mod(glm::uvec2(7, 8), glm::uvec2(4, 3)), glm::uvec2(3, 2))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mod(glm::aligned_ivec4(7, -7, 9, 1), glm::aligned_ivec4(3, 3, 3, -2)), glm::aligned_ivec4(1, -1, 0, 1))) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace mod_
+
 int main()
 {
 	int Error(0);
@@ -222,6 +240,7 @@ int main()
 	Error += ::log2_::test();
 	Error += ::iround::test();
 	Error += ::uround::test();
+	Error += ::mod_::test();
 
 #	ifdef NDEBUG
 		std::size_t const Samples(1000);
@@ -291,6 +291,45 @@ int test_quat_ctr()
 	return Error;
 }
 
+template <glm::precision P>
+int test_quat_precision_tier(float Epsilon)
+{
+	typedef glm::tquat<float, P> quat;
+
+	int Error(0);
+
+	quat const A(glm::quat(glm::vec3(0.3f, -1.2f, 0.7f)));
+	quat const B(glm::quat(glm::vec3(-2.1f, 0.4f, 1.9f)));
+	for(int i = 0; i <= 16; ++i)
+	{
+		float const a = static_cast<float>(i) / 16.0f;
+		glm::quat const Expected = glm::slerp(glm::quat(A), glm::quat(B), a);
+		Error += glm::all(glm::epsilonEqual(glm::quat(glm::slerp(A, B, a)), Expected, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::quat(glm::mix(A, B, a)), glm::mix(glm::quat(A), glm::quat(B), a), Epsilon)) ? 0 : 1;
+	}
+
+	// Interpolations of unit quaternions have a unit length, down to small angles
+	float const Angles[] = {2e-3f, 0.01f, 0.1f, 1.0f};
+	for(std::size_t i = 0; i < sizeof(Angles) / sizeof(Angles[0]); ++i)
+	{
+		quat const C(1.0f, 0.0f, 0.0f, 0.0f);
+		quat const D(glm::angleAxis(Angles[i] * 2.0f, glm::vec3(0, 0, 1)));
+		for(int j = 1; j < 4; ++j)
+		{
+			float const a = static_cast<float>(j) / 4.0f;
+			Error += glm::abs(glm::length(glm::quat(glm::slerp(C, D, a))) - 1.0f) < Epsilon ? 0 : 1;
+			Error += glm::abs(glm::length(glm::quat(glm::mix(C, D, a))) - 1.0f) < Epsilon ? 0 : 1;
+		}
+	}
+
+	quat const Q(1.0f, 2.0f, -3.0f, 4.0f);
+	Error += glm::abs(glm::length(Q) - std::sqrt(30.0f)) < Epsilon * std::sqrt(30.0f) ? 0 : 1;
+	Error += glm::abs(glm::length(glm::quat(glm::normalize(Q))) - 1.0f) < Epsilon ? 0 : 1;
+	Error += glm::normalize(quat(0.0f, 0.0f, 0.0f, 0.0f)) == quat(1.0f, 0.0f, 0.0f, 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
@@ -307,6 +346,9 @@ int main()
 	Error += test_quat_normalize();
 	Error += test_quat_euler();
 	Error += test_quat_slerp();
+	Error += test_quat_precision_tier<glm::highp>(1e-6f);
+	Error += test_quat_precision_tier<glm::mediump>(1e-5f);
+	Error += test_quat_precision_tier<glm::lowp>(2e-3f);
 
 	return Error;
 }
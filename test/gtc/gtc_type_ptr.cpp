@@ -1,4 +1,6 @@
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstddef>
 
 int test_value_ptr_vec()
 {
@@ -237,6 +239,74 @@ int test_make_pointer_vec()
 	return Error;
 }
 
+struct vertex
+{
+	float Position[3];
+	float Normal[3];
+	float TexCoord[2];
+};
+
+int test_strided_view()
+{
+	int Error = 0;
+
+	vertex Vertices[16];
+	for(int i = 0; i < 16; ++i)
+	{
+		for(int c = 0; c < 3; ++c)
+		{
+			Vertices[i].Position[c] = static_cast<float>(i * 3 + c);
+			Vertices[i].Normal[c] = 0.0f;
+		}
+		Vertices[i].TexCoord[0] = static_cast<float>(i);
+		Vertices[i].TexCoord[1] = static_cast<float>(-i);
+	}
+
+	{
+		glm::tstrided_view<glm::vec3> const Positions = glm::make_vec3_view(Vertices[0].Position, sizeof(vertex), 16);
+		Error += Positions.size() == 16 ? 0 : 1;
+		Error += Positions.stride() == sizeof(vertex) ? 0 : 1;
+		Error += !Positions.contiguous() ? 0 : 1;
+		Error += &Positions[3].x == &Vertices[3].Position[0] ? 0 : 1;
+		Error += Positions[5] == glm::vec3(15, 16, 17) ? 0 : 1;
+
+		// Writes go to the external buffer
+		Positions[2] = glm::vec3(-1);
+		Error += Vertices[2].Position[1] == -1.0f ? 0 : 1;
+		Error += Vertices[2].Normal[0] == 0.0f ? 0 : 1;
+
+		glm::tstrided_view<glm::vec3 const> const ReadOnly(Positions);
+		Error += ReadOnly[2] == glm::vec3(-1) ? 0 : 1;
+	}
+
+	{
+		glm::tstrided_view<glm::vec2> const TexCoords = glm::make_vec2_view(Vertices[0].TexCoord, sizeof(vertex), 16);
+		Error += static_cast<std::size_t>(TexCoords.end() - TexCoords.begin()) == TexCoords.size() ? 0 : 1;
+
+		std::reverse(TexCoords.begin(), TexCoords.end());
+		Error += Vertices[0].TexCoord[0] == 15.0f ? 0 : 1;
+		Error += Vertices[15].TexCoord[1] == 0.0f ? 0 : 1;
+		Error += Vertices[0].Position[0] == 0.0f ? 0 : 1;
+
+		std::fill(TexCoords.begin() + 4, TexCoords.begin() + 8, glm::vec2(100));
+		Error += Vertices[4].TexCoord[1] == 100.0f && Vertices[8].TexCoord[1] != 100.0f ? 0 : 1;
+
+		int Count = 0;
+		for(glm::tstrided_view<glm::vec2>::iterator it = TexCoords.begin(); it != TexCoords.end(); ++it)
+			Count += it->x == 100.0f ? 1 : 0;
+		Error += Count == 4 ? 0 : 1;
+	}
+
+	{
+		glm::vec4 Array[8];
+		glm::tstrided_view<glm::vec4 const> const View = glm::make_vec4_view(static_cast<float const *>(&Array[0].x), sizeof(glm::vec4), 8);
+		Error += View.contiguous() ? 0 : 1;
+		Error += View.data() == &Array[0] ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -247,6 +317,7 @@ int main()
 	Error += test_value_ptr_vec_const();
 	Error += test_value_ptr_mat();
 	Error += test_value_ptr_mat_const();
+	Error += test_strided_view();
 
 	return Error;
 }
@@ -0,0 +1,56 @@
+#define GLM_FORCE_ALIGNED
+#include <glm/gtc/type_ptr.hpp>
+
+typedef glm::tvec2<float, glm::packed_highp> packed_vec2;
+typedef glm::tvec3<float, glm::packed_highp> packed_vec3;
+typedef glm::tvec4<float, glm::packed_highp> packed_vec4;
+
+// With GLM_FORCE_ALIGNED, the default vector types are padded but the views of external buffers are packed
+int test_view_write_through()
+{
+	int Error = 0;
+
+	{
+		float Buffer[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+		glm::tstrided_view<packed_vec3> const View = glm::make_vec3_view(Buffer, 4 * sizeof(float), 3);
+		Error += sizeof(*View.begin()) == 3 * sizeof(float) ? 0 : 1;
+		Error += View[1] == packed_vec3(5, 6, 7) ? 0 : 1;
+
+		View[0] = packed_vec3(-1, -2, -3);
+		Error += Buffer[2] == -3.0f ? 0 : 1;
+		Error += Buffer[3] == 4.0f ? 0 : 1;
+		Error += Buffer[4] == 5.0f ? 0 : 1;
+	}
+
+	{
+		float Buffer[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+		glm::tstrided_view<packed_vec2> const View = glm::make_vec2_view(Buffer, 3 * sizeof(float), 3);
+		Error += sizeof(*View.begin()) == 2 * sizeof(float) ? 0 : 1;
+
+		View[1] = packed_vec2(-1, -2);
+		Error += Buffer[3] == -1.0f && Buffer[4] == -2.0f ? 0 : 1;
+		Error += Buffer[5] == 6.0f ? 0 : 1;
+	}
+
+	{
+		float Buffer[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+		glm::tstrided_view<packed_vec4> const View = glm::make_vec4_view(Buffer, 5 * sizeof(float), 2);
+		Error += sizeof(*View.begin()) == 4 * sizeof(float) ? 0 : 1;
+		Error += View[1] == packed_vec4(6, 7, 8, 9) ? 0 : 1;
+
+		View[0] = packed_vec4(-1);
+		Error += Buffer[3] == -1.0f ? 0 : 1;
+		Error += Buffer[4] == 5.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_view_write_through();
+
+	return Error;
+}
@@ -0,0 +1,275 @@
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+static std::size_t const Counts[] = {0, 1, 2, 3, 5, 17, 1000};
+
+template <typename vecType>
+static bool near(vecType const & a, vecType const & b)
+{
+	typedef typename vecType::value_type T;
+	return glm::all(glm::epsilonEqual(a, b, static_cast<T>(0.0001) * (static_cast<T>(1) + glm::compMax(glm::abs(b)))));
+}
+
+template <typename T, glm::precision P>
+static bool near(glm::tmat4x4<T, P> const & a, glm::tmat4x4<T, P> const & b)
+{
+	for(glm::length_t i = 0; i < 4; ++i)
+		if(!near(a[i], b[i]))
+			return false;
+	return true;
+}
+
+template <typename T>
+static int test_vec4()
+{
+	typedef glm::tvec4<T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		// One more element than processed, to check it is left untouched
+		std::vector<vec4> A(Count + 1), B(Count + 1), Result(Count + 1, vec4(42));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			A[i] = glm::linearRand(vec4(-10), vec4(10));
+			B[i] = glm::linearRand(vec4(1), vec4(10));
+		}
+
+		glm::batchAdd(&A[0], &B[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], A[i] + B[i]) ? 0 : 1;
+		Error += Result[Count] == vec4(42) ? 0 : 1;
+
+		glm::batchSub(&A[0], &B[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], A[i] - B[i]) ? 0 : 1;
+
+		glm::batchMul(&A[0], &B[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], A[i] * B[i]) ? 0 : 1;
+
+		glm::batchDiv(&A[0], &B[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], A[i] / B[i]) ? 0 : 1;
+		Error += Result[Count] == vec4(42) ? 0 : 1;
+
+		// In place
+		std::vector<vec4> Expected(A);
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] += B[i];
+		glm::batchAdd(&A[0], &B[0], &A[0], Count);
+		for(std::size_t i = 0; i < Count + 1; ++i)
+			Error += near(A[i], Expected[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+static int test_transform()
+{
+	typedef glm::tvec4<T, glm::defaultp> vec4;
+	typedef glm::tmat4x4<T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	mat4 const M(
+		glm::linearRand(vec4(-2), vec4(2)), glm::linearRand(vec4(-2), vec4(2)),
+		glm::linearRand(vec4(-2), vec4(2)), glm::linearRand(vec4(-2), vec4(2)));
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<vec4> V(Count + 1), Result(Count + 1, vec4(42));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+			V[i] = glm::linearRand(vec4(-10), vec4(10));
+
+		glm::batchMul(M, &V[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], M * V[i]) ? 0 : 1;
+		Error += Result[Count] == vec4(42) ? 0 : 1;
+
+		glm::batchMul(M, &V[0], &V[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(V[i], Result[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+static int test_mat4()
+{
+	typedef glm::tvec4<T, glm::defaultp> vec4;
+	typedef glm::tmat4x4<T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<mat4> A(Count + 1), B(Count + 1), Result(Count + 1, mat4(42));
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			A[i][j] = glm::linearRand(vec4(-2), vec4(2));
+			B[i][j] = glm::linearRand(vec4(-2), vec4(2));
+		}
+
+		glm::batchMul(&A[0], &B[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(Result[i], A[i] * B[i]) ? 0 : 1;
+		Error += Result[Count] == mat4(42) ? 0 : 1;
+
+		// In place of either operand
+		glm::batchMul(&A[0], &B[0], &A[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(A[i], Result[i]) ? 0 : 1;
+		glm::batchMul(&A[0], &A[0], &A[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += near(A[i], Result[i] * Result[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_extended()
+{
+	int Error = 0;
+
+	glm::uint Seed = 1;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<glm::uint> X(Count + 1), Y(Count + 1), Result0(Count + 1, 42u), Result1(Count + 1, 42u);
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			X[i] = Seed ^ (Seed >> 15);
+			Seed = Seed * 1664525u + 1013904223u;
+			Y[i] = Seed ^ (Seed >> 15);
+		}
+
+		glm::batchUaddCarry(&X[0], &Y[0], &Result0[0], &Result1[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint Carry = 0;
+			Error += Result0[i] == glm::uaddCarry(X[i], Y[i], Carry) && Result1[i] == Carry ? 0 : 1;
+		}
+		Error += Result0[Count] == 42u && Result1[Count] == 42u ? 0 : 1;
+
+		glm::batchUsubBorrow(&X[0], &Y[0], &Result0[0], &Result1[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint Borrow = 0;
+			Error += Result0[i] == glm::usubBorrow(X[i], Y[i], Borrow) && Result1[i] == Borrow ? 0 : 1;
+		}
+
+		glm::batchUmulExtended(&X[0], &Y[0], &Result0[0], &Result1[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint msb = 0, lsb = 0;
+			glm::umulExtended(X[i], Y[i], msb, lsb);
+			Error += Result0[i] == msb && Result1[i] == lsb ? 0 : 1;
+		}
+		Error += Result0[Count] == 42u && Result1[Count] == 42u ? 0 : 1;
+
+		std::vector<int> const I(X.begin(), X.end()), J(Y.begin(), Y.end());
+		std::vector<int> msbI(Count + 1, 42), lsbI(Count + 1, 42);
+		glm::batchImulExtended(&I[0], &J[0], &msbI[0], &lsbI[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			int msb = 0, lsb = 0;
+			glm::imulExtended(I[i], J[i], msb, lsb);
+			Error += msbI[i] == msb && lsbI[i] == lsb ? 0 : 1;
+		}
+		Error += msbI[Count] == 42 && lsbI[Count] == 42 ? 0 : 1;
+
+		// In place
+		std::vector<glm::uint> Expected(X);
+		for(std::size_t i = 0; i < Count; ++i)
+			Expected[i] += Y[i];
+		glm::batchUaddCarry(&X[0], &Y[0], &X[0], &Result1[0], Count);
+		for(std::size_t i = 0; i < Count + 1; ++i)
+			Error += X[i] == Expected[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int perf()
+{
+	std::size_t const Count = 1 << 14;
+
+	std::vector<glm::vec4> V(Count, glm::vec4(1, 2, 3, 1)), Result(Count);
+	std::vector<glm::mat4> A(Count, glm::mat4(1.0f)), B(Count, glm::mat4(2.0f)), Product(Count);
+	glm::mat4 const M(glm::vec4(1, 0, 0, 0), glm::vec4(0, 1, 0, 0), glm::vec4(0, 0, 1, 0), glm::vec4(1, 2, 3, 1));
+
+	std::clock_t const StartLoop = std::clock();
+	for(int j = 0; j < 100; ++j)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = M * V[i];
+		for(std::size_t i = 0; i < Count; ++i)
+			Product[i] = A[i] * B[i];
+	}
+	std::clock_t const EndLoop = std::clock();
+	for(int j = 0; j < 100; ++j)
+	{
+		glm::batchMul(M, &V[0], &Result[0], Count);
+		glm::batchMul(&A[0], &B[0], &Product[0], Count);
+	}
+	std::clock_t const EndBatch = std::clock();
+
+	std::printf("batchMul: loop %d clocks, batch %d clocks\n",
+		static_cast<int>(EndLoop - StartLoop), static_cast<int>(EndBatch - EndLoop));
+
+	// Limbs of 1024 multi-word integers of 16 words
+	std::vector<glm::uint> X(Count), Y(Count), Msb(Count), Lsb(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		X[i] = static_cast<glm::uint>(i) * 2654435761u;
+		Y[i] = ~X[i];
+	}
+
+	std::clock_t const StartLoopExtended = std::clock();
+	for(int j = 0; j < 100; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::umulExtended(X[i], Y[i], Msb[i], Lsb[i]);
+	std::clock_t const EndLoopExtended = std::clock();
+	for(int j = 0; j < 100; ++j)
+		glm::batchUmulExtended(&X[0], &Y[0], &Msb[0], &Lsb[0], Count);
+	std::clock_t const EndBatchExtended = std::clock();
+
+	std::printf("batchUmulExtended: loop %d clocks, batch %d clocks\n",
+		static_cast<int>(EndLoopExtended - StartLoopExtended), static_cast<int>(EndBatchExtended - EndLoopExtended));
+
+	return Result[Count - 1] == glm::vec4(2, 4, 6, 1) && Product[Count - 1] == glm::mat4(2.0f) && Lsb[Count - 1] == X[Count - 1] * Y[Count - 1] ? 0 : 1;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_vec4<float>();
+	Error += test_vec4<double>();
+	Error += test_transform<float>();
+	Error += test_transform<double>();
+	Error += test_mat4<float>();
+	Error += test_mat4<double>();
+	Error += test_extended();
+	Error += perf();
+
+	return Error;
+}
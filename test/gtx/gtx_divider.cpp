@@ -0,0 +1,133 @@
+#include <glm/gtx/divider.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/vector_relational.hpp>
+#include <glm/vec4.hpp>
+#include <climits>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+static glm::uint random_uint(glm::uint & Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Seed ^ (Seed >> 15);
+}
+
+static int test_idivider()
+{
+	int Error = 0;
+
+	int const Divisors[] = {1, -1, 2, -2, 3, -3, 6, 7, -7, 10, 16, -16, 641, 1 << 30, INT_MIN, INT_MAX, INT_MIN + 1, -1000000007};
+	glm::uint Seed = 1;
+
+	for(std::size_t i = 0; i < sizeof(Divisors) / sizeof(Divisors[0]); ++i)
+	{
+		int const Divisor = Divisors[i];
+		glm::idivider const Divider(Divisor);
+
+		for(int j = 0; j < 10000; ++j)
+		{
+			int const x = j < 4 ? (j == 0 ? 0 : j == 1 ? INT_MAX : j == 2 ? INT_MIN + 1 : Divisor) : static_cast<int>(random_uint(Seed));
+
+			Error += x / Divider == x / Divisor ? 0 : 1;
+			Error += x % Divider == x % Divisor ? 0 : 1;
+
+			if(Divisor == -1)
+				continue;
+
+			glm::ivec4 const v(x, -(x / 2), x / 3, 7);
+			glm::ivec4 const q(v.x / Divisor, v.y / Divisor, v.z / Divisor, v.w / Divisor);
+			glm::ivec4 const r(v.x % Divisor, v.y % Divisor, v.z % Divisor, v.w % Divisor);
+
+			Error += glm::all(glm::equal(v / Divider, q)) ? 0 : 1;
+			Error += glm::all(glm::equal(v % Divider, r)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::aligned_ivec4(v) / Divider), q)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::ivec4(glm::aligned_ivec4(v) % Divider), r)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_udivider()
+{
+	int Error = 0;
+
+	glm::uint const Divisors[] = {1u, 2u, 3u, 6u, 7u, 10u, 16u, 641u, 0x7FFFFFFFu, 0x80000000u, 0x80000001u, 0xFFFFFFFFu, 1000000007u};
+	glm::uint Seed = 1;
+
+	for(std::size_t i = 0; i < sizeof(Divisors) / sizeof(Divisors[0]); ++i)
+	{
+		glm::uint const Divisor = Divisors[i];
+		glm::udivider const Divider(Divisor);
+
+		for(int j = 0; j < 10000; ++j)
+		{
+			glm::uint const x = j < 3 ? (j == 0 ? 0u : j == 1 ? 0xFFFFFFFFu : Divisor) : random_uint(Seed);
+
+			Error += x / Divider == x / Divisor ? 0 : 1;
+			Error += x % Divider == x % Divisor ? 0 : 1;
+
+			glm::uvec4 const v(x, x >> 3, ~x, 7u);
+			glm::uvec4 const q(v.x / Divisor, v.y / Divisor, v.z / Divisor, v.w / Divisor);
+			glm::uvec4 const r(v.x % Divisor, v.y % Divisor, v.z % Divisor, v.w % Divisor);
+
+			Error += glm::all(glm::equal(v / Divider, q)) ? 0 : 1;
+			Error += glm::all(glm::equal(v % Divider, r)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(glm::aligned_uvec4(v) / Divider), q)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::uvec4(glm::aligned_uvec4(v) % Divider), r)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int perf_divider(std::size_t Count, std::size_t Loops)
+{
+	int Error = 0;
+
+	// Linear voxel indices divided by a chunk dimension only known at runtime
+	int const Dimension = static_cast<int>(24 + std::clock() % 2);
+
+	std::vector<glm::aligned_ivec4> Indices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Indices[i] = glm::aligned_ivec4(static_cast<int>(i * 4), static_cast<int>(i * 4 + 1), static_cast<int>(i * 4 + 2), static_cast<int>(i * 4 + 3));
+
+	glm::aligned_ivec4 SumDiv(0);
+	glm::aligned_ivec4 SumDivider(0);
+
+	std::clock_t const StartDiv = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		SumDiv += Indices[i] / glm::aligned_ivec4(Dimension);
+	std::clock_t const EndDiv = std::clock();
+
+	glm::idivider const Divider(Dimension);
+
+	std::clock_t const StartDivider = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		SumDivider += Indices[i] / Divider;
+	std::clock_t const EndDivider = std::clock();
+
+	Error += glm::all(glm::equal(SumDiv, SumDivider)) ? 0 : 1;
+
+	std::printf("aligned_ivec4 / aligned_ivec4: %d clocks\n", static_cast<int>(EndDiv - StartDiv));
+	std::printf("aligned_ivec4 / idivider: %d clocks\n", static_cast<int>(EndDivider - StartDivider));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_idivider();
+	Error += test_udivider();
+
+#	ifdef NDEBUG
+		Error += perf_divider(1 << 12, 1 << 10);
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,152 @@
+#include <glm/gtx/expression.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+template <typename T, glm::precision P>
+static int test_vec()
+{
+	int Error = 0;
+
+	glm::tvec4<T, P> const a(1, 2, 3, 4);
+	glm::tvec4<T, P> const b(8, 6, 4, 2);
+	glm::tvec4<T, P> const c(1, 1, 2, 2);
+	T const s(3);
+	T const t(2);
+
+	glm::tvec4<T, P> const Sum = glm::expr(a) * s + glm::expr(b) * t - c;
+	Error += Sum == a * s + b * t - c ? 0 : 1;
+
+	glm::tvec4<T, P> const Mixed = s * glm::expr(a) - b * glm::expr(c) + t;
+	Error += Mixed == s * a - b * c + t ? 0 : 1;
+
+	glm::tvec4<T, P> const Quotient = (glm::expr(b) + a) / c - T(1) / glm::expr(c);
+	Error += Quotient == (b + a) / c - T(1) / c ? 0 : 1;
+
+	glm::tvec4<T, P> const Negate = -(glm::expr(a) - b) * -glm::expr(c);
+	Error += Negate == -(a - b) * -c ? 0 : 1;
+
+	Error += glm::evaluate(c - glm::expr(a) * glm::expr(b)) == glm::tvec4<T, glm::defaultp>(c - a * b) ? 0 : 1;
+
+	glm::tmat4x4<T, P> const m(
+		glm::tvec4<T, P>(1, 0, 0, 0),
+		glm::tvec4<T, P>(0, 2, 0, 0),
+		glm::tvec4<T, P>(0, 0, 3, 0),
+		glm::tvec4<T, P>(4, 5, 6, 1));
+	glm::tvec4<T, P> const Transformed = m * (glm::expr(a) + b) + c;
+	Error += Transformed == m * (a + b) + c ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::precision P>
+static int test_array()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::vector<glm::tvec4<T, P> > a(Count), b(Count), Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		a[i] = glm::tvec4<T, P>(static_cast<T>(i), static_cast<T>(i + 1), static_cast<T>(i * 2), T(1));
+		b[i] = glm::tvec4<T, P>(T(1), T(2), static_cast<T>(i % 5), static_cast<T>(i));
+	}
+
+	glm::tvec4<T, P> const c(1, 2, 3, 4);
+	glm::tmat4x4<T, P> const m(glm::translate(glm::tmat4x4<T, P>(1), glm::tvec3<T, P>(1, 2, 3)));
+
+	glm::evaluate(&Result[0], Count, glm::expr(&a[0]) * T(2) + glm::expr(&b[0]) * c - c);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result[i] == a[i] * T(2) + b[i] * c - c ? 0 : 1;
+
+	glm::evaluate(&Result[0], Count, m * glm::expr(&a[0]));
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result[i] == m * a[i] ? 0 : 1;
+
+	// In place
+	glm::evaluate(&a[0], Count, glm::expr(&a[0]) - glm::expr(&b[0]));
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += a[i] + b[i] == glm::tvec4<T, P>(static_cast<T>(i), static_cast<T>(i + 1), static_cast<T>(i * 2), T(1)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_fma()
+{
+	int Error = 0;
+
+	// Values exactly representable so that fused and unfused results match
+	glm::vec4 const a(0.5f, 1.5f, -2.0f, 4.0f);
+	glm::vec4 const b(2.0f, 4.0f, 0.25f, -8.0f);
+	glm::vec4 const c(1.0f, -1.0f, 3.0f, 0.0f);
+
+	glm::vec4 const Fma = glm::expr(a) * b + c;
+	glm::vec4 const Fms = glm::expr(a) * b - c;
+	glm::vec4 const Fnma = glm::expr(c) - glm::expr(a) * b;
+	glm::vec4 const Products = glm::expr(a) * b - glm::expr(c) * a;
+
+	Error += Fma == a * b + c ? 0 : 1;
+	Error += Fms == a * b - c ? 0 : 1;
+	Error += Fnma == c - a * b ? 0 : 1;
+	Error += Products == a * b - c * a ? 0 : 1;
+
+	return Error;
+}
+
+static int perf_expression(std::size_t Count, std::size_t Loops)
+{
+	int Error = 0;
+
+	std::vector<glm::vec4> a(Count), b(Count), c(Count), ResultOperators(Count), ResultExpression(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		a[i] = glm::vec4(static_cast<float>(i % 7));
+		b[i] = glm::vec4(static_cast<float>(i % 5), 1.0f, 2.0f, 3.0f);
+		c[i] = glm::vec4(1.0f, static_cast<float>(i % 3), 0.5f, 0.25f);
+	}
+
+	float const s = 1.5f + static_cast<float>(std::clock() % 2);
+	float const t = 0.5f;
+
+	std::clock_t const StartOperators = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		ResultOperators[i] = a[i] * s + b[i] * t - c[i];
+	std::clock_t const EndOperators = std::clock();
+
+	std::clock_t const StartExpression = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+		glm::evaluate(&ResultExpression[0], Count, glm::expr(&a[0]) * s + glm::expr(&b[0]) * t - glm::expr(&c[0]));
+	std::clock_t const EndExpression = std::clock();
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::epsilonEqual(ResultOperators[i], ResultExpression[i], 0.0001f)) ? 0 : 1;
+
+	std::printf("vec4 operators: %d clocks\n", static_cast<int>(EndOperators - StartOperators));
+	std::printf("vec4 expression: %d clocks\n", static_cast<int>(EndExpression - StartExpression));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_vec<float, glm::highp>();
+	Error += test_vec<float, glm::aligned_highp>();
+	Error += test_vec<double, glm::highp>();
+	Error += test_vec<int, glm::highp>();
+	Error += test_array<float, glm::highp>();
+	Error += test_array<float, glm::aligned_highp>();
+	Error += test_array<double, glm::highp>();
+	Error += test_fma();
+
+#	ifdef NDEBUG
+		Error += perf_expression(1 << 12, 1 << 10);
+#	endif//NDEBUG
+
+	return Error;
+}
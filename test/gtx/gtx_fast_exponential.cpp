@@ -1,8 +1,97 @@
 #include <glm/gtx/fast_exponential.hpp>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+typedef glm::tvec4<float, glm::aligned_highp> aligned_vec4;
+
+// Largest relative error of the components of Value, bounded below by 1e-6 in absolute value
+static float relativeError(glm::vec4 const & Value, double Ref)
+{
+	double Error = 0.0;
+	for(glm::length_t i = 0; i < Value.length(); ++i)
+		Error = glm::max(Error, glm::abs(static_cast<double>(Value[i]) - Ref) / glm::max(glm::abs(Ref), 1e-6));
+	return static_cast<float>(Error);
+}
+
+int test_fastExp()
+{
+	int Error(0);
+
+	for(float x = -1.0f; x <= 1.0f; x += 1.0f / 256.0f)
+	{
+		Error += relativeError(glm::vec4(glm::fastExp(aligned_vec4(x))), std::exp(static_cast<double>(x))) <= 5e-3f ? 0 : 1;
+		Error += relativeError(glm::fastExp(glm::vec4(x)), std::exp(static_cast<double>(x))) <= 5e-3f ? 0 : 1;
+		Error += relativeError(glm::vec4(glm::fastExp2(aligned_vec4(x))), std::pow(2.0, static_cast<double>(x))) <= 1e-3f ? 0 : 1;
+		Error += relativeError(glm::fastExp2(glm::vec4(x)), std::pow(2.0, static_cast<double>(x))) <= 1e-3f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_fastLog()
+{
+	int Error(0);
+
+	for(float x = 1e-3f; x < 1e3f; x *= 1.01f)
+	{
+		double const Log = std::log(static_cast<double>(x));
+		Error += relativeError(glm::vec4(glm::fastLog(aligned_vec4(x))), Log) <= 1e-5f ? 0 : 1;
+		Error += relativeError(glm::fastLog(glm::vec4(x)), Log) <= 1e-5f ? 0 : 1;
+		Error += relativeError(glm::vec4(glm::fastLog2(aligned_vec4(x))), Log / std::log(2.0)) <= 1e-5f ? 0 : 1;
+		Error += relativeError(glm::fastLog2(glm::vec4(x)), Log / std::log(2.0)) <= 1e-5f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_fastPow()
+{
+	int Error(0);
+
+	for(float x = 1e-3f; x < 1e3f; x *= 1.01f)
+	{
+		double const Pow = std::pow(static_cast<double>(x), 2.2);
+		Error += relativeError(glm::vec4(glm::fastPow(aligned_vec4(x), aligned_vec4(2.2f))), Pow) <= 1e-5f ? 0 : 1;
+		Error += relativeError(glm::fastPow(glm::vec4(x), glm::vec4(2.2f)), Pow) <= 1e-5f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_fastExp(std::size_t Samples)
+{
+	std::vector<aligned_vec4> Aligned(Samples, aligned_vec4(0.5f));
+	std::vector<glm::vec4> Packed(Samples, glm::vec4(0.5f));
+
+	std::clock_t const TimeStampBegin = std::clock();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Aligned[i] = glm::fastExp(Aligned[i]);
+
+	std::clock_t const TimeStampAligned = std::clock();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Packed[i] = glm::fastExp(Packed[i]);
+
+	std::clock_t const TimeStampEnd = std::clock();
+
+	std::printf("fastExp aligned vec4 Time %d clocks\n", static_cast<int>(TimeStampAligned - TimeStampBegin));
+	std::printf("fastExp packed vec4 Time %d clocks\n", static_cast<int>(TimeStampEnd - TimeStampAligned));
+
+	return 0;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_fastExp();
+	Error += test_fastLog();
+	Error += test_fastPow();
+
+#	ifdef NDEBUG
+		Error += perf_fastExp(1 << 20);
+#	endif//NDEBUG
+
 	return Error;
 }
@@ -2,6 +2,11 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/vector_relational.hpp>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <vector>
 
 int test_fastInverseSqrt()
 {
@@ -34,12 +39,70 @@ int test_fastDistance()
 	return Error;
 }
 
+int test_fastSqrt_aligned()
+{
+	int Error(0);
+
+	typedef glm::tvec4<float, glm::aligned_highp> aligned_vec4;
+
+	// Aligned vec4 use the SSE estimates refined by a Newton step
+	for(float x = 1e-3f; x < 1e3f; x *= 1.01f)
+	{
+		float const Sqrt = std::sqrt(x);
+		Error += glm::all(glm::epsilonEqual(glm::vec4(glm::fastSqrt(aligned_vec4(x))), glm::vec4(Sqrt), Sqrt * 1e-5f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::vec4(glm::fastInverseSqrt(aligned_vec4(x))), glm::vec4(1.0f / Sqrt), 1e-5f / Sqrt)) ? 0 : 1;
+	}
+
+	float const Inf = std::numeric_limits<float>::infinity();
+
+	aligned_vec4 const Sqrt = glm::fastSqrt(aligned_vec4(0.0f, Inf, 4.0f, 1e-40f));
+	Error += Sqrt.x == 0.0f ? 0 : 1;
+	Error += Sqrt.y == Inf ? 0 : 1;
+	Error += glm::epsilonEqual(Sqrt.z, 2.0f, 1e-5f) ? 0 : 1;
+
+	aligned_vec4 const InverseSqrt = glm::fastInverseSqrt(aligned_vec4(0.0f, Inf, 4.0f, -1.0f));
+	Error += InverseSqrt.x == Inf ? 0 : 1;
+	Error += InverseSqrt.y == 0.0f ? 0 : 1;
+	Error += glm::epsilonEqual(InverseSqrt.z, 0.5f, 1e-5f) ? 0 : 1;
+	Error += InverseSqrt.w != InverseSqrt.w ? 0 : 1;
+
+	return Error;
+}
+
+int perf_fastInverseSqrt_aligned(std::size_t Samples)
+{
+	typedef glm::tvec4<float, glm::aligned_highp> aligned_vec4;
+
+	std::vector<aligned_vec4> Aligned(Samples, aligned_vec4(2.0f));
+	std::vector<glm::vec4> Packed(Samples, glm::vec4(2.0f));
+
+	std::clock_t const TimeStampBegin = std::clock();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Aligned[i] = glm::fastInverseSqrt(Aligned[i]);
+
+	std::clock_t const TimeStampAligned = std::clock();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Packed[i] = glm::fastInverseSqrt(Packed[i]);
+
+	std::clock_t const TimeStampEnd = std::clock();
+
+	std::printf("fastInverseSqrt aligned vec4 Time %d clocks\n", static_cast<int>(TimeStampAligned - TimeStampBegin));
+	std::printf("fastInverseSqrt packed vec4 Time %d clocks\n", static_cast<int>(TimeStampEnd - TimeStampAligned));
+
+	return 0;
+}
+
 int main()
 {
 	int Error(0);
 
 	Error += test_fastInverseSqrt();
 	Error += test_fastDistance();
+	Error += test_fastSqrt_aligned();
+
+#	ifdef NDEBUG
+		Error += perf_fastInverseSqrt_aligned(1 << 20);
+#	endif//NDEBUG
 
 	return Error;
 }
@@ -425,12 +425,97 @@ namespace taylorCos
 	}
 }//namespace taylorCos
 
+// Accuracy and speed of the fast functions on aligned vec4, evaluated with SIMD kernels, and on packed vec4, evaluated per component
+namespace simd
+{
+	typedef glm::tvec4<float, glm::aligned_highp> aligned_vec4;
+
+	struct fastCos{static char const* name(){return "fastCos";} template <typename genType> genType operator()(genType const & x) const {return glm::fastCos(x);} float ref(float x) const {return std::cos(x);}};
+	struct fastSin{static char const* name(){return "fastSin";} template <typename genType> genType operator()(genType const & x) const {return glm::fastSin(x);} float ref(float x) const {return std::sin(x);}};
+	struct fastTan{static char const* name(){return "fastTan";} template <typename genType> genType operator()(genType const & x) const {return glm::fastTan(x);} float ref(float x) const {return std::tan(x);}};
+	struct fastAsin{static char const* name(){return "fastAsin";} template <typename genType> genType operator()(genType const & x) const {return glm::fastAsin(x);} float ref(float x) const {return std::asin(x);}};
+	struct fastAcos{static char const* name(){return "fastAcos";} template <typename genType> genType operator()(genType const & x) const {return glm::fastAcos(x);} float ref(float x) const {return std::acos(x);}};
+	struct fastAtan{static char const* name(){return "fastAtan";} template <typename genType> genType operator()(genType const & x) const {return glm::fastAtan(x);} float ref(float x) const {return std::atan(x);}};
+
+	// Prints a row of the table, returns an error if the maximum absolute error exceeds Tolerance
+	// or if the aligned and packed results differ by more than Tolerance
+	template <typename funcType>
+	int row(float Min, float Max, float Tolerance)
+	{
+		funcType const Func;
+		std::size_t const Count = 1 << 14;
+		std::vector<aligned_vec4> AlignedIn(Count), AlignedOut(Count);
+		std::vector<glm::vec4> PackedIn(Count), PackedOut(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t j = 0; j < 4; ++j)
+			AlignedIn[i][j] = PackedIn[i][j] = Min + (Max - Min) * static_cast<float>(i * 4 + j) / static_cast<float>(Count * 4 - 1);
+
+		std::clock_t const Time0 = std::clock();
+		for(int k = 0; k < 20; ++k)
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedOut[i] = Func(AlignedIn[i]);
+		std::clock_t const Time1 = std::clock();
+		for(int k = 0; k < 20; ++k)
+		for(std::size_t i = 0; i < Count; ++i)
+			PackedOut[i] = Func(PackedIn[i]);
+		std::clock_t const Time2 = std::clock();
+		std::vector<glm::vec4> StdOut(Count);
+		for(int k = 0; k < 20; ++k)
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t j = 0; j < 4; ++j)
+			StdOut[i][j] = Func.ref(PackedIn[i][j]);
+		std::clock_t const Time3 = std::clock();
+
+		float MaxError = 0.0f, MaxDifference = 0.0f;
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			MaxError = glm::max(MaxError, glm::abs(AlignedOut[i][j] - StdOut[i][j]));
+			MaxDifference = glm::max(MaxDifference, glm::abs(AlignedOut[i][j] - PackedOut[i][j]));
+		}
+
+		std::printf("%-10s [%6.3f, %6.3f] %10.3g %10.3g %8d %8d %8d\n", funcType::name(), Min, Max, MaxError, MaxDifference,
+			static_cast<int>(Time1 - Time0), static_cast<int>(Time2 - Time1), static_cast<int>(Time3 - Time2));
+
+		int Error = 0;
+		Error += MaxError <= Tolerance ? 0 : 1;
+		Error += MaxDifference <= Tolerance ? 0 : 1;
+		return Error;
+	}
+
+	int table()
+	{
+		int Error = 0;
+
+		float const Pi = glm::pi<float>();
+
+		std::printf("function   domain           max error  aligned/packed  aligned   packed      std (clocks)\n");
+		Error += row<fastCos>(-Pi, Pi, 2e-5f);
+		Error += row<fastCos>(-8.0f * Pi, 8.0f * Pi, 2e-5f);
+		Error += row<fastSin>(-Pi, Pi, 2e-5f);
+		Error += row<fastTan>(-0.5f, 0.5f, 1e-4f);
+		Error += row<fastAsin>(-0.5f, 0.5f, 2e-4f);
+		Error += row<fastAcos>(-0.5f, 0.5f, 2e-4f);
+		Error += row<fastAtan>(-0.5f, 0.5f, 1e-4f);
+
+		// fastAtan(y, x) combines the signs of its arguments with fastAtan(y / x)
+		aligned_vec4 const Y(0.25f, -0.25f, 0.25f, -0.25f), X(1.0f, 1.0f, -1.0f, -1.0f);
+		glm::vec4 const Expected(glm::fastAtan(Y.x, X.x), glm::fastAtan(Y.y, X.y), glm::fastAtan(Y.z, X.z), glm::fastAtan(Y.w, X.w));
+		aligned_vec4 const Result = glm::fastAtan(Y, X);
+		for(glm::length_t i = 0; i < 4; ++i)
+			Error += glm::abs(Result[i] - Expected[i]) < 1e-6f ? 0 : 1;
+
+		return Error;
+	}
+}//namespace simd
+
 int main()
 {
 	int Error(0);
 
 	Error += ::taylorCos::test();
 	Error += ::taylorCos::perf(1000);
+	Error += ::simd::table();
 
 #	ifdef NDEBUG
 		::fastCos::perf(false);
@@ -0,0 +1,196 @@
+#define GLM_FORCE_FLUSH_DENORMALS
+#include <glm/gtx/float_environment.hpp>
+#include <glm/gtx/batch.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <vector>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// MXCSR without the exception flags
+static unsigned int control()
+{
+	return _mm_getcsr() & ~0x3Fu;
+}
+
+static float multiply(float a, float b)
+{
+	volatile float x = a;
+	volatile float y = b;
+	volatile float Result = x * y;
+	return Result;
+}
+
+static float divide(float a, float b)
+{
+	volatile float x = a;
+	volatile float y = b;
+	volatile float Result = x / y;
+	return Result;
+}
+
+static int test_denormals()
+{
+	int Error = 0;
+
+	float const Denormal = std::numeric_limits<float>::min() / 4.0f;
+	unsigned int const Environment = control();
+
+	Error += multiply(Denormal, 1.0f) == Denormal ? 0 : 1;
+	{
+		glm::float_environment_guard const Guard;
+		Error += glm::flushDenormals() ? 0 : 1;
+		Error += multiply(Denormal, 1.0f) == 0.0f ? 0 : 1;
+		Error += multiply(std::numeric_limits<float>::min(), 0.5f) == 0.0f ? 0 : 1;
+
+		{
+			glm::float_environment_guard const Nested(false);
+			Error += !glm::flushDenormals() ? 0 : 1;
+			Error += multiply(Denormal, 1.0f) == Denormal ? 0 : 1;
+		}
+
+		Error += glm::flushDenormals() ? 0 : 1;
+		Error += multiply(Denormal, 1.0f) == 0.0f ? 0 : 1;
+	}
+	Error += control() == Environment ? 0 : 1;
+	Error += multiply(Denormal, 1.0f) == Denormal ? 0 : 1;
+
+	return Error;
+}
+
+static int test_rounding()
+{
+	int Error = 0;
+
+	unsigned int const Environment = control();
+
+	// 1/3 rounded to nearest is above 1/3
+	float const Nearest = divide(1.0f, 3.0f);
+
+	{
+		glm::float_environment_guard const Guard(false, std::round_toward_infinity);
+		Error += glm::roundingMode() == std::round_toward_infinity ? 0 : 1;
+		Error += divide(1.0f, 3.0f) == Nearest ? 0 : 1;
+		Error += divide(-1.0f, 3.0f) > -Nearest ? 0 : 1;
+	}
+	{
+		glm::float_environment_guard const Guard(false, std::round_toward_neg_infinity);
+		Error += glm::roundingMode() == std::round_toward_neg_infinity ? 0 : 1;
+		Error += divide(1.0f, 3.0f) < Nearest ? 0 : 1;
+		Error += divide(-1.0f, 3.0f) == -Nearest ? 0 : 1;
+	}
+	{
+		glm::float_environment_guard const Guard(false, std::round_toward_zero);
+		Error += glm::roundingMode() == std::round_toward_zero ? 0 : 1;
+		Error += divide(1.0f, 3.0f) < Nearest ? 0 : 1;
+		Error += divide(-1.0f, 3.0f) > -Nearest ? 0 : 1;
+
+		// round_indeterminate keeps the current rounding mode
+		glm::float_environment_guard const Nested(true, std::round_indeterminate);
+		Error += glm::roundingMode() == std::round_toward_zero ? 0 : 1;
+	}
+	Error += glm::roundingMode() == std::round_to_nearest ? 0 : 1;
+	Error += control() == Environment ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision P>
+static int test_batch()
+{
+	int Error = 0;
+
+	float const Denormal = std::numeric_limits<float>::min() / 4.0f;
+	unsigned int const Environment = control();
+
+	std::size_t const Count = 37;
+	std::vector<glm::tvec4<float, P> > a(Count, glm::tvec4<float, P>(Denormal, 1.0f, Denormal, 2.0f));
+	std::vector<glm::tvec4<float, P> > b(Count, glm::tvec4<float, P>(1.0f, 3.0f, 0.5f, 4.0f));
+	std::vector<glm::tvec4<float, P> > Result(Count);
+
+	// GLM_FORCE_FLUSH_DENORMALS: the array functions flush denormals, and only for the duration of the call
+	glm::batchMul(&a[0], &b[0], &Result[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result[i] == glm::tvec4<float, P>(0.0f, 3.0f, 0.0f, 8.0f) ? 0 : 1;
+	Error += control() == Environment ? 0 : 1;
+
+	glm::tmat4x4<float, P> const m(1.0f);
+	glm::batchMul(m, &a[0], &Result[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Result[i] == glm::tvec4<float, P>(0.0f, 1.0f, 0.0f, 2.0f) ? 0 : 1;
+	Error += control() == Environment ? 0 : 1;
+
+	Error += multiply(Denormal, 1.0f) == Denormal ? 0 : 1;
+
+	return Error;
+}
+
+#ifdef NDEBUG
+static int perf_denormals(std::size_t Count, std::size_t Loops)
+{
+	int Error = 0;
+
+	// Products of denormals and of small normal numbers producing denormals are handled by microcode
+	float const Small = std::numeric_limits<float>::min() * 2.0f;
+	std::vector<glm::aligned_vec4> a(Count, glm::aligned_vec4(Small, Small * 0.5f, Small / 4.0f, Small));
+	std::vector<glm::aligned_vec4> b(Count, glm::aligned_vec4(0.25f));
+	std::vector<glm::aligned_vec4> Result(Count);
+
+	std::clock_t const StartDenormals = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = a[i] * b[i];
+	std::clock_t const EndDenormals = std::clock();
+	Error += Result[0].x > 0.0f ? 0 : 1;
+
+	std::clock_t const StartGuard = std::clock();
+	{
+		glm::float_environment_guard const Guard;
+		for(std::size_t j = 0; j < Loops; ++j)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = a[i] * b[i];
+	}
+	std::clock_t const EndGuard = std::clock();
+	Error += Result[0].x == 0.0f ? 0 : 1;
+
+	std::clock_t const StartBatch = std::clock();
+	for(std::size_t j = 0; j < Loops; ++j)
+		glm::batchMul(&a[0], &b[0], &Result[0], Count);
+	std::clock_t const EndBatch = std::clock();
+	Error += Result[0].x == 0.0f ? 0 : 1;
+
+	std::printf("aligned_vec4 denormal products: %d clocks\n", static_cast<int>(EndDenormals - StartDenormals));
+	std::printf("aligned_vec4 denormal products, float_environment_guard: %d clocks\n", static_cast<int>(EndGuard - StartGuard));
+	std::printf("aligned_vec4 denormal products, batchMul with GLM_FORCE_FLUSH_DENORMALS: %d clocks\n", static_cast<int>(EndBatch - StartBatch));
+
+	return Error;
+}
+#endif//NDEBUG
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+int main()
+{
+	int Error = 0;
+
+	{
+		// The guard is always available, without effect when the environment can't be controlled
+		glm::float_environment_guard const Guard(true, std::round_to_nearest);
+		Error += glm::roundingMode() == std::round_to_nearest ? 0 : 1;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		Error += test_denormals();
+		Error += test_rounding();
+		Error += test_batch<glm::highp>();
+		Error += test_batch<glm::aligned_highp>();
+
+#		ifdef NDEBUG
+			Error += perf_denormals(1 << 12, 1 << 9);
+#		endif//NDEBUG
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	return Error;
+}
@@ -0,0 +1,169 @@
+#include <glm/gtx/frustum.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/random.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+static int test_planes()
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspectiveRH(glm::half_pi<float>(), 1.0f, 1.0f, 100.0f);
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(Projection, Planes);
+
+	// The right handed camera looks down -z
+	Error += glm::all(glm::epsilonEqual(Planes[4], glm::vec4(0, 0, -1, -1), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(Planes[5], glm::vec4(0, 0, 1, 100), 0.001f)) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::length(glm::vec3(Planes[0])), 1.0f, 0.0001f) ? 0 : 1;
+
+	glm::mat4 const ProjectionZO = glm::perspectiveLH(glm::half_pi<float>(), 1.0f, 1.0f, 100.0f);
+	glm::mat4 ProjectionZOFixed(ProjectionZO);
+	ProjectionZOFixed[2][2] = 100.0f / 99.0f;
+	ProjectionZOFixed[3][2] = -100.0f / 99.0f;
+
+	glm::frustumPlanesZO(ProjectionZOFixed, Planes);
+
+	// The left handed camera looks down +z
+	Error += glm::all(glm::epsilonEqual(Planes[4], glm::vec4(0, 0, 1, -1), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(Planes[5], glm::vec4(0, 0, -1, 100), 0.001f)) ? 0 : 1;
+
+	glm::frustumPlanesNO(glm::infinitePerspectiveRH(glm::half_pi<float>(), 1.0f, 1.0f), Planes);
+	Error += glm::frustumIntersectSphere(Planes, glm::vec4(0, 0, -1e6f, 0)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_intersect()
+{
+	int Error = 0;
+
+	glm::dmat4 const Projection = glm::perspective(glm::half_pi<double>(), 1.0, 1.0, 100.0);
+	glm::dmat4 const View = glm::lookAt(glm::dvec3(0, 0, 10), glm::dvec3(0), glm::dvec3(0, 1, 0));
+
+	glm::dvec4 Planes[6];
+	glm::frustumPlanes(Projection * View, Planes);
+
+	Error += glm::frustumIntersectSphere(Planes, glm::dvec4(0, 0, 0, 1)) ? 0 : 1;
+	Error += glm::frustumIntersectSphere(Planes, glm::dvec4(0, 0, 20, 1)) ? 1 : 0;
+	Error += glm::frustumIntersectSphere(Planes, glm::dvec4(0, 0, 9.5, 1)) ? 0 : 1;
+	Error += glm::frustumIntersectSphere(Planes, glm::dvec4(50, 0, 0, 1)) ? 1 : 0;
+	Error += glm::frustumIntersectSphere(Planes, glm::dvec4(0, 0, -95, 10)) ? 0 : 1;
+
+	Error += glm::frustumIntersectAABB(Planes, glm::dvec3(-1), glm::dvec3(1)) ? 0 : 1;
+	Error += glm::frustumIntersectAABB(Planes, glm::dvec3(40, -1, -1), glm::dvec3(42, 1, 1)) ? 1 : 0;
+	Error += glm::frustumIntersectAABB(Planes, glm::dvec3(-100, -1, -1), glm::dvec3(100, 1, 1)) ? 0 : 1;
+
+	return Error;
+}
+
+struct instance
+{
+	glm::mat4 Model;
+	glm::vec4 Sphere;
+};
+
+static int test_cull()
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 50.0f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(3, 2, 10), glm::vec3(0), glm::vec3(0, 1, 0));
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(Projection * View, Planes);
+
+	std::size_t const Counts[] = {0, 1, 3, 8, 31, 32, 33, 1000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<glm::vec4> Spheres(Count);
+		std::vector<glm::vec3> Min(Count), Max(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec3 const Center = glm::linearRand(glm::vec3(-60), glm::vec3(60));
+			glm::vec3 const Extent = glm::linearRand(glm::vec3(0), glm::vec3(5));
+			Spheres[i] = glm::vec4(Center, glm::length(Extent));
+			Min[i] = Center - Extent;
+			Max[i] = Center + Extent;
+		}
+
+		std::vector<glm::uint32> SphereMask((Count + 31) / 32 + 1, 0xdeadbeef);
+		std::vector<glm::uint32> AABBMask((Count + 31) / 32 + 1, 0xdeadbeef);
+		glm::frustumCullSpheres(Planes, Spheres.empty() ? NULL : &Spheres[0], Count, &SphereMask[0]);
+		glm::frustumCullAABBs(Planes, Min.empty() ? NULL : &Min[0], Max.empty() ? NULL : &Max[0], Count, &AABBMask[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			bool const SphereVisible = (SphereMask[i / 32] >> (i % 32)) & 1;
+			bool const AABBVisible = (AABBMask[i / 32] >> (i % 32)) & 1;
+			Error += SphereVisible == glm::frustumIntersectSphere(Planes, Spheres[i]) ? 0 : 1;
+			Error += AABBVisible == glm::frustumIntersectAABB(Planes, Min[i], Max[i]) ? 0 : 1;
+		}
+
+		// Unused bits are cleared and the words past the end are untouched
+		if(Count % 32)
+		{
+			Error += SphereMask[Count / 32] >> (Count % 32) == 0 ? 0 : 1;
+			Error += AABBMask[Count / 32] >> (Count % 32) == 0 ? 0 : 1;
+		}
+		Error += SphereMask[(Count + 31) / 32] == 0xdeadbeef ? 0 : 1;
+		Error += AABBMask[(Count + 31) / 32] == 0xdeadbeef ? 0 : 1;
+
+		// Spheres stored in instance structures
+		std::vector<instance> Instances(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Instances[i].Sphere = Spheres[i];
+		std::vector<glm::uint32> ViewMask((Count + 31) / 32 + 1, 0xdeadbeef);
+		glm::frustumCullSpheres(Planes, glm::tstrided_view<glm::vec4 const>(Count ? &Instances[0].Sphere : NULL, sizeof(instance), Count), &ViewMask[0]);
+		Error += ViewMask == SphereMask ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int perf()
+{
+	std::size_t const Count = 500000;
+
+	glm::mat4 const Projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(Projection, Planes);
+
+	std::vector<glm::vec4> Spheres(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Spheres[i] = glm::vec4(glm::linearRand(glm::vec3(-500), glm::vec3(500)), 1.0f);
+
+	std::vector<glm::uint32> Mask((Count + 31) / 32);
+
+	std::clock_t const StartBatch = std::clock();
+	glm::frustumCullSpheres(Planes, &Spheres[0], Count, &Mask[0]);
+	std::clock_t const EndBatch = std::clock();
+
+	std::size_t Visible = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Visible += glm::frustumIntersectSphere(Planes, Spheres[i]) ? 1 : 0;
+	std::clock_t const EndScalar = std::clock();
+
+	std::printf("frustumCullSpheres: %d clocks, frustumIntersectSphere loop: %d clocks, %d visible\n",
+		static_cast<int>(EndBatch - StartBatch), static_cast<int>(EndScalar - EndBatch), static_cast<int>(Visible));
+
+	return 0;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_planes();
+	Error += test_intersect();
+	Error += test_cull();
+	Error += perf();
+
+	return Error;
+}
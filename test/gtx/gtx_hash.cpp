@@ -0,0 +1,165 @@
+#include <glm/glm.hpp>
+
+#if GLM_HAS_CXX11_STL
+#include <glm/gtx/hash.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <unordered_set>
+#include <vector>
+
+static int test_std_hash()
+{
+	int Error = 0;
+
+	std::unordered_set<glm::vec3> Set;
+	Set.insert(glm::vec3(1, 2, 3));
+	Set.insert(glm::vec3(1, 2, 3));
+	Set.insert(glm::vec3(3, 2, 1));
+	Error += Set.size() == 2 ? 0 : 1;
+
+	Error += std::hash<glm::vec3>()(glm::vec3(0.0f, -0.0f, 1.0f)) == std::hash<glm::vec3>()(glm::vec3(-0.0f, 0.0f, 1.0f)) ? 0 : 1;
+	Error += std::hash<glm::dvec2>()(glm::dvec2(-0.0, 0.0)) == std::hash<glm::dvec2>()(glm::dvec2(0.0)) ? 0 : 1;
+	Error += std::hash<glm::ivec2>()(glm::ivec2(1, 2)) != std::hash<glm::ivec2>()(glm::ivec2(2, 1)) ? 0 : 1;
+	Error += std::hash<glm::mat4>()(glm::mat4(1)) != std::hash<glm::mat4>()(glm::mat4(2)) ? 0 : 1;
+	Error += std::hash<glm::quat>()(glm::quat(1, 0, 0, 0)) != std::hash<glm::quat>()(glm::quat(0, 1, 0, 0)) ? 0 : 1;
+	Error += std::hash<glm::dualquat>()(glm::dualquat()) == std::hash<glm::dualquat>()(glm::dualquat()) ? 0 : 1;
+	Error += std::hash<glm::bvec3>()(glm::bvec3(true, false, true)) != std::hash<glm::bvec3>()(glm::bvec3(false, true, true)) ? 0 : 1;
+	Error += std::hash<glm::dmat4x3>()(glm::dmat4x3(1)) != std::hash<glm::dmat4x3>()(glm::dmat4x3(-1)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_collisions()
+{
+	int Error = 0;
+
+	// Integer grids are the worst case of the per component std::hash folding
+	std::vector<glm::uint64> Hashes;
+	for(int z = -40; z < 40; ++z)
+	for(int y = -40; y < 40; ++y)
+	for(int x = -40; x < 40; ++x)
+	{
+		Hashes.push_back(glm::hashBlock(glm::ivec3(x, y, z)));
+		Hashes.push_back(glm::hashBlock(glm::vec3(x, y, z) * 0.5f, 1));
+	}
+
+	std::sort(Hashes.begin(), Hashes.end());
+	Error += std::unique(Hashes.begin(), Hashes.end()) == Hashes.end() ? 0 : 1;
+
+	// Buckets of a power of two table stay balanced
+	std::vector<int> Buckets(1024, 0);
+	for(int x = 0; x < 64 * 1024; ++x)
+		++Buckets[glm::hashBlock(glm::ivec2(x % 256, x / 256)) & 1023];
+	Error += *std::max_element(Buckets.begin(), Buckets.end()) < 128 ? 0 : 1;
+
+	Error += glm::hashBlock(glm::vec4(1), 0) != glm::hashBlock(glm::vec4(1), 1) ? 0 : 1;
+	Error += glm::hashBlock(glm::u8vec3(1, 2, 3)) != glm::hashBlock(glm::u8vec3(1, 2, 4)) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename genType>
+static int test_array(std::vector<genType> const & Values)
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count <= Values.size(); Count += Count < 9 ? 1 : 31)
+	{
+		std::vector<glm::uint64> Hashes(Count + 1, 0xdeadbeef);
+		glm::hashBlock(Values.empty() ? NULL : &Values[0], Count, &Hashes[0], 42);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Hashes[i] == glm::hashBlock(Values[i], 42) ? 0 : 1;
+		Error += Hashes[Count] == 0xdeadbeef ? 0 : 1;
+
+		// Every other value through a strided view
+		std::vector<glm::uint64> ViewHashes(Count / 2);
+		glm::hashBlock(glm::tstrided_view<genType const>(Values.empty() ? NULL : &Values[0], sizeof(genType) * 2, Count / 2), ViewHashes.empty() ? NULL : &ViewHashes[0], 42);
+		for(std::size_t i = 0; i < Count / 2; ++i)
+			Error += ViewHashes[i] == Hashes[i * 2] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_array()
+{
+	int Error = 0;
+
+	std::vector<glm::vec2> Vec2(100);
+	std::vector<glm::vec3> Vec3(100);
+	std::vector<glm::ivec4> IVec4(100);
+	std::vector<glm::mat3> Mat3(100);
+	std::vector<glm::dvec3> DVec3(100);
+	for(std::size_t i = 0; i < 100; ++i)
+	{
+		Vec2[i] = glm::linearRand(glm::vec2(-1), glm::vec2(1));
+		Vec3[i] = i % 3 ? glm::linearRand(glm::vec3(-1), glm::vec3(1)) : glm::vec3(-0.0f, 0.0f, -0.0f);
+		IVec4[i] = glm::ivec4(glm::linearRand(glm::vec4(-100), glm::vec4(100)));
+		Mat3[i] = glm::mat3(Vec3[i], Vec3[i] * 2.0f, -Vec3[i]);
+		DVec3[i] = glm::dvec3(Vec3[i]);
+	}
+
+	Error += test_array(Vec2);
+	Error += test_array(Vec3);
+	Error += test_array(IVec4);
+	Error += test_array(Mat3);
+	Error += test_array(DVec3);
+
+	return Error;
+}
+
+static int perf()
+{
+	std::size_t const Count = 1 << 20;
+
+	std::vector<glm::vec3> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = glm::linearRand(glm::vec3(-100), glm::vec3(100));
+	std::vector<glm::uint64> Hashes(Count);
+
+	std::clock_t const StartCombine = std::clock();
+	std::size_t Combined = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		std::size_t Seed = 0;
+		glm::detail::hash_combine(Seed, std::hash<float>()(Values[i].x));
+		glm::detail::hash_combine(Seed, std::hash<float>()(Values[i].y));
+		glm::detail::hash_combine(Seed, std::hash<float>()(Values[i].z));
+		Combined += Seed;
+	}
+	std::clock_t const StartBlock = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Hashes[i] = glm::hashBlock(Values[i]);
+	std::clock_t const StartArray = std::clock();
+	glm::hashBlock(&Values[0], Count, &Hashes[0]);
+	std::clock_t const End = std::clock();
+
+	std::printf("hash_combine: %d clocks, hashBlock: %d clocks, hashBlock array: %d clocks\n",
+		static_cast<int>(StartBlock - StartCombine), static_cast<int>(StartArray - StartBlock), static_cast<int>(End - StartArray));
+
+	return Combined != 0 ? 0 : 1;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_std_hash();
+	Error += test_collisions();
+	Error += test_array();
+	Error += perf();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif//GLM_HAS_CXX11_STL
@@ -0,0 +1,115 @@
+#define GLM_ENABLE_PROFILING
+#include <glm/gtx/profiling.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/vec4.hpp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int CallbackCalls = 0;
+
+static void count_vec4_add(char const * Function, char const *, bool)
+{
+	if(std::strcmp(Function, "compute_vec4_add") == 0)
+		++CallbackCalls;
+}
+
+static int test_calls()
+{
+	int Error = 0;
+
+	glm::profileReset();
+
+	glm::vec4 const a(1.0f), b(2.0f);
+	glm::vec4 Sum(0.0f);
+	for(int i = 0; i < 3; ++i)
+		Sum = Sum + a * b;
+
+	Error += glm::all(glm::equal(Sum, glm::vec4(6.0f))) ? 0 : 1;
+	Error += glm::profileCalls("compute_vec4_add", false) == 3 ? 0 : 1;
+	Error += glm::profileCalls("compute_vec4_mul", false) == 3 ? 0 : 1;
+	Error += glm::profileCalls("compute_vec4_add", true) == 0 ? 0 : 1;
+
+	glm::aligned_vec4 const c(1.0f), d(2.0f);
+	glm::aligned_vec4 const e = c + d;
+
+	Error += glm::all(glm::equal(glm::vec4(e), glm::vec4(3.0f))) ? 0 : 1;
+	// GLM_FORCE_DEBUG_FAST writes the operators component wise, also for the aligned types
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT && GLM_HAS_UNRESTRICTED_UNIONS && !GLM_DEBUG_FAST
+		Error += glm::profileCalls("compute_vec4_add", true) == 1 ? 0 : 1;
+		Error += glm::profileCalls("compute_vec4_add", false) == 3 ? 0 : 1;
+#	else
+		Error += glm::profileCalls("compute_vec4_add", false) == 4 ? 0 : 1;
+#	endif
+
+	glm::profileReset();
+	Error += glm::profileCalls("compute_vec4_add", false) == 0 ? 0 : 1;
+	Error += glm::profileRecords(NULL, 0) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_callback()
+{
+	int Error = 0;
+
+	glm::profileCallback(count_vec4_add);
+	glm::vec4 const a = glm::vec4(1.0f) + glm::vec4(2.0f);
+	glm::profileCallback(NULL);
+	glm::vec4 const b = a + a;
+
+	Error += glm::all(glm::equal(b, glm::vec4(6.0f))) ? 0 : 1;
+	Error += CallbackCalls == 1 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_records()
+{
+	int Error = 0;
+
+	glm::profileReset();
+
+	glm::vec4 const a(1.0f);
+	glm::ivec4 const b(1);
+	glm::vec4 const c = glm::normalize(a - a * 2.0f);
+	glm::ivec4 const d = b - b;
+
+	Error += glm::all(glm::equal(d, glm::ivec4(0))) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(c - glm::vec4(-0.5f)), glm::vec4(0.0001f))) ? 0 : 1;
+
+	std::size_t const Count = glm::profileRecords(NULL, 0);
+	Error += Count >= 3 ? 0 : 1;
+
+	std::vector<glm::profile_record> Records(Count);
+	Error += glm::profileRecords(&Records[0], Records.size()) == Count ? 0 : 1;
+
+	std::size_t SubRecords = 0;
+	for(std::size_t i = 0; i < Records.size(); ++i)
+	{
+		Error += Records[i].Calls > 0 ? 0 : 1;
+		if(i > 0)
+			Error += std::strcmp(Records[i - 1].Function, Records[i].Function) <= 0 ? 0 : 1;
+		if(std::strcmp(Records[i].Function, "compute_vec4_sub") == 0)
+			++SubRecords;
+	}
+
+	// float and int subtractions are distinct instantiations
+	Error += SubRecords == 2 ? 0 : 1;
+	Error += glm::profileCalls("compute_normalize", false) + glm::profileCalls("compute_normalize", true) == 1 ? 0 : 1;
+
+	glm::profileDump(stdout);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_calls();
+	Error += test_callback();
+	Error += test_records();
+
+	return Error;
+}
@@ -0,0 +1,178 @@
+#include <glm/gtx/radix_sort.hpp>
+#include <glm/gtc/random.hpp>
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+namespace radixSort
+{
+	template <typename genUType>
+	static int test_keys(std::vector<genUType> const & Keys)
+	{
+		int Error = 0;
+
+		std::vector<std::pair<genUType, glm::uint32> > Expected(Keys.size());
+		for(std::size_t i = 0; i < Keys.size(); ++i)
+			Expected[i] = std::make_pair(Keys[i], static_cast<glm::uint32>(i));
+		std::stable_sort(Expected.begin(), Expected.end());
+
+		std::vector<genUType> Sorted(Keys);
+		std::vector<glm::uint32> Indices(Keys.size());
+		for(std::size_t i = 0; i < Indices.size(); ++i)
+			Indices[i] = static_cast<glm::uint32>(i);
+
+		glm::radixSort(Sorted.empty() ? NULL : &Sorted[0], Indices.empty() ? NULL : &Indices[0], Sorted.size());
+
+		for(std::size_t i = 0; i < Keys.size(); ++i)
+		{
+			Error += Sorted[i] == Expected[i].first ? 0 : 1;
+			Error += Indices[i] == Expected[i].second ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static glm::uint64 random64()
+	{
+		static glm::uint64 State = 0x853c49e6748fea9bULL;
+		State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+		return State ^ (State >> 29);
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		std::size_t const Counts[] = {0, 1, 2, 255, 1000, 100000};
+		for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+		{
+			std::vector<glm::uint32> Keys32(Counts[c]);
+			std::vector<glm::uint32> Narrow32(Counts[c]);
+			std::vector<glm::uint64> Keys64(Counts[c]);
+			std::vector<glm::uint64> Narrow64(Counts[c]);
+			for(std::size_t i = 0; i < Counts[c]; ++i)
+			{
+				glm::uint64 const Random = random64();
+				Keys32[i] = static_cast<glm::uint32>(Random);
+				// Few distinct values in the middle bytes only: equal keys and skipped passes
+				Narrow32[i] = 0xAB0000CDu | (static_cast<glm::uint32>(Random & 0x3F) << 12);
+				Keys64[i] = Random;
+				Narrow64[i] = (Random & 0xFFFF) << 40;
+			}
+
+			Error += test_keys(Keys32);
+			Error += test_keys(Narrow32);
+			Error += test_keys(Keys64);
+			Error += test_keys(Narrow64);
+		}
+
+		return Error;
+	}
+
+	static int perf()
+	{
+		std::size_t const Count = 1 << 21;
+
+		std::vector<glm::uint32> Keys(Count);
+		std::vector<glm::uint32> Indices(Count);
+		std::vector<std::pair<glm::uint32, glm::uint32> > Pairs(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Keys[i] = static_cast<glm::uint32>(random64()) & 0x3FFFFFFF;
+			Indices[i] = static_cast<glm::uint32>(i);
+			Pairs[i] = std::make_pair(Keys[i], Indices[i]);
+		}
+
+		std::clock_t const StartRadix = std::clock();
+		glm::radixSort(&Keys[0], &Indices[0], Count);
+		std::clock_t const EndRadix = std::clock();
+		std::sort(Pairs.begin(), Pairs.end());
+		std::clock_t const EndSort = std::clock();
+
+		std::printf("radixSort: %d clocks, std::sort: %d clocks\n",
+			static_cast<int>(EndRadix - StartRadix), static_cast<int>(EndSort - EndRadix));
+
+		return Keys[Count / 2] == Pairs[Count / 2].first ? 0 : 1;
+	}
+}//namespace radixSort
+
+namespace mortonOrder
+{
+	template <typename genUType>
+	static genUType key(glm::vec3 const & Position, glm::vec3 const & Min, glm::vec3 const & Max, glm::uint32 Bits)
+	{
+		float const Limit = static_cast<float>((1u << Bits) - 1u);
+		glm::u32vec3 const Cell(glm::clamp((Position - Min) * (Limit / (Max - Min)), 0.0f, Limit) + 0.5f);
+
+		genUType Key = 0;
+		for(glm::uint32 Bit = 0; Bit < Bits; ++Bit)
+		{
+			Key |= static_cast<genUType>((Cell.x >> Bit) & 1) << (Bit * 3 + 0);
+			Key |= static_cast<genUType>((Cell.y >> Bit) & 1) << (Bit * 3 + 1);
+			Key |= static_cast<genUType>((Cell.z >> Bit) & 1) << (Bit * 3 + 2);
+		}
+		return Key;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const Min(-10, 0, 5);
+		glm::vec3 const Max(10, 4, 6);
+
+		std::size_t const Count = 3000;
+		std::vector<glm::vec3> Positions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Positions[i] = glm::linearRand(Min - 1.0f, Max + 1.0f);
+
+		std::vector<glm::uint32> Permutation(Count);
+		std::vector<glm::uint32> Permutation64(Count);
+		glm::mortonOrder(&Positions[0], Count, Min, Max, &Permutation[0]);
+		glm::mortonOrder64(&Positions[0], Count, Min, Max, &Permutation64[0]);
+
+		std::vector<bool> Seen(Count, false), Seen64(Count, false);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Permutation[i] < Count && !Seen[Permutation[i]] ? 0 : 1;
+			Error += Permutation64[i] < Count && !Seen64[Permutation64[i]] ? 0 : 1;
+			if(Permutation[i] < Count)
+				Seen[Permutation[i]] = true;
+			if(Permutation64[i] < Count)
+				Seen64[Permutation64[i]] = true;
+		}
+
+		for(std::size_t i = 1; i < Count; ++i)
+		{
+			Error += key<glm::uint32>(Positions[Permutation[i - 1]], Min, Max, 10) <= key<glm::uint32>(Positions[Permutation[i]], Min, Max, 10) ? 0 : 1;
+			Error += key<glm::uint64>(Positions[Permutation64[i - 1]], Min, Max, 21) <= key<glm::uint64>(Positions[Permutation64[i]], Min, Max, 21) ? 0 : 1;
+		}
+
+		// A strided view over vec4 positions gives the same order as the vec3 array
+		std::vector<glm::vec4> Interleaved(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Interleaved[i] = glm::vec4(Positions[i], 1.0f);
+		std::vector<glm::uint32> PermutationView(Count);
+		glm::mortonOrder(glm::make_vec3_view(&Interleaved[0].x, sizeof(glm::vec4), Count), Min, Max, &PermutationView[0]);
+		Error += PermutationView == Permutation ? 0 : 1;
+
+		glm::uint32 Dummy = 0xdeadbeef;
+		glm::mortonOrder(&Positions[0], 0, Min, Max, &Dummy);
+		Error += Dummy == 0xdeadbeef ? 0 : 1;
+
+		return Error;
+	}
+}//namespace mortonOrder
+
+int main()
+{
+	int Error(0);
+
+	Error += radixSort::test();
+	Error += radixSort::perf();
+	Error += mortonOrder::test();
+
+	return Error;
+}
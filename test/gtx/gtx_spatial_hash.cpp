@@ -0,0 +1,149 @@
+#include <glm/gtx/spatial_hash.hpp>
+#include <glm/gtc/random.hpp>
+#include <algorithm>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+struct neighbor_counter
+{
+	neighbor_counter(glm::vec3 const & Center, float Radius)
+		: Center(Center), Radius2(Radius * Radius), Count(0)
+	{}
+
+	void operator()(glm::uint32 const *, glm::vec3 const * Positions, std::size_t Size)
+	{
+		for(std::size_t i = 0; i < Size; ++i)
+			Count += glm::dot(Positions[i] - Center, Positions[i] - Center) <= Radius2 ? 1 : 0;
+	}
+
+	glm::vec3 Center;
+	float Radius2;
+	std::size_t Count;
+};
+
+static std::vector<glm::uint32> brute_force(std::vector<glm::vec3> const & Positions, glm::vec3 const & Center, float Radius)
+{
+	std::vector<glm::uint32> Result;
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		if(glm::dot(Positions[i] - Center, Positions[i] - Center) <= Radius * Radius)
+			Result.push_back(static_cast<glm::uint32>(i));
+	return Result;
+}
+
+static int test_cell()
+{
+	int Error = 0;
+
+	glm::spatial_hash Grid(0.5f);
+	Error += Grid.cell(glm::vec3(0.1f, 0.6f, -0.1f)) == glm::ivec3(0, 1, -1) ? 0 : 1;
+	Error += Grid.cell(glm::vec3(-0.5f, 1.0f, 0.0f)) == glm::ivec3(-1, 2, 0) ? 0 : 1;
+
+	glm::uint32 const * Indices = NULL;
+	glm::vec3 const * Positions = NULL;
+	Error += Grid.cellPoints(glm::ivec3(0), Indices, Positions) == 0 ? 0 : 1;
+
+	glm::vec3 const Points[] = {glm::vec3(0.1f), glm::vec3(2.0f), glm::vec3(0.2f), glm::vec3(-0.1f)};
+	Grid.insert(Points, 3);
+	Grid.insert(Points + 3, 1);
+	Error += Grid.size() == 4 ? 0 : 1;
+	Error += Grid.cellCount() == 3 ? 0 : 1;
+	Error += Grid.position(3) == Points[3] ? 0 : 1;
+
+	Error += Grid.cellPoints(glm::ivec3(0), Indices, Positions) == 2 ? 0 : 1;
+	Error += Indices[0] == 0 && Indices[1] == 2 ? 0 : 1;
+	Error += Positions[1] == Points[2] ? 0 : 1;
+	Error += Grid.cellPoints(glm::ivec3(-1), Indices, Positions) == 1 && Indices[0] == 3 ? 0 : 1;
+
+	Grid.clear();
+	Error += Grid.size() == 0 && Grid.cellCount() == 0 ? 0 : 1;
+	Error += Grid.cellPoints(glm::ivec3(0), Indices, Positions) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_query()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions(5000);
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Positions[i] = glm::linearRand(glm::vec3(-10), glm::vec3(10));
+
+	glm::spatial_hash Grid(1.0f);
+	Grid.insert(&Positions[0], Positions.size() / 2);
+	Grid.insert(&Positions[Positions.size() / 2], Positions.size() - Positions.size() / 2);
+
+	float const Radii[] = {0.0f, 0.3f, 1.0f, 2.5f, 40.0f};
+	for(std::size_t r = 0; r < sizeof(Radii) / sizeof(Radii[0]); ++r)
+	for(std::size_t q = 0; q < 50; ++q)
+	{
+		glm::vec3 const Center = q == 0 ? Positions[7] : glm::linearRand(glm::vec3(-12), glm::vec3(12));
+
+		std::vector<glm::uint32> Result;
+		std::size_t const Found = Grid.queryRadius(Center, Radii[r], Result);
+		std::sort(Result.begin(), Result.end());
+
+		Error += Found == Result.size() ? 0 : 1;
+		Error += Result == brute_force(Positions, Center, Radii[r]) ? 0 : 1;
+	}
+
+	// With the cell size as radius, the neighbor cells hold every neighbor
+	for(std::size_t q = 0; q < 50; ++q)
+	{
+		glm::vec3 const & Center = Positions[q];
+		neighbor_counter Counter(Center, 1.0f);
+		Grid.forEachNeighborCell(Grid.cell(Center), Counter);
+		Error += Counter.Count == brute_force(Positions, Center, 1.0f).size() ? 0 : 1;
+	}
+
+	// Points inserted through a strided view keep their indices
+	std::vector<glm::vec4> Points(Positions.size());
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Points[i] = glm::vec4(Positions[i], 0.0f);
+	glm::spatial_hash ViewGrid(1.0f);
+	ViewGrid.insert(glm::make_vec3_view(&Points[0].x, sizeof(glm::vec4), Points.size()));
+	Error += ViewGrid.size() == Positions.size() && ViewGrid.position(42) == Positions[42] ? 0 : 1;
+
+	return Error;
+}
+
+static int perf()
+{
+	std::size_t const Count = 200000;
+	float const Radius = 0.02f;
+
+	std::vector<glm::vec3> Positions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Positions[i] = glm::linearRand(glm::vec3(0), glm::vec3(1));
+
+	std::clock_t const StartBuild = std::clock();
+	glm::spatial_hash Grid(Radius);
+	Grid.insert(&Positions[0], Count);
+	std::clock_t const EndBuild = std::clock();
+
+	std::size_t Neighbors = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		neighbor_counter Counter(Positions[i], Radius);
+		Grid.forEachNeighborCell(Grid.cell(Positions[i]), Counter);
+		Neighbors += Counter.Count;
+	}
+	std::clock_t const EndQuery = std::clock();
+
+	std::printf("spatial_hash insert: %d clocks, neighbor search: %d clocks, %d neighbors\n",
+		static_cast<int>(EndBuild - StartBuild), static_cast<int>(EndQuery - EndBuild), static_cast<int>(Neighbors));
+
+	return Neighbors >= Count ? 0 : 1;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_cell();
+	Error += test_query();
+	Error += perf();
+
+	return Error;
+}
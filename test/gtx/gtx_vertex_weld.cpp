@@ -0,0 +1,153 @@
+#include <glm/gtx/vertex_weld.hpp>
+#include <glm/gtc/random.hpp>
+#include <ctime>
+#include <cstdio>
+#include <vector>
+
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::vec2 TexCoord;
+};
+
+// Greedy reference: each vertex is welded to the first kept vertex within the epsilons
+static std::size_t weld_reference(std::vector<vertex> const & Vertices, float Epsilon, float AttributeEpsilon, std::vector<glm::uint32> & Remap)
+{
+	std::vector<std::size_t> Kept;
+	Remap.resize(Vertices.size());
+	for(std::size_t i = 0; i < Vertices.size(); ++i)
+	{
+		std::size_t k = 0;
+		for(; k < Kept.size(); ++k)
+		{
+			vertex const & a = Vertices[Kept[k]];
+			vertex const & b = Vertices[i];
+			if(glm::all(glm::lessThanEqual(glm::abs(a.Position - b.Position), glm::vec3(Epsilon))) &&
+				glm::all(glm::lessThanEqual(glm::abs(a.Normal - b.Normal), glm::vec3(AttributeEpsilon))) &&
+				glm::all(glm::lessThanEqual(glm::abs(a.TexCoord - b.TexCoord), glm::vec2(AttributeEpsilon))))
+				break;
+		}
+		if(k == Kept.size())
+			Kept.push_back(i);
+		Remap[i] = static_cast<glm::uint32>(k);
+	}
+	return Kept.size();
+}
+
+static std::vector<vertex> make_mesh(std::size_t Count, float Jitter)
+{
+	std::vector<vertex> Vertices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		// Few distinct vertices, each duplicated with a small jitter
+		std::size_t const Id = static_cast<std::size_t>(glm::linearRand(0.0f, static_cast<float>(Count / 4)));
+		vertex & Vertex = Vertices[i];
+		Vertex.Position = glm::vec3(Id % 7, (Id / 7) % 7, Id / 49) * 0.1f - 0.3f + glm::linearRand(glm::vec3(-Jitter), glm::vec3(Jitter));
+		Vertex.Normal = glm::vec3(0, 0, Id % 2 ? 1 : -1);
+		Vertex.TexCoord = glm::vec2(Id % 3, 0) + glm::linearRand(glm::vec2(-Jitter), glm::vec2(Jitter));
+	}
+	return Vertices;
+}
+
+static int test_weld()
+{
+	int Error = 0;
+
+	float const Epsilons[] = {0.0f, 0.001f, 0.01f, 0.06f};
+	std::size_t const Counts[] = {0, 1, 17, 1000};
+	for(std::size_t e = 0; e < sizeof(Epsilons) / sizeof(Epsilons[0]); ++e)
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::vector<vertex> const Vertices = make_mesh(Counts[c], 0.002f);
+		std::size_t const Count = Vertices.size();
+
+		std::vector<glm::vec3> Positions(Count), Normals(Count);
+		std::vector<glm::vec2> TexCoords(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Positions[i] = Vertices[i].Position;
+			Normals[i] = Vertices[i].Normal;
+			TexCoords[i] = Vertices[i].TexCoord;
+		}
+
+		std::vector<glm::uint32> Expected;
+		std::size_t const ExpectedCount = weld_reference(Vertices, Epsilons[e], Epsilons[e] * 2.0f, Expected);
+
+		std::vector<glm::uint32> Separate(Count + 1, 0xdeadbeef);
+		std::size_t const SeparateCount = glm::weldVertices(Count ? &Positions[0] : NULL, Count ? &Normals[0] : NULL, Count ? &TexCoords[0] : NULL, Count, Epsilons[e], Epsilons[e] * 2.0f, &Separate[0]);
+		Error += SeparateCount == ExpectedCount ? 0 : 1;
+		Error += Separate[Count] == 0xdeadbeef ? 0 : 1;
+
+		std::vector<glm::uint32> Interleaved(Count);
+		std::size_t const InterleavedCount = glm::weldVertices(Count ? &Vertices[0].Position.x : NULL, Count, sizeof(vertex), 8, Epsilons[e], Epsilons[e] * 2.0f, Count ? &Interleaved[0] : NULL);
+		Error += InterleavedCount == ExpectedCount ? 0 : 1;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Separate[i] == Expected[i] ? 0 : 1;
+			Error += Interleaved[i] == Expected[i] ? 0 : 1;
+		}
+
+		// Positions only: never more welded vertices than with attributes
+		std::vector<glm::uint32> PositionOnly(Count);
+		Error += glm::weldVertices(Count ? &Positions[0] : NULL, Count, Epsilons[e], Count ? &PositionOnly[0] : NULL) <= ExpectedCount ? 0 : 1;
+
+		// Positions read in place from the interleaved vertices
+		std::vector<glm::uint32> PositionView(Count);
+		glm::tstrided_view<glm::vec3 const> const View(Count ? &Vertices[0].Position : NULL, sizeof(vertex), Count);
+		glm::weldVertices(View, Epsilons[e], Count ? &PositionView[0] : NULL);
+		Error += PositionView == PositionOnly ? 0 : 1;
+
+		// Compaction keeps the first vertex of each welded vertex
+		std::vector<vertex> Welded(ExpectedCount);
+		glm::compactVertices(Count ? &Vertices[0] : NULL, Count, Count ? &Expected[0] : NULL, ExpectedCount ? &Welded[0] : NULL);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::lessThanEqual(glm::abs(Welded[Expected[i]].Position - Vertices[i].Position), glm::vec3(Epsilons[e]))) ? 0 : 1;
+	}
+
+	// Exact welding treats -0 and +0 as equal
+	glm::vec3 const Signed[] = {glm::vec3(0.0f, 1.0f, 2.0f), glm::vec3(-0.0f, 1.0f, 2.0f), glm::vec3(0.0f, 1.0f, 2.5f)};
+	glm::uint32 Remap[3];
+	Error += glm::weldVertices(Signed, 3, 0.0f, Remap) == 2 ? 0 : 1;
+	Error += Remap[0] == 0 && Remap[1] == 0 && Remap[2] == 1 ? 0 : 1;
+
+	// Vertices across a cell boundary are welded
+	glm::vec3 const Boundary[] = {glm::vec3(0.0999f, -0.0001f, 1e9f), glm::vec3(0.1001f, 0.0001f, 1e9f)};
+	Error += glm::weldVertices(Boundary, 2, 0.001f, Remap) == 1 ? 0 : 1;
+
+	return Error;
+}
+
+static int perf()
+{
+	std::size_t const Count = 1 << 20;
+
+	// Each unique position is referenced by 4 vertices, in random order
+	std::vector<glm::vec3> Unique(Count / 4);
+	for(std::size_t i = 0; i < Unique.size(); ++i)
+		Unique[i] = glm::linearRand(glm::vec3(0), glm::vec3(10));
+
+	std::vector<glm::vec3> Positions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Positions[i] = Unique[static_cast<std::size_t>(glm::linearRand(0.0f, static_cast<float>(Unique.size() - 1)))] + glm::linearRand(glm::vec3(-0.0001f), glm::vec3(0.0001f));
+
+	std::vector<glm::uint32> Remap(Count);
+	std::clock_t const Start = std::clock();
+	std::size_t const Welded = glm::weldVertices(&Positions[0], Count, 0.001f, &Remap[0]);
+	std::clock_t const End = std::clock();
+
+	std::printf("weldVertices: %d clocks, %d vertices welded to %d\n", static_cast<int>(End - Start), static_cast<int>(Count), static_cast<int>(Welded));
+
+	return Welded <= Unique.size() ? 0 : 1;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_weld();
+	Error += perf();
+
+	return Error;
+}